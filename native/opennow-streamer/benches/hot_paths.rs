@@ -0,0 +1,217 @@
+//! Criterion benches for the per-frame hot paths: input wire encoding and the
+//! SDP rewrite chain. Run with `cargo bench` and compare against the committed
+//! `benches/baseline.txt`; Criterion also keeps its own history under
+//! `target/criterion` for local before/after diffs.
+//!
+//! The crate only ships a binary target, so the modules under test are pulled
+//! in by path instead of through a library target. That recompiles each file's
+//! `#[cfg(test)]` module under the bench profile, where its `use super::*` has
+//! nothing to resolve against — hence the unused-imports allow.
+#![allow(dead_code)]
+#![allow(unused_imports)]
+
+#[path = "../src/protocol.rs"]
+mod protocol;
+
+#[path = "../src/input.rs"]
+mod input;
+
+#[path = "../src/sdp.rs"]
+mod sdp;
+
+use criterion::{criterion_group, criterion_main, Criterion, Throughput};
+use input::{GamepadInput, InputEncoder, MouseMovePayload};
+use protocol::{ColorQuality, VideoCodec};
+use sdp::{
+    build_nvst_sdp_for_answer, extract_ice_credentials, prefer_codec, NvstParams,
+    PreferCodecOptions, SdpLineTable,
+};
+use std::hint::black_box;
+
+fn gamepad_input(controller_id: u8, timestamp_us: u64) -> GamepadInput {
+    GamepadInput {
+        controller_id,
+        buttons: 0x0084,
+        left_trigger: 40,
+        right_trigger: 0,
+        left_stick_x: -1_200,
+        left_stick_y: 9_800,
+        right_stick_x: 300,
+        right_stick_y: -4_500,
+        connected: true,
+        timestamp_us,
+    }
+}
+
+/// A GFN-shaped offer: session-level ICE attributes, an audio m-line and a
+/// video m-line carrying the usual codec/rtx payload spread.
+fn sample_offer_sdp() -> String {
+    [
+        "v=0",
+        "o=- 4611731400430051336 2 IN IP4 127.0.0.1",
+        "s=-",
+        "t=0 0",
+        "a=group:BUNDLE 0 1",
+        "c=IN IP4 0.0.0.0",
+        "a=ice-ufrag:2efecf37",
+        "a=ice-pwd:26b335b8-6cb2-4c18-96d0-963e5e586c9a",
+        "a=fingerprint:sha-256 AA:BB:CC:DD:EE:FF:00:11:22:33:44:55:66:77:88:99:AA:BB:CC:DD:EE:FF:00:11:22:33:44:55:66:77:88:99",
+        "a=ri.inputRedundancy:2",
+        "m=audio 9 UDP/TLS/RTP/SAVPF 111",
+        "a=mid:0",
+        "a=rtpmap:111 OPUS/48000/2",
+        "a=fmtp:111 minptime=10;useinbandfec=1",
+        "m=video 9 UDP/TLS/RTP/SAVPF 96 97 98 99 100 101",
+        "a=mid:1",
+        "a=rtpmap:96 H264/90000",
+        "a=fmtp:96 profile-level-id=42e01f;packetization-mode=1",
+        "a=rtpmap:97 rtx/90000",
+        "a=fmtp:97 apt=96",
+        "a=rtpmap:98 H265/90000",
+        "a=fmtp:98 profile-id=1",
+        "a=rtpmap:99 H265/90000",
+        "a=fmtp:99 profile-id=2",
+        "a=rtpmap:100 AV1/90000",
+        "a=rtpmap:101 rtx/90000",
+        "a=fmtp:101 apt=100",
+        "a=framerate:60",
+        "a=candidate:1 1 udp 2130706431 10.0.0.7 49003 typ host",
+    ]
+    .join("\r\n")
+}
+
+fn nvst_params(offer_sdp: &str) -> NvstParams {
+    NvstParams {
+        width: 2560,
+        height: 1440,
+        fps: 120,
+        max_bitrate_kbps: 75_000,
+        partial_reliable_threshold_ms: 16,
+        codec: VideoCodec::H265,
+        color_quality: ColorQuality::TenBit420,
+        credentials: extract_ice_credentials(offer_sdp),
+        hid_device_mask: Some(input::PARTIALLY_RELIABLE_HID_DEVICE_MASK_ALL),
+        enable_partially_reliable_transfer_gamepad: Some(
+            input::PARTIALLY_RELIABLE_GAMEPAD_MASK_ALL,
+        ),
+        enable_partially_reliable_transfer_hid: Some(
+            input::PARTIALLY_RELIABLE_HID_DEVICE_MASK_ALL,
+        ),
+    }
+}
+
+fn bench_input_encoder(c: &mut Criterion) {
+    let mut group = c.benchmark_group("input_encoder");
+    group.throughput(Throughput::Elements(1));
+
+    group.bench_function("encode_mouse_move", |b| {
+        let mut encoder = InputEncoder::new(3);
+        let mut timestamp_us = 0u64;
+        b.iter(|| {
+            timestamp_us += 1_000;
+            black_box(encoder.encode_mouse_move(MouseMovePayload {
+                dx: 3,
+                dy: -2,
+                timestamp_us,
+            }))
+            .len()
+        });
+    });
+
+    group.bench_function("encode_gamepad_state_partially_reliable", |b| {
+        let mut encoder = InputEncoder::new(3);
+        let mut timestamp_us = 0u64;
+        b.iter(|| {
+            timestamp_us += 1_000;
+            black_box(encoder.encode_gamepad_state(0b1, gamepad_input(0, timestamp_us), true))
+                .len()
+        });
+    });
+
+    group.bench_function("encode_gamepad_state_redundancy_3", |b| {
+        let mut encoder = InputEncoder::new(3);
+        encoder.set_input_redundancy(3);
+        let mut timestamp_us = 0u64;
+        b.iter(|| {
+            timestamp_us += 1_000;
+            black_box(encoder.encode_gamepad_state(0b1, gamepad_input(0, timestamp_us), true))
+                .len()
+        });
+    });
+
+    group.bench_function("batch_mouse_moves_and_four_gamepads", |b| {
+        let mut encoder = InputEncoder::new(3);
+        let mut timestamp_us = 0u64;
+        b.iter(|| {
+            timestamp_us += 1_000;
+            encoder.begin_batch();
+            for _ in 0..4 {
+                encoder.batch_mouse_move(MouseMovePayload {
+                    dx: 3,
+                    dy: -2,
+                    timestamp_us,
+                });
+            }
+            for controller_id in 0..4 {
+                encoder.batch_gamepad_state(
+                    1 << controller_id,
+                    gamepad_input(controller_id, timestamp_us),
+                    true,
+                );
+            }
+            black_box(encoder.finish_batch()).len()
+        });
+    });
+
+    group.finish();
+}
+
+fn bench_sdp(c: &mut Criterion) {
+    let offer = sample_offer_sdp();
+    let params = nvst_params(&offer);
+    let answer = build_nvst_sdp_for_answer(&params, &offer).expect("valid answer SDP");
+
+    let mut group = c.benchmark_group("sdp");
+    group.throughput(Throughput::Elements(1));
+
+    group.bench_function("offer_rewrite_chain", |b| {
+        // The full prepare_native_offer SDP sequence: one parse, the shared
+        // transforms, and both emitted variants.
+        b.iter(|| {
+            let mut table = SdpLineTable::parse(black_box(&offer));
+            table.fix_server_ip("80-250-97-40.cloudmatchbeta.nvidiagrid.net");
+            table.duplicate_session_webrtc_attributes_to_media();
+            table.prefer_codec(
+                VideoCodec::H265,
+                PreferCodecOptions {
+                    prefer_hevc_profile_id: Some(2),
+                },
+            );
+            let fixed = table.emit();
+            table.align_video_framerate(120);
+            table.sanitize_ice_pwd_for_gstreamer();
+            black_box((fixed, table.emit()))
+        });
+    });
+
+    group.bench_function("prefer_codec", |b| {
+        b.iter(|| {
+            black_box(prefer_codec(
+                black_box(&offer),
+                VideoCodec::AV1,
+                PreferCodecOptions {
+                    prefer_hevc_profile_id: None,
+                },
+            ))
+        });
+    });
+
+    group.bench_function("build_nvst_sdp_for_answer", |b| {
+        b.iter(|| black_box(build_nvst_sdp_for_answer(&params, black_box(&answer))));
+    });
+
+    group.finish();
+}
+
+criterion_group!(benches, bench_input_encoder, bench_sdp);
+criterion_main!(benches);
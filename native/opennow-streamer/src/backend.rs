@@ -5,9 +5,8 @@ use crate::protocol::{
     PROTOCOL_VERSION,
 };
 use crate::sdp::{
-    duplicate_session_webrtc_attributes_to_media, extract_ice_credentials, fix_server_ip,
-    parse_resolution, prefer_codec, sanitize_ice_pwd_for_gstreamer,
-    summarize_media_transport_attributes, NvstParams, PreferCodecOptions,
+    extract_ice_credentials, parse_resolution, summarize_media_transport_attributes, NvstParams,
+    PreferCodecOptions, SdpLineTable,
 };
 use std::env;
 use std::sync::mpsc::Sender;
@@ -21,6 +20,7 @@ pub trait NativeStreamerBackend {
     fn update_render_surface(&mut self, command: CommandEnvelope) -> BackendReply;
     fn update_bitrate_limit(&mut self, command: CommandEnvelope) -> BackendReply;
     fn update_shortcuts(&mut self, command: CommandEnvelope) -> BackendReply;
+    fn benchmark_decoders(&mut self, command: CommandEnvelope) -> BackendReply;
     fn stop(&mut self, command: CommandEnvelope) -> BackendReply;
 }
 
@@ -118,6 +118,7 @@ pub struct PreparedNativeOffer {
     pub gstreamer_framerate_adjusted: bool,
     pub nvst_params: NvstParams,
     pub media_connection_info: Option<MediaConnectionInfo>,
+    pub pacing_fps_clamped_from: Option<u32>,
 }
 
 #[derive(Debug, Clone, PartialEq, Eq)]
@@ -147,27 +148,38 @@ pub fn prepare_native_offer(
         });
     };
 
-    let fixed_offer_sdp = duplicate_session_webrtc_attributes_to_media(&fix_server_ip(
-        offer_sdp,
-        &context.session.server_ip,
-    ));
+    // One parse covers the whole rewrite chain: the fixed offer is emitted
+    // mid-flight and the table then keeps accumulating the GStreamer-only
+    // transforms before emitting the second variant.
     let codec = resolve_native_codec(context.settings.codec);
-    let fixed_offer_sdp = prefer_codec(
-        &fixed_offer_sdp,
+    // The renderer's frame-pacing engine can ask for a lower fps than the user
+    // setting when presentation only locks cleanly to a panel-refresh divisor.
+    // The hint never raises fps above the configured ceiling.
+    let pacing_fps_hint = context
+        .session
+        .negotiated_stream_profile
+        .as_ref()
+        .and_then(|profile| profile.pacing_fps_hint)
+        .filter(|hint| *hint > 0 && *hint < context.settings.fps);
+    let fps = pacing_fps_hint.unwrap_or(context.settings.fps);
+    let mut offer = SdpLineTable::parse(offer_sdp);
+    offer.fix_server_ip(&context.session.server_ip);
+    offer.duplicate_session_webrtc_attributes_to_media();
+    offer.prefer_codec(
         codec,
         PreferCodecOptions {
             prefer_hevc_profile_id: Some(preferred_hevc_profile_id(context.settings.color_quality)),
         },
     );
-    let (gstreamer_framerate_offer_sdp, gstreamer_framerate_adjusted) =
-        align_video_sdp_framerate_for_gstreamer(&fixed_offer_sdp, context.settings.fps);
-    let (gstreamer_offer_sdp, gstreamer_ice_pwd_replacements) =
-        sanitize_ice_pwd_for_gstreamer(&gstreamer_framerate_offer_sdp);
+    let fixed_offer_sdp = offer.emit();
+    let gstreamer_framerate_adjusted = offer.align_video_framerate(fps);
+    let gstreamer_ice_pwd_replacements = offer.sanitize_ice_pwd_for_gstreamer();
+    let gstreamer_offer_sdp = offer.emit();
     let credentials = extract_ice_credentials(&fixed_offer_sdp);
     let nvst_params = NvstParams {
         width,
         height,
-        fps: context.settings.fps,
+        fps,
         max_bitrate_kbps: context.settings.max_bitrate_mbps.saturating_mul(1000),
         partial_reliable_threshold_ms: 16,
         codec,
@@ -186,65 +198,10 @@ pub fn prepare_native_offer(
         gstreamer_framerate_adjusted,
         nvst_params,
         media_connection_info: context.session.media_connection_info.clone(),
+        pacing_fps_clamped_from: pacing_fps_hint.map(|_| context.settings.fps),
     })
 }
 
-fn align_video_sdp_framerate_for_gstreamer(sdp: &str, fps: u32) -> (String, bool) {
-    if fps == 0 {
-        return (sdp.to_owned(), false);
-    }
-
-    let line_ending = if sdp.contains("\r\n") { "\r\n" } else { "\n" };
-    let has_trailing_ending = sdp.ends_with(line_ending);
-    let mut lines: Vec<String> = sdp
-        .split(line_ending)
-        .filter(|line| !line.is_empty() || !has_trailing_ending)
-        .map(ToOwned::to_owned)
-        .collect();
-    let mut output = Vec::with_capacity(lines.len() + 1);
-    let mut in_video = false;
-    let mut video_has_framerate = false;
-    let mut changed = false;
-    let target = format!("a=framerate:{fps}");
-
-    for line in lines.drain(..) {
-        if line.starts_with("m=") {
-            if in_video && !video_has_framerate {
-                output.push(target.clone());
-                changed = true;
-            }
-            in_video = line.starts_with("m=video");
-            video_has_framerate = false;
-            output.push(line);
-            continue;
-        }
-
-        if in_video && line.starts_with("a=framerate:") {
-            video_has_framerate = true;
-            if line != target {
-                output.push(target.clone());
-                changed = true;
-            } else {
-                output.push(line);
-            }
-            continue;
-        }
-
-        output.push(line);
-    }
-
-    if in_video && !video_has_framerate {
-        output.push(target);
-        changed = true;
-    }
-
-    let mut result = output.join(line_ending);
-    if has_trailing_ending {
-        result.push_str(line_ending);
-    }
-    (result, changed)
-}
-
 fn resolve_native_codec(configured: VideoCodec) -> VideoCodec {
     match env::var(NATIVE_CODEC_ENV)
         .unwrap_or_else(|_| "auto".to_owned())
@@ -274,6 +231,16 @@ pub fn prepared_offer_events(prepared: &PreparedNativeOffer) -> Vec<Event> {
         ),
     }];
 
+    if let Some(configured_fps) = prepared.pacing_fps_clamped_from {
+        events.push(Event::Log {
+            level: "info",
+            message: format!(
+                "Frame-pacing hint lowered the stream fps from {} to {} for judder-free presentation.",
+                configured_fps, nvst.fps
+            ),
+        });
+    }
+
     if prepared.gstreamer_framerate_adjusted {
         events.push(Event::Log {
             level: "info",
@@ -466,6 +433,14 @@ impl NativeStreamerBackend for StubBackend {
         BackendReply::response(Response::Ok { id: command.id })
     }
 
+    fn benchmark_decoders(&mut self, command: CommandEnvelope) -> BackendReply {
+        BackendReply::response(Response::Error {
+            id: Some(command.id),
+            code: "backend-unavailable".to_owned(),
+            message: "Decoder benchmarking requires the GStreamer media backend.".to_owned(),
+        })
+    }
+
     fn stop(&mut self, command: CommandEnvelope) -> BackendReply {
         self.active_context = None;
         let message = command
@@ -498,7 +473,10 @@ fn preferred_hevc_profile_id(color_quality: ColorQuality) -> u8 {
 #[cfg(test)]
 mod tests {
     use super::*;
-    use crate::protocol::{ColorQuality, NativeStreamerShortcutBindings, SessionInfo, StreamSettings};
+    use crate::protocol::{
+        ColorQuality, NativeStreamerShortcutBindings, NegotiatedStreamProfile, SessionInfo,
+        StreamSettings,
+    };
 
     fn context(resolution: &str) -> NativeStreamerSessionContext {
         NativeStreamerSessionContext {
@@ -549,6 +527,29 @@ mod tests {
         );
     }
 
+    #[test]
+    fn prepares_offer_applies_pacing_fps_hint_only_when_lowering() {
+        let offer = "v=0\nc=IN IP4 0.0.0.0\na=ice-ufrag:user\na=ice-pwd:pass\na=fingerprint:sha-256 AA:BB\n";
+
+        let mut hinted = context("1920x1080");
+        hinted.session.negotiated_stream_profile = Some(NegotiatedStreamProfile {
+            pacing_fps_hint: Some(60),
+            ..NegotiatedStreamProfile::default()
+        });
+        let prepared = prepare_native_offer(&hinted, offer).expect("valid offer");
+        assert_eq!(prepared.nvst_params.fps, 60);
+        assert_eq!(prepared.pacing_fps_clamped_from, Some(120));
+
+        let mut raising = context("1920x1080");
+        raising.session.negotiated_stream_profile = Some(NegotiatedStreamProfile {
+            pacing_fps_hint: Some(144),
+            ..NegotiatedStreamProfile::default()
+        });
+        let prepared = prepare_native_offer(&raising, offer).expect("valid offer");
+        assert_eq!(prepared.nvst_params.fps, 120);
+        assert_eq!(prepared.pacing_fps_clamped_from, None);
+    }
+
     #[test]
     fn prepares_offer_filters_remote_video_to_requested_codec() {
         let offer = [
@@ -593,40 +594,6 @@ mod tests {
             .contains("a=rtpmap:100 flexfec-03/90000"));
     }
 
-    #[test]
-    fn aligns_gstreamer_video_sdp_framerate() {
-        let sdp = "v=0\nm=video 9 UDP/TLS/RTP/SAVPF 96\na=framerate:60\na=rtpmap:96 H265/90000\n";
-
-        let (aligned, changed) = align_video_sdp_framerate_for_gstreamer(sdp, 240);
-
-        assert!(changed);
-        assert!(aligned.contains("a=framerate:240\n"));
-        assert!(!aligned.contains("a=framerate:60"));
-    }
-
-    #[test]
-    fn inserts_gstreamer_video_sdp_framerate_when_absent() {
-        let sdp = "v=0\nm=audio 9 UDP/TLS/RTP/SAVPF 111\na=rtpmap:111 OPUS/48000/2\nm=video 9 UDP/TLS/RTP/SAVPF 96\na=rtpmap:96 H265/90000\nm=application 9 UDP/DTLS/SCTP webrtc-datachannel\n";
-
-        let (aligned, changed) = align_video_sdp_framerate_for_gstreamer(sdp, 120);
-
-        assert!(changed);
-        assert!(aligned.contains(
-            "m=video 9 UDP/TLS/RTP/SAVPF 96\na=rtpmap:96 H265/90000\na=framerate:120\nm=application"
-        ));
-    }
-
-    #[test]
-    fn preserves_gstreamer_video_sdp_framerate_line_endings() {
-        let sdp = "v=0\r\nm=video 9 UDP/TLS/RTP/SAVPF 96\r\na=rtpmap:96 H265/90000\r\n";
-
-        let (aligned, changed) = align_video_sdp_framerate_for_gstreamer(sdp, 240);
-
-        assert!(changed);
-        assert!(aligned.contains("a=framerate:240\r\n"));
-        assert!(!aligned.contains('\n') || aligned.contains("\r\n"));
-    }
-
     #[test]
     fn rejects_invalid_resolution_during_offer_preparation() {
         let error = prepare_native_offer(&context("bad"), "v=0").expect_err("invalid resolution");
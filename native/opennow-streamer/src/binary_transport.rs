@@ -0,0 +1,455 @@
+//! Length-prefixed binary IPC channel shared with the Electron main process.
+//!
+//! JSON-over-stdio stays in place for control commands, but high-rate traffic
+//! (input packets at mouse polling rate, periodic stats events) is negotiated
+//! onto a local byte stream: a Unix domain socket on Linux/macOS and a named
+//! pipe on Windows. The Electron side listens before spawning this process and
+//! publishes the endpoint through `OPENNOW_NATIVE_BINARY_ENDPOINT`; if the
+//! endpoint is absent or the connection fails, everything keeps flowing over
+//! stdio unchanged.
+//!
+//! Frame layout (little-endian): `u32` body length, then the body. The first
+//! body byte is the frame type.
+//! - `FRAME_TYPE_INPUT` (main -> native): `u8` flags (bit 0 = partially
+//!   reliable) followed by the raw input payload bytes.
+//! - `FRAME_TYPE_EVENT` (native -> main): a JSON-serialized `Event`.
+//! - `FRAME_TYPE_STATS` (native -> main): a fixed-layout `NativeStatsEvent`.
+//!   Body: `u8` layout version, `u16` presence/bool flags, a fixed numeric
+//!   section (absent optionals are written as zero and masked by the flags),
+//!   then `u16`-length-prefixed UTF-8 strings in a fixed order. The Electron
+//!   side forwards the body to the renderer as a typed buffer without a JSON
+//!   round trip.
+
+use crate::protocol::{Event, NativeStatsEvent};
+use std::io::{Read, Write};
+use std::sync::atomic::{AtomicBool, Ordering};
+use std::sync::{Arc, Mutex};
+use std::thread;
+use std::time::Duration;
+
+pub const BINARY_ENDPOINT_ENV: &str = "OPENNOW_NATIVE_BINARY_ENDPOINT";
+
+const FRAME_TYPE_INPUT: u8 = 1;
+const FRAME_TYPE_EVENT: u8 = 2;
+const FRAME_TYPE_STATS: u8 = 3;
+const MAX_FRAME_BYTES: u32 = 1024 * 1024;
+const CONNECT_ATTEMPTS: u32 = 10;
+const CONNECT_RETRY_DELAY: Duration = Duration::from_millis(200);
+
+#[derive(Debug)]
+pub struct BinaryInputFrame {
+    pub payload: Vec<u8>,
+    pub partially_reliable: bool,
+}
+
+#[derive(Clone, Default)]
+pub struct BinaryTransport {
+    writer: Arc<Mutex<Option<Box<dyn Write + Send>>>>,
+    connected: Arc<AtomicBool>,
+}
+
+impl BinaryTransport {
+    /// Reads the negotiated endpoint from the environment and, when present,
+    /// starts the background connect/read thread. Input frames are delivered
+    /// through `on_input` from that thread.
+    pub fn start_from_env<F>(&self, on_input: F) -> bool
+    where
+        F: Fn(BinaryInputFrame) + Send + 'static,
+    {
+        let Some(endpoint) = std::env::var(BINARY_ENDPOINT_ENV)
+            .ok()
+            .map(|value| value.trim().to_owned())
+            .filter(|value| !value.is_empty())
+        else {
+            return false;
+        };
+
+        let writer = self.writer.clone();
+        let connected = self.connected.clone();
+        thread::spawn(move || {
+            let Some((reader, stream_writer)) = connect_with_retry(&endpoint) else {
+                eprintln!(
+                    "[NativeStreamer] Binary IPC endpoint {endpoint} was unreachable; staying on JSON-over-stdio."
+                );
+                return;
+            };
+
+            if let Ok(mut guard) = writer.lock() {
+                *guard = Some(stream_writer);
+            }
+            connected.store(true, Ordering::SeqCst);
+            run_reader_loop(reader, &on_input);
+            connected.store(false, Ordering::SeqCst);
+            if let Ok(mut guard) = writer.lock() {
+                *guard = None;
+            }
+        });
+        true
+    }
+
+    pub fn is_connected(&self) -> bool {
+        self.connected.load(Ordering::SeqCst)
+    }
+
+    /// Sends an event as a binary frame. Returns false (so the caller can fall
+    /// back to stdout JSON) when the channel is not connected or the write
+    /// fails; a failed write also tears the channel down.
+    pub fn send_event(&self, event: &Event) -> bool {
+        if !self.is_connected() {
+            return false;
+        }
+
+        let Ok(body) = serde_json::to_vec(event) else {
+            return false;
+        };
+        self.write_frame(FRAME_TYPE_EVENT, &body)
+    }
+
+    /// Sends a stats event as a fixed-layout binary frame. Returns false when
+    /// the channel is not connected, the stats do not fit the layout, or the
+    /// write fails; callers fall back to the JSON event path.
+    pub fn send_stats(&self, stats: &NativeStatsEvent) -> bool {
+        if !self.is_connected() {
+            return false;
+        }
+
+        let Some(body) = encode_stats_frame(stats) else {
+            return false;
+        };
+        self.write_frame(FRAME_TYPE_STATS, &body)
+    }
+
+    fn write_frame(&self, frame_type: u8, body: &[u8]) -> bool {
+        let Ok(mut guard) = self.writer.lock() else {
+            return false;
+        };
+        let Some(writer) = guard.as_mut() else {
+            return false;
+        };
+
+        let frame_len = (body.len() + 1) as u32;
+        let written = frame_len <= MAX_FRAME_BYTES
+            && writer.write_all(&frame_len.to_le_bytes()).is_ok()
+            && writer.write_all(&[frame_type]).is_ok()
+            && writer.write_all(body).is_ok()
+            && writer.flush().is_ok();
+        if !written {
+            *guard = None;
+            self.connected.store(false, Ordering::SeqCst);
+        }
+        written
+    }
+}
+
+/// Layout version written as the first body byte after the frame type; bump it
+/// whenever the field order or widths below change so the decoder can reject
+/// frames it does not understand instead of misreading them.
+const STATS_FRAME_LAYOUT_VERSION: u8 = 1;
+
+const STATS_FLAG_ZERO_COPY: u16 = 1 << 0;
+const STATS_FLAG_ZERO_COPY_D3D11: u16 = 1 << 1;
+const STATS_FLAG_ZERO_COPY_D3D12: u16 = 1 << 2;
+const STATS_FLAG_HAS_REQUESTED_FPS: u16 = 1 << 3;
+const STATS_FLAG_HAS_SINK_RENDERED: u16 = 1 << 4;
+const STATS_FLAG_HAS_SINK_DROPPED: u16 = 1 << 5;
+const STATS_FLAG_HAS_LAST_TRANSITION_AT_MS: u16 = 1 << 6;
+const STATS_FLAG_HAS_CAPS_FRAMERATE: u16 = 1 << 7;
+const STATS_FLAG_HAS_LAST_TRANSITION_TYPE: u16 = 1 << 8;
+const STATS_FLAG_HAS_LAST_TRANSITION_SUMMARY: u16 = 1 << 9;
+
+/// Encodes `stats` into a `FRAME_TYPE_STATS` body: layout version, presence
+/// flags, the fixed numeric section, then length-prefixed strings. Returns
+/// `None` when a string exceeds the `u16` length prefix, which keeps the frame
+/// parseable; the caller falls back to the JSON event path.
+fn encode_stats_frame(stats: &NativeStatsEvent) -> Option<Vec<u8>> {
+    let mut flags: u16 = 0;
+    if stats.zero_copy {
+        flags |= STATS_FLAG_ZERO_COPY;
+    }
+    if stats.zero_copy_d3d11 {
+        flags |= STATS_FLAG_ZERO_COPY_D3D11;
+    }
+    if stats.zero_copy_d3d12 {
+        flags |= STATS_FLAG_ZERO_COPY_D3D12;
+    }
+    if stats.requested_fps.is_some() {
+        flags |= STATS_FLAG_HAS_REQUESTED_FPS;
+    }
+    if stats.sink_rendered.is_some() {
+        flags |= STATS_FLAG_HAS_SINK_RENDERED;
+    }
+    if stats.sink_dropped.is_some() {
+        flags |= STATS_FLAG_HAS_SINK_DROPPED;
+    }
+    if stats.last_transition_at_ms.is_some() {
+        flags |= STATS_FLAG_HAS_LAST_TRANSITION_AT_MS;
+    }
+    if stats.caps_framerate.is_some() {
+        flags |= STATS_FLAG_HAS_CAPS_FRAMERATE;
+    }
+    if stats.last_transition_type.is_some() {
+        flags |= STATS_FLAG_HAS_LAST_TRANSITION_TYPE;
+    }
+    if stats.last_transition_summary.is_some() {
+        flags |= STATS_FLAG_HAS_LAST_TRANSITION_SUMMARY;
+    }
+
+    let mut body = Vec::with_capacity(256);
+    body.push(STATS_FRAME_LAYOUT_VERSION);
+    body.extend_from_slice(&flags.to_le_bytes());
+    body.extend_from_slice(&stats.bitrate_kbps.to_le_bytes());
+    body.extend_from_slice(&stats.target_bitrate_kbps.to_le_bytes());
+    body.extend_from_slice(&stats.bitrate_performance_percent.to_le_bytes());
+    body.extend_from_slice(&stats.decoded_fps.to_le_bytes());
+    body.extend_from_slice(&stats.render_fps.to_le_bytes());
+    body.extend_from_slice(&stats.frames_decoded.to_le_bytes());
+    body.extend_from_slice(&stats.frames_rendered.to_le_bytes());
+    body.extend_from_slice(&stats.frames_pending_to_present.to_le_bytes());
+    body.extend_from_slice(&stats.sink_rendered.unwrap_or(0).to_le_bytes());
+    body.extend_from_slice(&stats.sink_dropped.unwrap_or(0).to_le_bytes());
+    body.extend_from_slice(&stats.requested_fps.unwrap_or(0).to_le_bytes());
+    body.extend_from_slice(&stats.queue_depth_changes.to_le_bytes());
+    body.extend_from_slice(&stats.present_pacing_changes.to_le_bytes());
+    body.extend_from_slice(&stats.partial_flush_count.to_le_bytes());
+    body.extend_from_slice(&stats.complete_flush_count.to_le_bytes());
+    body.extend_from_slice(&stats.last_transition_at_ms.unwrap_or(0).to_le_bytes());
+
+    let strings: [Option<&str>; 10] = [
+        Some(stats.codec.as_str()),
+        Some(stats.resolution.as_str()),
+        Some(stats.hardware_acceleration.as_str()),
+        Some(stats.memory_mode.as_str()),
+        Some(stats.queue_mode.as_str()),
+        Some(stats.requested_streaming_features_summary.as_str()),
+        Some(stats.finalized_streaming_features_summary.as_str()),
+        stats.caps_framerate.as_deref(),
+        stats.last_transition_type.as_deref(),
+        stats.last_transition_summary.as_deref(),
+    ];
+    for text in strings.into_iter().flatten() {
+        let length = u16::try_from(text.len()).ok()?;
+        body.extend_from_slice(&length.to_le_bytes());
+        body.extend_from_slice(text.as_bytes());
+    }
+
+    Some(body)
+}
+
+#[cfg(unix)]
+fn connect_once(endpoint: &str) -> std::io::Result<(Box<dyn Read + Send>, Box<dyn Write + Send>)> {
+    let stream = std::os::unix::net::UnixStream::connect(endpoint)?;
+    let writer = stream.try_clone()?;
+    Ok((Box::new(stream), Box::new(writer)))
+}
+
+#[cfg(windows)]
+fn connect_once(endpoint: &str) -> std::io::Result<(Box<dyn Read + Send>, Box<dyn Write + Send>)> {
+    // Node's net.Server creates byte-mode named pipes, which open like files.
+    let stream = std::fs::OpenOptions::new()
+        .read(true)
+        .write(true)
+        .open(endpoint)?;
+    let writer = stream.try_clone()?;
+    Ok((Box::new(stream), Box::new(writer)))
+}
+
+#[cfg(not(any(unix, windows)))]
+fn connect_once(_endpoint: &str) -> std::io::Result<(Box<dyn Read + Send>, Box<dyn Write + Send>)> {
+    Err(std::io::Error::new(
+        std::io::ErrorKind::Unsupported,
+        "binary IPC transport is not supported on this platform",
+    ))
+}
+
+fn connect_with_retry(endpoint: &str) -> Option<(Box<dyn Read + Send>, Box<dyn Write + Send>)> {
+    for attempt in 0..CONNECT_ATTEMPTS {
+        match connect_once(endpoint) {
+            Ok(streams) => return Some(streams),
+            Err(_) if attempt + 1 < CONNECT_ATTEMPTS => thread::sleep(CONNECT_RETRY_DELAY),
+            Err(_) => {}
+        }
+    }
+    None
+}
+
+fn run_reader_loop<F>(mut reader: Box<dyn Read + Send>, on_input: &F)
+where
+    F: Fn(BinaryInputFrame),
+{
+    let mut header = [0u8; 4];
+    loop {
+        if reader.read_exact(&mut header).is_err() {
+            return;
+        }
+        let frame_len = u32::from_le_bytes(header);
+        if frame_len == 0 || frame_len > MAX_FRAME_BYTES {
+            return;
+        }
+
+        let mut body = vec![0u8; frame_len as usize];
+        if reader.read_exact(&mut body).is_err() {
+            return;
+        }
+
+        if body[0] == FRAME_TYPE_INPUT && body.len() >= 2 {
+            let partially_reliable = body[1] & 1 != 0;
+            body.drain(..2);
+            on_input(BinaryInputFrame {
+                payload: body,
+                partially_reliable,
+            });
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use std::sync::mpsc;
+
+    #[test]
+    fn reader_loop_decodes_input_frames() {
+        let payload = [7u8, 8, 9];
+        let mut stream = Vec::new();
+        stream.extend_from_slice(&(2u32 + payload.len() as u32).to_le_bytes());
+        stream.push(FRAME_TYPE_INPUT);
+        stream.push(1);
+        stream.extend_from_slice(&payload);
+
+        let (sender, receiver) = mpsc::channel();
+        run_reader_loop(Box::new(std::io::Cursor::new(stream)), &move |frame| {
+            let _ = sender.send(frame);
+        });
+
+        let frame = receiver.try_recv().expect("one input frame");
+        assert_eq!(frame.payload, payload);
+        assert!(frame.partially_reliable);
+    }
+
+    #[test]
+    fn reader_loop_stops_on_oversized_frame() {
+        let mut stream = Vec::new();
+        stream.extend_from_slice(&(MAX_FRAME_BYTES + 1).to_le_bytes());
+        stream.push(FRAME_TYPE_INPUT);
+
+        let (sender, receiver) = mpsc::channel();
+        run_reader_loop(Box::new(std::io::Cursor::new(stream)), &move |frame| {
+            let _ = sender.send(frame);
+        });
+
+        assert!(receiver.try_recv().is_err());
+    }
+
+    #[test]
+    fn send_event_requires_a_connection() {
+        let transport = BinaryTransport::default();
+        assert!(!transport.send_event(&Event::Status {
+            status: "ready",
+            message: None,
+        }));
+    }
+
+    fn sample_stats() -> NativeStatsEvent {
+        NativeStatsEvent {
+            codec: "H265".to_owned(),
+            resolution: "2560x1440".to_owned(),
+            hardware_acceleration: "NVDEC".to_owned(),
+            requested_fps: Some(120),
+            caps_framerate: Some("120/1".to_owned()),
+            bitrate_kbps: 42_000,
+            target_bitrate_kbps: 50_000,
+            bitrate_performance_percent: 84.0,
+            decoded_fps: 119.5,
+            render_fps: 119.0,
+            frames_decoded: 7_200,
+            frames_rendered: 7_180,
+            frames_pending_to_present: 2,
+            sink_rendered: Some(7_175),
+            sink_dropped: Some(5),
+            memory_mode: "D3D11Memory".to_owned(),
+            zero_copy: true,
+            queue_mode: "adaptive".to_owned(),
+            queue_depth_changes: 3,
+            present_pacing_changes: 1,
+            partial_flush_count: 0,
+            complete_flush_count: 0,
+            last_transition_type: None,
+            last_transition_at_ms: None,
+            last_transition_summary: None,
+            requested_streaming_features_summary: "fps=120".to_owned(),
+            finalized_streaming_features_summary: "fps=120".to_owned(),
+            zero_copy_d3d11: true,
+            zero_copy_d3d12: false,
+        }
+    }
+
+    #[test]
+    fn stats_frame_encodes_the_fixed_layout() {
+        let stats = sample_stats();
+        let body = encode_stats_frame(&stats).expect("stats fit the frame layout");
+
+        assert_eq!(body[0], STATS_FRAME_LAYOUT_VERSION);
+        let flags = u16::from_le_bytes([body[1], body[2]]);
+        assert_ne!(flags & STATS_FLAG_ZERO_COPY, 0);
+        assert_ne!(flags & STATS_FLAG_ZERO_COPY_D3D11, 0);
+        assert_eq!(flags & STATS_FLAG_ZERO_COPY_D3D12, 0);
+        assert_ne!(flags & STATS_FLAG_HAS_REQUESTED_FPS, 0);
+        assert_ne!(flags & STATS_FLAG_HAS_CAPS_FRAMERATE, 0);
+        assert_eq!(flags & STATS_FLAG_HAS_LAST_TRANSITION_SUMMARY, 0);
+
+        let u32_at = |offset: usize| {
+            u32::from_le_bytes(body[offset..offset + 4].try_into().expect("u32 field"))
+        };
+        let u64_at = |offset: usize| {
+            u64::from_le_bytes(body[offset..offset + 8].try_into().expect("u64 field"))
+        };
+        let f64_at = |offset: usize| {
+            f64::from_le_bytes(body[offset..offset + 8].try_into().expect("f64 field"))
+        };
+
+        assert_eq!(u32_at(3), stats.bitrate_kbps);
+        assert_eq!(u32_at(7), stats.target_bitrate_kbps);
+        assert_eq!(f64_at(11), stats.bitrate_performance_percent);
+        assert_eq!(f64_at(19), stats.decoded_fps);
+        assert_eq!(f64_at(27), stats.render_fps);
+        assert_eq!(u64_at(35), stats.frames_decoded);
+        assert_eq!(u64_at(43), stats.frames_rendered);
+        assert_eq!(u64_at(51), stats.frames_pending_to_present);
+        assert_eq!(u64_at(59), stats.sink_rendered.unwrap());
+        assert_eq!(u64_at(67), stats.sink_dropped.unwrap());
+        assert_eq!(u32_at(75), stats.requested_fps.unwrap());
+        assert_eq!(u32_at(79), stats.queue_depth_changes);
+        assert_eq!(u32_at(83), stats.present_pacing_changes);
+        assert_eq!(u32_at(87), stats.partial_flush_count);
+        assert_eq!(u32_at(91), stats.complete_flush_count);
+        assert_eq!(u64_at(95), 0);
+
+        // Strings follow the numeric section: u16 length, then UTF-8 bytes.
+        let mut offset = 103;
+        let mut decoded = Vec::new();
+        while offset < body.len() {
+            let length =
+                u16::from_le_bytes(body[offset..offset + 2].try_into().expect("length")) as usize;
+            offset += 2;
+            decoded.push(std::str::from_utf8(&body[offset..offset + length]).expect("utf8"));
+            offset += length;
+        }
+        assert_eq!(
+            decoded,
+            ["H265", "2560x1440", "NVDEC", "D3D11Memory", "adaptive", "fps=120", "fps=120", "120/1"],
+        );
+    }
+
+    #[test]
+    fn stats_frame_rejects_strings_longer_than_the_length_prefix() {
+        let mut stats = sample_stats();
+        stats.last_transition_summary = Some("x".repeat(usize::from(u16::MAX) + 1));
+        assert!(encode_stats_frame(&stats).is_none());
+    }
+
+    #[test]
+    fn send_stats_requires_a_connection() {
+        let transport = BinaryTransport::default();
+        assert!(!transport.send_stats(&sample_stats()));
+    }
+}
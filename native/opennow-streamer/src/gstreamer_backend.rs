@@ -6,17 +6,22 @@ use crate::gstreamer_config::{
     resolve_d3d_fullscreen_sink, resolve_present_max_fps, NATIVE_D3D_FULLSCREEN_ENV,
     NATIVE_PRESENT_MAX_FPS_ENV, PRESENT_LIMITER_AUTO_SENTINEL,
 };
+use crate::gstreamer_benchmark::run_decoder_benchmark;
+use crate::gstreamer_capabilities::cached_video_backend_capabilities;
 use crate::gstreamer_platform::{clear_native_shortcut_bindings, set_native_shortcut_bindings};
-use crate::gstreamer_pipeline::{
-    current_platform_label, init_gstreamer, native_video_backend_capabilities, GstreamerPipeline,
-};
+use crate::gstreamer_pipeline::{current_platform_label, init_gstreamer, GstreamerPipeline};
 use crate::protocol::{
     missing_field, CommandEnvelope, Event, IceCandidatePayload, NativeRenderSurface,
     NativeStreamerCapabilities, NativeStreamerSessionContext, NativeVideoBackendCapability,
     Response, SendAnswerRequest, PROTOCOL_VERSION,
 };
-use crate::sdp::{build_nvst_sdp_for_answer, extract_negotiated_video_codec, munge_answer_sdp};
+use crate::sdp::{
+    build_nvst_sdp_for_answer, extract_negotiated_video_codec, munge_answer_sdp,
+    parse_input_redundancy,
+};
 use std::sync::mpsc::Sender;
+use std::sync::{Arc, Mutex};
+use std::thread;
 
 pub(crate) fn send_log(event_sender: &Option<Sender<Event>>, level: &'static str, message: String) {
     if let Some(event_sender) = event_sender {
@@ -31,6 +36,11 @@ pub struct GstreamerBackend {
     active_context: Option<NativeStreamerSessionContext>,
     pending_remote_ice: Vec<IceCandidatePayload>,
     pipeline: Option<GstreamerPipeline>,
+    /// Pre-built webrtcbin skeleton kept in Ready for the next `start`, so a
+    /// reconnect after a stream drop attaches transport to a warm pipeline
+    /// instead of rebuilding one from scratch. Filled off the command loop by
+    /// [`Self::spawn_standby_prewarm`].
+    standby_pipeline: Arc<Mutex<Option<GstreamerPipeline>>>,
     event_sender: Option<Sender<Event>>,
     remote_description_set: bool,
     render_surface: Option<NativeRenderSurface>,
@@ -42,12 +52,56 @@ impl GstreamerBackend {
             active_context: None,
             pending_remote_ice: Vec::new(),
             pipeline: None,
+            standby_pipeline: Arc::new(Mutex::new(None)),
             event_sender,
             remote_description_set: false,
             render_surface: None,
         }
     }
 
+    /// Builds the next pipeline skeleton on a worker thread. Element factory
+    /// lookup, webrtcbin construction, and the Null→Ready transition are the
+    /// bulk of cold reconnect time, and none of it depends on the session, so
+    /// it can all happen while the current stream is running. Best effort: if
+    /// the prewarm fails the next `start` simply builds cold.
+    fn spawn_standby_prewarm(&self) {
+        let slot = Arc::clone(&self.standby_pipeline);
+        let event_sender = self.event_sender.clone();
+        thread::spawn(move || {
+            if slot.lock().map(|slot| slot.is_some()).unwrap_or(true) {
+                return;
+            }
+            match GstreamerPipeline::build(event_sender.clone()) {
+                Ok(pipeline) => {
+                    let leftover = match slot.lock() {
+                        Ok(mut slot) => {
+                            if slot.is_none() {
+                                *slot = Some(pipeline);
+                                None
+                            } else {
+                                Some(pipeline)
+                            }
+                        }
+                        Err(_) => Some(pipeline),
+                    };
+                    // Lost a race with another prewarm; tear the spare down.
+                    if let Some(spare) = leftover {
+                        if let Err(message) = spare.stop() {
+                            eprintln!("[NativeStreamer] {message}");
+                        }
+                    }
+                }
+                Err(message) => send_log(
+                    &event_sender,
+                    "warn",
+                    format!(
+                        "Warm standby pipeline prewarm failed; the next session will build cold: {message}"
+                    ),
+                ),
+            }
+        });
+    }
+
     fn replay_pending_remote_ice(&mut self) -> Vec<Event> {
         let candidates = std::mem::take(&mut self.pending_remote_ice);
         let Some(pipeline) = self.pipeline.as_mut() else {
@@ -80,7 +134,7 @@ impl NativeStreamerBackend for GstreamerBackend {
             supports_local_ice: true,
             supports_input: true,
             video_backends: match init_gstreamer() {
-                Ok(()) => native_video_backend_capabilities(),
+                Ok(()) => cached_video_backend_capabilities(),
                 Err(error) => vec![NativeVideoBackendCapability {
                     backend: "gstreamer".to_owned(),
                     platform: current_platform_label().to_owned(),
@@ -101,22 +155,31 @@ impl NativeStreamerBackend for GstreamerBackend {
         };
 
         let session_id = context.session.session_id.clone();
-        let pipeline = match GstreamerPipeline::build(self.event_sender.clone()) {
-            Ok(pipeline) => pipeline,
-            Err(message) => {
-                return BackendReply {
-                    events: vec![Event::Error {
-                        code: "gstreamer-start-failed".to_owned(),
-                        message: message.clone(),
-                    }],
-                    response: Some(Response::Error {
-                        id: Some(id),
-                        code: "gstreamer-start-failed".to_owned(),
-                        message,
-                    }),
-                    should_continue: true,
-                };
-            }
+        let standby = self
+            .standby_pipeline
+            .lock()
+            .ok()
+            .and_then(|mut slot| slot.take());
+        let warm_attach = standby.is_some();
+        let pipeline = match standby {
+            Some(pipeline) => pipeline,
+            None => match GstreamerPipeline::build(self.event_sender.clone()) {
+                Ok(pipeline) => pipeline,
+                Err(message) => {
+                    return BackendReply {
+                        events: vec![Event::Error {
+                            code: "gstreamer-start-failed".to_owned(),
+                            message: message.clone(),
+                        }],
+                        response: Some(Response::Error {
+                            id: Some(id),
+                            code: "gstreamer-start-failed".to_owned(),
+                            message,
+                        }),
+                        should_continue: true,
+                    };
+                }
+            },
         };
 
         if let Some(old_pipeline) = self.pipeline.take() {
@@ -136,15 +199,26 @@ impl NativeStreamerBackend for GstreamerBackend {
         {
             pipeline.update_render_surface(surface);
         }
+        self.spawn_standby_prewarm();
+
+        let mut events = Vec::new();
+        if warm_attach {
+            events.push(Event::Log {
+                level: "info",
+                message: "Attached warm standby pipeline; cold pipeline construction was skipped."
+                    .to_owned(),
+            });
+        }
+        events.push(Event::Status {
+            status: "ready",
+            message: Some(format!(
+                "GStreamer backend selected for session {session_id}; {} pipeline is ready.",
+                webrtc_name
+            )),
+        });
 
         BackendReply {
-            events: vec![Event::Status {
-                status: "ready",
-                message: Some(format!(
-                    "GStreamer backend selected for session {session_id}; {} pipeline is ready.",
-                    webrtc_name
-                )),
-            }],
+            events,
             response: Some(Response::Ok { id }),
             should_continue: true,
         }
@@ -198,6 +272,16 @@ impl NativeStreamerBackend for GstreamerBackend {
         pipeline.set_present_max_fps(present_max_fps);
         pipeline.set_d3d_fullscreen_sink(d3d_fullscreen_sink);
         pipeline.configure_stats(&context, prepared.nvst_params.max_bitrate_kbps);
+        let input_redundancy = parse_input_redundancy(&offer_sdp);
+        pipeline.set_input_redundancy(input_redundancy);
+        if input_redundancy > 0 {
+            events.push(Event::Log {
+                level: "info",
+                message: format!(
+                    "Partially reliable input redundancy enabled: each gamepad packet repeats the previous {input_redundancy} state(s)."
+                ),
+            });
+        }
         if present_max_fps > 0 && present_max_fps != PRESENT_LIMITER_AUTO_SENTINEL {
             events.push(Event::Log {
                 level: "info",
@@ -216,6 +300,7 @@ impl NativeStreamerBackend for GstreamerBackend {
             });
         }
 
+        let negotiation_started = std::time::Instant::now();
         let answer_sdp = match pipeline.negotiate_answer(
             parsed_offer,
             (prepared.gstreamer_ice_pwd_replacements > 0)
@@ -240,9 +325,10 @@ impl NativeStreamerBackend for GstreamerBackend {
 
         events.push(Event::Log {
             level: "info",
-            message:
-                "GStreamer created a local WebRTC answer and replayed queued remote ICE candidates."
-                    .to_owned(),
+            message: format!(
+                "GStreamer created a local WebRTC answer in {} ms and replayed queued remote ICE candidates; local candidates keep trickling while media starts.",
+                negotiation_started.elapsed().as_millis()
+            ),
         });
 
         if let Some(negotiated_codec) = extract_negotiated_video_codec(&answer_sdp) {
@@ -387,11 +473,65 @@ impl NativeStreamerBackend for GstreamerBackend {
         BackendReply::response(Response::Ok { id: command.id })
     }
 
+    fn benchmark_decoders(&mut self, command: CommandEnvelope) -> BackendReply {
+        if let Err(message) = init_gstreamer() {
+            return BackendReply::response(Response::Error {
+                id: Some(command.id),
+                code: "gstreamer-init-failed".to_owned(),
+                message,
+            });
+        }
+
+        let results = match run_decoder_benchmark() {
+            Ok(results) => results,
+            Err(message) => {
+                return BackendReply::response(Response::Error {
+                    id: Some(command.id),
+                    code: "benchmark-failed".to_owned(),
+                    message,
+                });
+            }
+        };
+
+        let mut events = Vec::with_capacity(results.len() + 1);
+        for result in &results {
+            events.push(Event::Log {
+                level: "info",
+                message: format!(
+                    "Decoder benchmark: {} {} decoded {:.0} fps ({:.2} ms/frame).",
+                    result.codec, result.factory, result.throughput_fps, result.avg_frame_ms
+                ),
+            });
+        }
+        events.push(Event::Log {
+            level: "info",
+            message: format!(
+                "Persisted decoder ranking for {} measurement(s); future streams pick the fastest decoder first.",
+                results.len()
+            ),
+        });
+        BackendReply {
+            events,
+            response: Some(Response::Ok { id: command.id }),
+            should_continue: true,
+        }
+    }
+
     fn stop(&mut self, command: CommandEnvelope) -> BackendReply {
         self.active_context = None;
         self.pending_remote_ice.clear();
         self.remote_description_set = false;
         clear_native_shortcut_bindings();
+        if let Some(standby) = self
+            .standby_pipeline
+            .lock()
+            .ok()
+            .and_then(|mut slot| slot.take())
+        {
+            if let Err(message) = standby.stop() {
+                eprintln!("[NativeStreamer] {message}");
+            }
+        }
         if let Some(pipeline) = self.pipeline.take() {
             if let Err(message) = pipeline.stop() {
                 return BackendReply {
@@ -421,7 +561,8 @@ mod tests {
     use crate::gstreamer_config::{automatic_present_max_fps, PRESENT_LIMITER_AUTO_SENTINEL};
     use crate::gstreamer_input::parse_input_handshake_version;
     use crate::gstreamer_liveness::{
-        caps_framerate_summary, sink_stats_summary, VideoStallAction, VideoStallTracker,
+        caps_framerate_summary, sink_stats_summary, LivenessPollPacer, VideoStallAction,
+        VideoStallTracker,
     };
     use crate::gstreamer_pipeline::{
         configure_stats_overlay_element, effective_present_max_fps, format_video_chain_selection,
@@ -804,6 +945,60 @@ mod tests {
         );
     }
 
+    #[test]
+    fn liveness_poll_pacer_relaxes_after_sustained_health() {
+        let mut pacer = LivenessPollPacer::default();
+
+        assert_eq!(
+            pacer.next_interval(0, true),
+            std::time::Duration::from_millis(250),
+        );
+        assert_eq!(
+            pacer.next_interval(15_000, true),
+            std::time::Duration::from_millis(250),
+        );
+        assert_eq!(
+            pacer.next_interval(30_000, true),
+            std::time::Duration::from_millis(1_000),
+        );
+    }
+
+    #[test]
+    fn liveness_poll_pacer_snaps_tight_on_trouble_and_holds_off() {
+        let mut pacer = LivenessPollPacer::default();
+
+        assert_eq!(
+            pacer.next_interval(0, true),
+            std::time::Duration::from_millis(250),
+        );
+        assert_eq!(
+            pacer.next_interval(30_000, true),
+            std::time::Duration::from_millis(1_000),
+        );
+        assert_eq!(
+            pacer.next_interval(31_000, false),
+            std::time::Duration::from_millis(250),
+        );
+        // The hold-off pins the tight interval even once healthy again, and
+        // the healthy window only restarts after the hold-off expires.
+        assert_eq!(
+            pacer.next_interval(35_000, true),
+            std::time::Duration::from_millis(250),
+        );
+        assert_eq!(
+            pacer.next_interval(41_000, true),
+            std::time::Duration::from_millis(250),
+        );
+        assert_eq!(
+            pacer.next_interval(70_000, true),
+            std::time::Duration::from_millis(250),
+        );
+        assert_eq!(
+            pacer.next_interval(71_000, true),
+            std::time::Duration::from_millis(1_000),
+        );
+    }
+
     #[test]
     fn resolve_queue_mode_prefers_adaptive_for_240_fps_and_vrr_for_cloud_gsync() {
         let adaptive = resolve_queue_mode(&StreamSettings {
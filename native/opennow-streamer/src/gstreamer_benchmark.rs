@@ -0,0 +1,382 @@
+//! One-shot decoder benchmark that ranks the available video decoders on the
+//! current machine.
+//!
+//! The static preference tables in `gstreamer_pipeline.rs` encode a sensible
+//! default order per `RtpVideoApi`, but the fastest decoder is ultimately a
+//! property of the installed driver stack — some Intel boxes decode AV1
+//! faster through VAAPI than the listed default. The `benchmark-decoders`
+//! command synthesizes a short encoded sample per codec (canned samples are
+//! generated with whatever encoder the registry offers; there are no shipped
+//! media assets), times every available decoder over it with a
+//! `filesrc ! parse ! decode ! fakesink` pipeline, and persists the ranking
+//! next to the capability cache. `select_decoder_factory` consults that
+//! ranking on every chain build, so one ~10 second benchmark permanently
+//! reorders decoder picks for this machine. The same plugin/GPU fingerprint
+//! that guards the capability cache invalidates a stale ranking.
+
+use crate::gstreamer_capabilities::{capability_fingerprint, streamer_cache_path};
+use crate::gstreamer_pipeline::{
+    decoder_benchmark_candidates, make_element, rtp_video_parser_factory,
+    set_property_from_str_if_supported, set_property_if_supported,
+};
+use gst::prelude::*;
+use gstreamer as gst;
+use serde::{Deserialize, Serialize};
+use std::fs;
+use std::path::PathBuf;
+use std::sync::Mutex;
+use std::time::{Duration, Instant};
+
+const RANKING_VERSION: u32 = 1;
+const RANKING_FILE: &str = "decoder-ranking.json";
+
+/// Sample shape: long enough to amortize pipeline startup, short enough to
+/// keep the whole multi-codec run inside the benchmark budget.
+const SAMPLE_FRAMES: u32 = 600;
+const SAMPLE_CAPS: &str = "video/x-raw,format=I420,width=1280,height=720,framerate=60/1";
+
+/// Overall wall-clock budget; no new measurement starts once it is spent.
+const BENCHMARK_BUDGET: Duration = Duration::from_secs(10);
+/// Per-pipeline ceiling so one wedged decoder cannot eat the whole budget.
+const PIPELINE_TIMEOUT: Duration = Duration::from_secs(5);
+
+const BENCHMARK_CODECS: &[&str] = &["H264", "H265", "AV1"];
+
+#[derive(Debug, Clone, Serialize, Deserialize)]
+#[serde(rename_all = "camelCase")]
+pub(crate) struct DecoderBenchmarkResult {
+    pub(crate) codec: String,
+    pub(crate) factory: String,
+    pub(crate) throughput_fps: f64,
+    pub(crate) avg_frame_ms: f64,
+}
+
+#[derive(Debug, Serialize, Deserialize)]
+struct DecoderRankingDocument {
+    version: u32,
+    fingerprint: String,
+    results: Vec<DecoderBenchmarkResult>,
+}
+
+// Outer None: not loaded from disk yet. Inner None: no usable ranking for
+// this machine (absent file, stale fingerprint), so the static order stands.
+static CACHED_RANKING: Mutex<Option<Option<Vec<DecoderBenchmarkResult>>>> = Mutex::new(None);
+
+/// Reorders decoder candidates by the persisted per-machine ranking, fastest
+/// first. Candidates without a measurement keep their static relative order
+/// behind the measured ones, so an unbenchmarked machine behaves exactly as
+/// before.
+pub(crate) fn rank_decoder_candidates(
+    codec: &str,
+    candidates: Vec<&'static str>,
+) -> Vec<&'static str> {
+    let Some(ranking) = load_ranking() else {
+        return candidates;
+    };
+    order_by_ranking(&ranking, codec, candidates)
+}
+
+fn order_by_ranking(
+    ranking: &[DecoderBenchmarkResult],
+    codec: &str,
+    candidates: Vec<&'static str>,
+) -> Vec<&'static str> {
+    let mut measured: Vec<(&'static str, f64)> = Vec::new();
+    let mut unmeasured: Vec<&'static str> = Vec::new();
+    for factory in candidates {
+        match ranking
+            .iter()
+            .find(|result| result.codec == codec && result.factory == factory)
+        {
+            Some(result) => measured.push((factory, result.throughput_fps)),
+            None => unmeasured.push(factory),
+        }
+    }
+    measured.sort_by(|a, b| b.1.total_cmp(&a.1));
+    measured
+        .into_iter()
+        .map(|(factory, _)| factory)
+        .chain(unmeasured)
+        .collect()
+}
+
+fn load_ranking() -> Option<Vec<DecoderBenchmarkResult>> {
+    let mut cached = CACHED_RANKING.lock().ok()?;
+    if let Some(loaded) = cached.as_ref() {
+        return loaded.clone();
+    }
+    let loaded = load_ranking_from_disk();
+    *cached = Some(loaded.clone());
+    loaded
+}
+
+fn load_ranking_from_disk() -> Option<Vec<DecoderBenchmarkResult>> {
+    let path = streamer_cache_path(RANKING_FILE)?;
+    let contents = fs::read_to_string(path).ok()?;
+    let document: DecoderRankingDocument = serde_json::from_str(&contents).ok()?;
+    if document.version != RANKING_VERSION || document.fingerprint != capability_fingerprint() {
+        return None;
+    }
+    Some(document.results)
+}
+
+fn store_ranking(results: &[DecoderBenchmarkResult]) {
+    let Some(path) = streamer_cache_path(RANKING_FILE) else {
+        return;
+    };
+    let document = DecoderRankingDocument {
+        version: RANKING_VERSION,
+        fingerprint: capability_fingerprint(),
+        results: results.to_vec(),
+    };
+    let Ok(serialized) = serde_json::to_string(&document) else {
+        return;
+    };
+    if let Some(parent) = path.parent() {
+        if fs::create_dir_all(parent).is_err() {
+            return;
+        }
+    }
+    let staging = path.with_extension("json.tmp");
+    if fs::write(&staging, serialized).is_ok() {
+        let _ = fs::rename(&staging, &path);
+    }
+
+    if let Ok(mut cached) = CACHED_RANKING.lock() {
+        *cached = Some(Some(results.to_vec()));
+    }
+}
+
+/// Runs the full benchmark: synthesizes one encoded sample per codec, times
+/// every available decoder over it, persists the ranking, and returns the
+/// measurements sorted fastest-first per codec. Errors only when nothing at
+/// all could be measured; individual codec or decoder failures are skipped.
+pub(crate) fn run_decoder_benchmark() -> Result<Vec<DecoderBenchmarkResult>, String> {
+    let started = Instant::now();
+    let mut results = Vec::new();
+    let mut sample_paths = Vec::new();
+
+    for codec in BENCHMARK_CODECS {
+        if started.elapsed() >= BENCHMARK_BUDGET {
+            break;
+        }
+        let candidates: Vec<&'static str> = decoder_benchmark_candidates(codec)
+            .into_iter()
+            .filter(|factory| gst::ElementFactory::find(factory).is_some())
+            .collect();
+        if candidates.len() < 2 {
+            // With zero or one usable decoder there is nothing to rank.
+            continue;
+        }
+        let sample_path = match synthesize_sample(codec) {
+            Ok(path) => path,
+            Err(_) => continue,
+        };
+        sample_paths.push(sample_path.clone());
+
+        for factory in candidates {
+            if started.elapsed() >= BENCHMARK_BUDGET {
+                break;
+            }
+            if let Ok(result) = measure_decoder(codec, factory, &sample_path) {
+                results.push(result);
+            }
+        }
+    }
+
+    for path in sample_paths {
+        let _ = fs::remove_file(path);
+    }
+
+    if results.is_empty() {
+        return Err(
+            "No decoder could be benchmarked: no codec had both an encoder to synthesize a sample and at least two decoders to rank."
+                .to_owned(),
+        );
+    }
+
+    results.sort_by(|a, b| {
+        a.codec
+            .cmp(&b.codec)
+            .then(b.throughput_fps.total_cmp(&a.throughput_fps))
+    });
+    store_ranking(&results);
+    Ok(results)
+}
+
+fn sample_encoder_factories(codec: &str) -> &'static [&'static str] {
+    match codec {
+        "H264" => &["x264enc", "openh264enc", "vah264enc"],
+        "H265" | "HEVC" => &["x265enc", "vah265enc"],
+        "AV1" => &["svtav1enc", "rav1enc", "av1enc", "vaav1enc"],
+        _ => &[],
+    }
+}
+
+fn sample_path_for(codec: &str) -> PathBuf {
+    std::env::temp_dir().join(format!(
+        "opennow-decoder-bench-{}.bin",
+        codec.to_ascii_lowercase()
+    ))
+}
+
+/// Encodes `SAMPLE_FRAMES` of test video into a parsed elementary stream on
+/// disk. Encode time is excluded from the decoder measurements because the
+/// sample is produced once per codec, before any decoder runs.
+fn synthesize_sample(codec: &str) -> Result<PathBuf, String> {
+    let parser_factory = rtp_video_parser_factory(codec)
+        .ok_or_else(|| format!("No parser is mapped for codec {codec}."))?;
+    let encoder_factory = sample_encoder_factories(codec)
+        .iter()
+        .copied()
+        .find(|factory| gst::ElementFactory::find(factory).is_some())
+        .ok_or_else(|| format!("No encoder is available to synthesize a {codec} sample."))?;
+
+    let path = sample_path_for(codec);
+    let pipeline = gst::Pipeline::new();
+
+    let source = make_element("videotestsrc")?;
+    source.set_property("num-buffers", SAMPLE_FRAMES as i32);
+    let capsfilter = make_element("capsfilter")?;
+    capsfilter.set_property(
+        "caps",
+        SAMPLE_CAPS
+            .parse::<gst::Caps>()
+            .map_err(|error| format!("Invalid benchmark sample caps: {error}"))?,
+    );
+    let convert = make_element("videoconvert")?;
+    let encoder = make_element(encoder_factory)?;
+    // Favor encode speed over quality; the content only has to be decodable.
+    set_property_from_str_if_supported(&encoder, "speed-preset", "ultrafast");
+    set_property_from_str_if_supported(&encoder, "tune", "zerolatency");
+    set_property_if_supported(&encoder, "preset", 12i32);
+    let parser = make_element(parser_factory)?;
+    let sink = make_element("filesink")?;
+    sink.set_property("location", path.to_string_lossy().as_ref());
+
+    let elements = [source, capsfilter, convert, encoder, parser, sink];
+    assemble_chain(&pipeline, &elements, &format!("{codec} sample encode"))?;
+
+    run_to_eos(&pipeline, PIPELINE_TIMEOUT)
+        .map_err(|error| format!("Encoding the {codec} sample failed: {error}"))?;
+    Ok(path)
+}
+
+/// Times one decoder over the canned sample with a minimal
+/// `filesrc ! parse ! decode ! fakesink` chain. `sync=false` keeps the sink
+/// from pacing to the clock, so elapsed wall time measures decode throughput.
+fn measure_decoder(
+    codec: &str,
+    factory: &'static str,
+    sample_path: &PathBuf,
+) -> Result<DecoderBenchmarkResult, String> {
+    let parser_factory = rtp_video_parser_factory(codec)
+        .ok_or_else(|| format!("No parser is mapped for codec {codec}."))?;
+
+    let pipeline = gst::Pipeline::new();
+    let source = make_element("filesrc")?;
+    source.set_property("location", sample_path.to_string_lossy().as_ref());
+    let parser = make_element(parser_factory)?;
+    let decoder = make_element(factory)?;
+    let sink = make_element("fakesink")?;
+    set_property_if_supported(&sink, "sync", false);
+
+    let elements = [source, parser, decoder, sink];
+    assemble_chain(&pipeline, &elements, &format!("{factory} decode benchmark"))?;
+
+    let started = Instant::now();
+    run_to_eos(&pipeline, PIPELINE_TIMEOUT)?;
+    let elapsed = started.elapsed().as_secs_f64().max(0.001);
+
+    Ok(DecoderBenchmarkResult {
+        codec: (*codec).to_owned(),
+        factory: factory.to_owned(),
+        throughput_fps: f64::from(SAMPLE_FRAMES) / elapsed,
+        avg_frame_ms: elapsed * 1000.0 / f64::from(SAMPLE_FRAMES),
+    })
+}
+
+fn assemble_chain(
+    pipeline: &gst::Pipeline,
+    elements: &[gst::Element],
+    label: &str,
+) -> Result<(), String> {
+    for element in elements {
+        pipeline
+            .add(element)
+            .map_err(|error| format!("Failed to assemble {label} pipeline: {error}"))?;
+    }
+    for pair in elements.windows(2) {
+        pair[0]
+            .link(&pair[1])
+            .map_err(|error| format!("Failed to link {label} pipeline: {error:?}"))?;
+    }
+    Ok(())
+}
+
+fn run_to_eos(pipeline: &gst::Pipeline, timeout: Duration) -> Result<(), String> {
+    pipeline
+        .set_state(gst::State::Playing)
+        .map_err(|error| format!("Failed to start benchmark pipeline: {error}"))?;
+
+    let bus = pipeline.bus();
+    let outcome = bus
+        .as_ref()
+        .and_then(|bus| {
+            bus.timed_pop_filtered(
+                gst::ClockTime::from_mseconds(timeout.as_millis() as u64),
+                &[gst::MessageType::Eos, gst::MessageType::Error],
+            )
+        })
+        .map(|message| match message.view() {
+            gst::MessageView::Eos(_) => Ok(()),
+            gst::MessageView::Error(error) => Err(format!("{}", error.error())),
+            _ => Err("Unexpected bus message.".to_owned()),
+        })
+        .unwrap_or_else(|| Err("Benchmark pipeline timed out before EOS.".to_owned()));
+
+    let _ = pipeline.set_state(gst::State::Null);
+    outcome
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn result(codec: &str, factory: &str, throughput_fps: f64) -> DecoderBenchmarkResult {
+        DecoderBenchmarkResult {
+            codec: codec.to_owned(),
+            factory: factory.to_owned(),
+            throughput_fps,
+            avg_frame_ms: 1000.0 / throughput_fps,
+        }
+    }
+
+    #[test]
+    fn ranked_candidates_sort_fastest_measured_first() {
+        let ranking = vec![
+            result("H264", "avdec_h264", 410.0),
+            result("H264", "vah264dec", 880.0),
+        ];
+        let ordered = order_by_ranking(&ranking, "H264", vec!["avdec_h264", "vah264dec"]);
+        assert_eq!(ordered, vec!["vah264dec", "avdec_h264"]);
+    }
+
+    #[test]
+    fn unmeasured_candidates_keep_their_static_order_behind_measured_ones() {
+        let ranking = vec![result("H264", "vah264dec", 880.0)];
+        let ordered = order_by_ranking(
+            &ranking,
+            "H264",
+            vec!["d3d11h264dec", "avdec_h264", "vah264dec"],
+        );
+        assert_eq!(ordered, vec!["vah264dec", "d3d11h264dec", "avdec_h264"]);
+    }
+
+    #[test]
+    fn ranking_for_another_codec_does_not_reorder() {
+        let ranking = vec![result("AV1", "dav1ddec", 500.0)];
+        let ordered = order_by_ranking(&ranking, "H264", vec!["avdec_h264", "vah264dec"]);
+        assert_eq!(ordered, vec!["avdec_h264", "vah264dec"]);
+    }
+}
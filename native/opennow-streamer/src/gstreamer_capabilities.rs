@@ -0,0 +1,151 @@
+use crate::gstreamer_config::resolve_capability_cache_enabled;
+use crate::gstreamer_pipeline::{current_platform_label, native_video_backend_capabilities};
+use crate::protocol::NativeVideoBackendCapability;
+use gstreamer as gst;
+use serde::{Deserialize, Serialize};
+use std::fs;
+use std::path::PathBuf;
+
+const CAPABILITY_CACHE_VERSION: u32 = 1;
+const CAPABILITY_CACHE_FILE: &str = "decoder-capabilities.json";
+
+// Plugins whose presence or version changes the outcome of decoder probing.
+// Any version bump (driver update, GStreamer upgrade) invalidates the cache.
+const CAPABILITY_FINGERPRINT_PLUGINS: &[&str] = &[
+    "d3d12",
+    "d3d11",
+    "applemedia",
+    "va",
+    "vaapi",
+    "video4linux2",
+    "vulkan",
+    "libav",
+    "openh264",
+    "videoparsersbad",
+];
+
+#[derive(Debug, Serialize, Deserialize)]
+struct CapabilityCacheDocument {
+    version: u32,
+    fingerprint: String,
+    backends: Vec<NativeVideoBackendCapability>,
+}
+
+/// Returns the decoder capability matrix, serving it from the on-disk cache
+/// when the environment fingerprint still matches. Probing every backend and
+/// codec walks the GStreamer registry and can take several hundred
+/// milliseconds on a cold start; the fingerprint ties cached results to the
+/// exact plugin versions and GPU so stale entries are re-probed, never trusted.
+pub(crate) fn cached_video_backend_capabilities() -> Vec<NativeVideoBackendCapability> {
+    if !resolve_capability_cache_enabled() {
+        return native_video_backend_capabilities();
+    }
+    let fingerprint = capability_fingerprint();
+    if let Some(backends) = load_cached_backends(&fingerprint) {
+        return backends;
+    }
+    let backends = native_video_backend_capabilities();
+    store_cached_backends(&fingerprint, &backends);
+    backends
+}
+
+pub(crate) fn capability_fingerprint() -> String {
+    let registry = gst::Registry::get();
+    let mut parts = vec![
+        format!("platform:{}", current_platform_label()),
+        format!("gstreamer:{}", gst::version_string()),
+        format!("gpu:{}", gpu_identity()),
+    ];
+    for plugin_name in CAPABILITY_FINGERPRINT_PLUGINS {
+        let version = registry
+            .find_plugin(plugin_name)
+            .map(|plugin| plugin.version().to_string())
+            .unwrap_or_else(|| "absent".to_owned());
+        parts.push(format!("{plugin_name}:{version}"));
+    }
+    parts.join(";")
+}
+
+#[cfg(target_os = "linux")]
+fn gpu_identity() -> String {
+    // DRM vendor/device ids identify the GPU without touching the driver
+    // stack. A swapped or added GPU changes VAAPI/V4L2 probe results even
+    // when plugin versions are unchanged.
+    let mut ids = Vec::new();
+    for card_index in 0..4 {
+        let device = format!("/sys/class/drm/card{card_index}/device");
+        let vendor = fs::read_to_string(format!("{device}/vendor"));
+        let device = fs::read_to_string(format!("{device}/device"));
+        if let (Ok(vendor), Ok(device)) = (vendor, device) {
+            ids.push(format!("{}:{}", vendor.trim(), device.trim()));
+        }
+    }
+    if ids.is_empty() {
+        "unknown".to_owned()
+    } else {
+        ids.join(",")
+    }
+}
+
+#[cfg(not(target_os = "linux"))]
+fn gpu_identity() -> String {
+    // On Windows and macOS the hardware decoder plugins enumerate devices
+    // during registry scan, so a GPU change is reflected in plugin cache
+    // rebuilds and the version part of the fingerprint.
+    "default".to_owned()
+}
+
+/// Resolves a file inside the per-user streamer cache directory. Shared by
+/// the capability cache and the decoder benchmark ranking so both live next
+/// to each other on every platform.
+pub(crate) fn streamer_cache_path(file_name: &str) -> Option<PathBuf> {
+    let base = if cfg!(target_os = "windows") {
+        std::env::var_os("LOCALAPPDATA").map(PathBuf::from)
+    } else if cfg!(target_os = "macos") {
+        std::env::var_os("HOME").map(|home| PathBuf::from(home).join("Library/Caches"))
+    } else {
+        std::env::var_os("XDG_CACHE_HOME")
+            .map(PathBuf::from)
+            .or_else(|| std::env::var_os("HOME").map(|home| PathBuf::from(home).join(".cache")))
+    }?;
+    Some(base.join("opennow-streamer").join(file_name))
+}
+
+fn capability_cache_path() -> Option<PathBuf> {
+    streamer_cache_path(CAPABILITY_CACHE_FILE)
+}
+
+fn load_cached_backends(fingerprint: &str) -> Option<Vec<NativeVideoBackendCapability>> {
+    let path = capability_cache_path()?;
+    let contents = fs::read_to_string(path).ok()?;
+    let document: CapabilityCacheDocument = serde_json::from_str(&contents).ok()?;
+    if document.version != CAPABILITY_CACHE_VERSION || document.fingerprint != fingerprint {
+        return None;
+    }
+    Some(document.backends)
+}
+
+fn store_cached_backends(fingerprint: &str, backends: &[NativeVideoBackendCapability]) {
+    let Some(path) = capability_cache_path() else {
+        return;
+    };
+    let document = CapabilityCacheDocument {
+        version: CAPABILITY_CACHE_VERSION,
+        fingerprint: fingerprint.to_owned(),
+        backends: backends.to_vec(),
+    };
+    let Ok(serialized) = serde_json::to_string(&document) else {
+        return;
+    };
+    if let Some(parent) = path.parent() {
+        if fs::create_dir_all(parent).is_err() {
+            return;
+        }
+    }
+    // Write-then-rename keeps a concurrent reader from seeing a torn file; a
+    // failed write simply means the next start probes again.
+    let staging = path.with_extension("json.tmp");
+    if fs::write(&staging, serialized).is_ok() {
+        let _ = fs::rename(&staging, &path);
+    }
+}
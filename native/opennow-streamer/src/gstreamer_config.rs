@@ -4,6 +4,7 @@ pub(crate) const NATIVE_VIDEO_BACKEND_ENV: &str = "OPENNOW_NATIVE_VIDEO_BACKEND"
 pub(crate) const NATIVE_ZERO_COPY_ENV: &str = "OPENNOW_NATIVE_ZERO_COPY";
 pub(crate) const NATIVE_PRESENT_MAX_FPS_ENV: &str = "OPENNOW_NATIVE_PRESENT_MAX_FPS";
 pub(crate) const NATIVE_D3D_FULLSCREEN_ENV: &str = "OPENNOW_NATIVE_D3D_FULLSCREEN";
+pub(crate) const NATIVE_CAPABILITY_CACHE_ENV: &str = "OPENNOW_NATIVE_CAPABILITY_CACHE";
 pub(crate) const PRESENT_LIMITER_AUTO_SENTINEL: u32 = u32::MAX;
 
 pub(crate) fn use_external_renderer_window() -> bool {
@@ -24,14 +25,34 @@ pub(crate) fn requested_video_backend() -> String {
         .to_ascii_lowercase()
 }
 
-pub(crate) fn zero_copy_requested() -> bool {
-    matches!(
-        std::env::var(NATIVE_ZERO_COPY_ENV)
-            .unwrap_or_else(|_| "auto".to_owned())
-            .to_ascii_lowercase()
-            .as_str(),
-        "1" | "true" | "yes" | "forced"
-    )
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub(crate) enum ZeroCopyMode {
+    Disabled,
+    Auto,
+    Forced,
+}
+
+impl ZeroCopyMode {
+    pub(crate) fn as_str(self) -> &'static str {
+        match self {
+            Self::Disabled => "disabled",
+            Self::Auto => "auto",
+            Self::Forced => "forced",
+        }
+    }
+}
+
+pub(crate) fn zero_copy_mode() -> ZeroCopyMode {
+    match std::env::var(NATIVE_ZERO_COPY_ENV)
+        .unwrap_or_else(|_| "auto".to_owned())
+        .trim()
+        .to_ascii_lowercase()
+        .as_str()
+    {
+        "0" | "false" | "no" | "off" => ZeroCopyMode::Disabled,
+        "1" | "true" | "yes" | "forced" => ZeroCopyMode::Forced,
+        _ => ZeroCopyMode::Auto,
+    }
 }
 
 pub(crate) fn resolve_present_max_fps(requested_fps: u32) -> u32 {
@@ -57,6 +78,17 @@ pub(crate) fn automatic_present_max_fps(requested_fps: u32, display_hz: Option<u
         .unwrap_or(0)
 }
 
+pub(crate) fn resolve_capability_cache_enabled() -> bool {
+    if let Ok(value) = std::env::var(NATIVE_CAPABILITY_CACHE_ENV) {
+        let value = value.trim().to_ascii_lowercase();
+        if value == "0" || value == "off" || value == "false" || value == "no" {
+            return false;
+        }
+    }
+
+    true
+}
+
 pub(crate) fn resolve_d3d_fullscreen_sink(cloud_gsync_enabled: bool) -> bool {
     if let Ok(value) = std::env::var(NATIVE_D3D_FULLSCREEN_ENV) {
         let value = value.trim().to_ascii_lowercase();
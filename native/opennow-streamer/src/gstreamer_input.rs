@@ -4,9 +4,9 @@ use crate::gstreamer_platform::win32_renderer_window;
 use crate::input::InputEncoder;
 #[cfg(target_os = "windows")]
 use crate::input::{
-    layout_mapped_keyboard_keycode, layout_mapped_keyboard_scancode, GamepadInput, KeyboardPayload,
-    MouseButtonPayload, MouseMovePayload, MouseWheelPayload, GAMEPAD_MAX_CONTROLLERS,
-    PARTIALLY_RELIABLE_GAMEPAD_MASK_ALL,
+    layout_mapped_keyboard_keycode, layout_mapped_keyboard_scancode, BatchPush, GamepadInput,
+    KeyboardPayload, MouseButtonPayload, MouseMovePayload, MouseWheelPayload,
+    GAMEPAD_MAX_CONTROLLERS, PARTIALLY_RELIABLE_GAMEPAD_MASK_ALL,
 };
 use crate::protocol::Event;
 #[cfg(target_os = "windows")]
@@ -81,6 +81,14 @@ impl GstreamerInputState {
         }
     }
 
+    /// Applies the redundancy level negotiated from the server offer: each
+    /// partially reliable gamepad packet repeats the previous `level` states.
+    pub(crate) fn set_input_redundancy(&self, level: u8) {
+        if let Ok(mut encoder) = self.encoder.lock() {
+            encoder.set_input_redundancy(level);
+        }
+    }
+
     pub(crate) fn stop_heartbeat(&self) {
         self.heartbeat_stop.store(true, Ordering::SeqCst);
         let Some(handle) = self
@@ -270,7 +278,8 @@ impl GstreamerInputChannels {
             return false;
         }
 
-        let bytes = glib::Bytes::from_owned(payload.to_vec());
+        // glib copies into its own allocation; no intermediate Vec needed.
+        let bytes = glib::Bytes::from(payload);
         channel.send_data_full(Some(&bytes)).is_ok()
     }
 }
@@ -412,7 +421,7 @@ fn send_native_window_input_events(
         return;
     }
 
-    let Ok(encoder) = input_state.encoder.lock() else {
+    let Ok(mut encoder) = input_state.encoder.lock() else {
         return;
     };
 
@@ -432,15 +441,15 @@ fn send_native_window_input_events(
             continue;
         }
 
-        flush_pending_mouse_move(&encoder, input_channels, &mut pending_mouse_move);
-        send_encoded_native_window_input_event(&encoder, input_channels, event_sender, event);
+        flush_pending_mouse_move(&mut encoder, input_channels, &mut pending_mouse_move);
+        send_encoded_native_window_input_event(&mut encoder, input_channels, event_sender, event);
     }
-    flush_pending_mouse_move(&encoder, input_channels, &mut pending_mouse_move);
+    flush_pending_mouse_move(&mut encoder, input_channels, &mut pending_mouse_move);
 }
 
 #[cfg(target_os = "windows")]
 fn flush_pending_mouse_move(
-    encoder: &InputEncoder,
+    encoder: &mut InputEncoder,
     input_channels: &GstreamerInputChannels,
     pending_mouse_move: &mut Option<(i32, i32, u64)>,
 ) {
@@ -448,23 +457,35 @@ fn flush_pending_mouse_move(
         return;
     };
 
+    // Oversized deltas are chunked into i16 segments and batched into as few
+    // wire packets as the packet budget allows.
+    encoder.begin_batch();
     while dx != 0 || dy != 0 {
         let chunk_dx = dx.clamp(i32::from(i16::MIN), i32::from(i16::MAX)) as i16;
         let chunk_dy = dy.clamp(i32::from(i16::MIN), i32::from(i16::MAX)) as i16;
-        let payload = encoder.encode_mouse_move(MouseMovePayload {
+        let payload = MouseMovePayload {
             dx: chunk_dx,
             dy: chunk_dy,
             timestamp_us,
-        });
-        let _ = input_channels.send_packet(&payload, true);
+        };
+        if encoder.batch_mouse_move(payload) == BatchPush::Full {
+            let _ = input_channels.send_packet(encoder.finish_batch(), true);
+            encoder.begin_batch();
+            continue;
+        }
         dx = dx.saturating_sub(i32::from(chunk_dx));
         dy = dy.saturating_sub(i32::from(chunk_dy));
     }
+
+    let packet = encoder.finish_batch();
+    if !packet.is_empty() {
+        let _ = input_channels.send_packet(packet, true);
+    }
 }
 
 #[cfg(target_os = "windows")]
 fn send_encoded_native_window_input_event(
-    encoder: &InputEncoder,
+    encoder: &mut InputEncoder,
     input_channels: &GstreamerInputChannels,
     event_sender: &Option<Sender<Event>>,
     event: NativeWindowInputEvent,
@@ -536,7 +557,7 @@ fn send_encoded_native_window_input_event(
         ),
     };
 
-    let _ = input_channels.send_packet(&payload, partially_reliable);
+    let _ = input_channels.send_packet(payload, partially_reliable);
 }
 
 #[cfg(target_os = "windows")]
@@ -607,6 +628,8 @@ fn spawn_native_gamepad_thread(
                     }
                 }
 
+                let mut due = [false; GAMEPAD_MAX_CONTROLLERS as usize];
+                let mut any_due = false;
                 for controller_id in 0..GAMEPAD_MAX_CONTROLLERS as usize {
                     let snapshot = snapshots[controller_id];
                     let state_changed = snapshot != previous[controller_id];
@@ -614,13 +637,8 @@ fn spawn_native_gamepad_thread(
                         && last_sent[controller_id].elapsed() >= NATIVE_GAMEPAD_KEEPALIVE_INTERVAL;
 
                     if state_changed || keepalive_due {
-                        send_native_gamepad_snapshot(
-                            &input_state,
-                            &input_channels,
-                            controller_id as u8,
-                            bitmap,
-                            snapshot,
-                        );
+                        due[controller_id] = true;
+                        any_due = true;
                         last_sent[controller_id] = Instant::now();
 
                         if snapshot.connected != previous[controller_id].connected {
@@ -641,6 +659,16 @@ fn spawn_native_gamepad_thread(
 
                     previous[controller_id] = snapshot;
                 }
+
+                if any_due {
+                    send_native_gamepad_batch(
+                        &input_state,
+                        &input_channels,
+                        bitmap,
+                        &snapshots,
+                        &due,
+                    );
+                }
             }
 
             thread::sleep(NATIVE_GAMEPAD_POLL_INTERVAL);
@@ -649,20 +677,58 @@ fn spawn_native_gamepad_thread(
 }
 
 #[cfg(target_os = "windows")]
-fn send_native_gamepad_snapshot(
+fn send_native_gamepad_batch(
     input_state: &GstreamerInputState,
     input_channels: &GstreamerInputChannels,
-    controller_id: u8,
     bitmap: u16,
-    snapshot: NativeGamepadSnapshot,
+    snapshots: &[NativeGamepadSnapshot; GAMEPAD_MAX_CONTROLLERS as usize],
+    due: &[bool; GAMEPAD_MAX_CONTROLLERS as usize],
 ) {
     if !input_state.ready.load(Ordering::SeqCst) {
         return;
     }
 
-    let use_partially_reliable =
-        (PARTIALLY_RELIABLE_GAMEPAD_MASK_ALL & (1_u32 << u32::from(controller_id))) != 0;
-    let input = GamepadInput {
+    let Ok(mut encoder) = input_state.encoder.lock() else {
+        return;
+    };
+
+    // Reliable controllers (none under the default mask) go out one packet
+    // each; partially reliable ones coalesce into a single packet per tick.
+    for controller_id in 0..GAMEPAD_MAX_CONTROLLERS as usize {
+        if !due[controller_id] || gamepad_uses_partially_reliable(controller_id as u8) {
+            continue;
+        }
+        let input = gamepad_input_from_snapshot(controller_id as u8, snapshots[controller_id]);
+        let payload = encoder.encode_gamepad_state(bitmap, input, false);
+        let _ = input_channels.send_packet(payload, false);
+    }
+
+    encoder.begin_batch();
+    for controller_id in 0..GAMEPAD_MAX_CONTROLLERS as usize {
+        if !due[controller_id] || !gamepad_uses_partially_reliable(controller_id as u8) {
+            continue;
+        }
+        let input = gamepad_input_from_snapshot(controller_id as u8, snapshots[controller_id]);
+        if encoder.batch_gamepad_state(bitmap, input, true) == BatchPush::Full {
+            let _ = input_channels.send_packet(encoder.finish_batch(), true);
+            encoder.begin_batch();
+            let _ = encoder.batch_gamepad_state(bitmap, input, true);
+        }
+    }
+    let packet = encoder.finish_batch();
+    if !packet.is_empty() {
+        let _ = input_channels.send_packet(packet, true);
+    }
+}
+
+#[cfg(target_os = "windows")]
+fn gamepad_uses_partially_reliable(controller_id: u8) -> bool {
+    (PARTIALLY_RELIABLE_GAMEPAD_MASK_ALL & (1_u32 << u32::from(controller_id))) != 0
+}
+
+#[cfg(target_os = "windows")]
+fn gamepad_input_from_snapshot(controller_id: u8, snapshot: NativeGamepadSnapshot) -> GamepadInput {
+    GamepadInput {
         controller_id,
         buttons: snapshot.buttons,
         left_trigger: snapshot.left_trigger,
@@ -673,15 +739,7 @@ fn send_native_gamepad_snapshot(
         right_stick_y: snapshot.right_stick_y,
         connected: snapshot.connected,
         timestamp_us: native_input_timestamp_us(),
-    };
-
-    let Ok(mut encoder) = input_state.encoder.lock() else {
-        return;
-    };
-    let payload = encoder.encode_gamepad_state(bitmap, input, use_partially_reliable);
-    drop(encoder);
-
-    let _ = input_channels.send_packet(&payload, use_partially_reliable);
+    }
 }
 
 #[cfg(target_os = "windows")]
@@ -1026,7 +1084,7 @@ fn send_input_heartbeat(
         return;
     }
 
-    let Ok(encoder) = encoder.lock() else {
+    let Ok(mut encoder) = encoder.lock() else {
         send_log(
             event_sender,
             "warn",
@@ -1034,7 +1092,7 @@ fn send_input_heartbeat(
         );
         return;
     };
-    let bytes = glib::Bytes::from_owned(encoder.encode_heartbeat());
+    let bytes = glib::Bytes::from(encoder.encode_heartbeat());
     if let Err(error) = channel.send_data_full(Some(&bytes)) {
         send_log(
             event_sender,
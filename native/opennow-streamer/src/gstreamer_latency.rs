@@ -0,0 +1,290 @@
+//! Per-stage frame latency tracing inside the native video chain.
+//!
+//! The liveness watchdog can tell that the pipeline stalled but not where the
+//! time goes while it is healthy. This module timestamps each frame at four
+//! pad probes — depayloader out, pre-decode queue out, decoder out, and the
+//! sink pad of the video sink — and folds the stage-to-stage deltas into
+//! lock-free millisecond histograms. The watchdog drains a percentile snapshot
+//! once per stats interval and publishes it as a `frame-latency` event, so the
+//! HUD can separate decoder backpressure from present/vsync trouble.
+//!
+//! Frames are matched across probes by buffer PTS. Each probe stores its
+//! arrival time in a fixed slot array indexed by a PTS hash; a PTS fingerprint
+//! is packed into the same atomic word so a slot collision drops the sample
+//! instead of producing a bogus delta. Probes never block or allocate.
+
+use crate::protocol::{FrameLatencyStageStats, FrameLatencyStatsEvent};
+use gst::prelude::*;
+use gstreamer as gst;
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::sync::Arc;
+use std::time::Instant;
+
+/// Slots per probe point. Matching only needs to bridge a few frames of
+/// pipeline depth, so collisions are rare even at 240 fps.
+const TIMESTAMP_SLOTS: usize = 256;
+
+/// Millisecond-wide histogram buckets; the last bucket collects everything at
+/// or above `HISTOGRAM_BUCKETS - 1` ms.
+const HISTOGRAM_BUCKETS: usize = 128;
+
+/// Arrival words pack a 24-bit PTS fingerprint above 40 bits of elapsed
+/// nanoseconds since the tracker was created (enough for ~12 days).
+const ELAPSED_BITS: u32 = 40;
+const ELAPSED_MASK: u64 = (1 << ELAPSED_BITS) - 1;
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub(crate) enum FrameLatencyTap {
+    DepayOut,
+    QueueOut,
+    DecoderOut,
+    SinkIn,
+}
+
+struct TimestampSlots {
+    slots: Vec<AtomicU64>,
+}
+
+impl TimestampSlots {
+    fn new() -> Self {
+        Self {
+            slots: (0..TIMESTAMP_SLOTS).map(|_| AtomicU64::new(0)).collect(),
+        }
+    }
+
+    fn store(&self, pts_ms: u64, elapsed_ns: u64) {
+        let packed = (fingerprint(pts_ms) << ELAPSED_BITS) | (elapsed_ns & ELAPSED_MASK);
+        self.slots[slot_index(pts_ms)].store(packed, Ordering::Relaxed);
+    }
+
+    /// Returns the stored elapsed time for `pts_ms`, or None when the slot was
+    /// empty or overwritten by a colliding frame.
+    fn take(&self, pts_ms: u64) -> Option<u64> {
+        let packed = self.slots[slot_index(pts_ms)].swap(0, Ordering::Relaxed);
+        if packed == 0 || packed >> ELAPSED_BITS != fingerprint(pts_ms) {
+            return None;
+        }
+        Some(packed & ELAPSED_MASK)
+    }
+}
+
+fn slot_index(pts_ms: u64) -> usize {
+    // PTS values step by the frame duration, so spreading with a multiplier
+    // avoids clustering when the duration shares factors with the slot count.
+    (pts_ms.wrapping_mul(0x9E37_79B9_7F4A_7C15) >> 32) as usize % TIMESTAMP_SLOTS
+}
+
+fn fingerprint(pts_ms: u64) -> u64 {
+    // Never zero, so an empty slot is distinguishable from a stored one.
+    (pts_ms & 0x7F_FFFF) | 0x80_0000
+}
+
+struct LatencyHistogram {
+    buckets: Vec<AtomicU64>,
+}
+
+impl LatencyHistogram {
+    fn new() -> Self {
+        Self {
+            buckets: (0..HISTOGRAM_BUCKETS).map(|_| AtomicU64::new(0)).collect(),
+        }
+    }
+
+    fn record_ms(&self, delta_ms: u64) {
+        let bucket = (delta_ms as usize).min(HISTOGRAM_BUCKETS - 1);
+        self.buckets[bucket].fetch_add(1, Ordering::Relaxed);
+    }
+
+    /// Drains the histogram into p50/p99 for the elapsed window. Percentiles
+    /// resolve to the upper edge of their bucket, so they carry at most 1 ms
+    /// of quantization error.
+    fn drain_stage_stats(&self) -> FrameLatencyStageStats {
+        let mut counts = [0u64; HISTOGRAM_BUCKETS];
+        let mut total = 0u64;
+        for (bucket, count) in counts.iter_mut().enumerate() {
+            *count = self.buckets[bucket].swap(0, Ordering::Relaxed);
+            total += *count;
+        }
+
+        FrameLatencyStageStats {
+            p50_ms: percentile_ms(&counts, total, 0.50),
+            p99_ms: percentile_ms(&counts, total, 0.99),
+            samples: total.min(u64::from(u32::MAX)) as u32,
+        }
+    }
+}
+
+fn percentile_ms(counts: &[u64], total: u64, percentile: f64) -> f64 {
+    if total == 0 {
+        return 0.0;
+    }
+    let rank = ((total as f64) * percentile).ceil().max(1.0) as u64;
+    let mut cumulative = 0u64;
+    for (bucket, count) in counts.iter().enumerate() {
+        cumulative += count;
+        if cumulative >= rank {
+            return bucket as f64;
+        }
+    }
+    (counts.len() - 1) as f64
+}
+
+/// Shared between the four pad probes and the liveness watchdog. Probe-side
+/// methods only touch atomics; the watchdog drains percentiles once per stats
+/// interval.
+pub(crate) struct FrameLatencyTracker {
+    started: Instant,
+    depay_out: TimestampSlots,
+    queue_out: TimestampSlots,
+    decoder_out: TimestampSlots,
+    queue_wait: LatencyHistogram,
+    decode: LatencyHistogram,
+    present: LatencyHistogram,
+}
+
+impl Default for FrameLatencyTracker {
+    fn default() -> Self {
+        Self {
+            started: Instant::now(),
+            depay_out: TimestampSlots::new(),
+            queue_out: TimestampSlots::new(),
+            decoder_out: TimestampSlots::new(),
+            queue_wait: LatencyHistogram::new(),
+            decode: LatencyHistogram::new(),
+            present: LatencyHistogram::new(),
+        }
+    }
+}
+
+impl FrameLatencyTracker {
+    pub(crate) fn record(&self, tap: FrameLatencyTap, pts_ms: u64) {
+        let elapsed_ns = self.started.elapsed().as_nanos() as u64 & ELAPSED_MASK;
+        match tap {
+            FrameLatencyTap::DepayOut => self.depay_out.store(pts_ms, elapsed_ns),
+            FrameLatencyTap::QueueOut => {
+                if let Some(depay_ns) = self.depay_out.take(pts_ms) {
+                    self.queue_wait
+                        .record_ms(elapsed_ns.saturating_sub(depay_ns) / 1_000_000);
+                }
+                self.queue_out.store(pts_ms, elapsed_ns);
+            }
+            FrameLatencyTap::DecoderOut => {
+                if let Some(queue_ns) = self.queue_out.take(pts_ms) {
+                    self.decode
+                        .record_ms(elapsed_ns.saturating_sub(queue_ns) / 1_000_000);
+                }
+                self.decoder_out.store(pts_ms, elapsed_ns);
+            }
+            FrameLatencyTap::SinkIn => {
+                if let Some(decoder_ns) = self.decoder_out.take(pts_ms) {
+                    self.present
+                        .record_ms(elapsed_ns.saturating_sub(decoder_ns) / 1_000_000);
+                }
+            }
+        }
+    }
+
+    /// Drains the window into an event payload, or None when no stage matched
+    /// a frame since the previous drain (startup, or PTS-less buffers).
+    pub(crate) fn drain_snapshot(&self) -> Option<FrameLatencyStatsEvent> {
+        let queue_wait = self.queue_wait.drain_stage_stats();
+        let decode = self.decode.drain_stage_stats();
+        let present = self.present.drain_stage_stats();
+        if queue_wait.samples == 0 && decode.samples == 0 && present.samples == 0 {
+            return None;
+        }
+        Some(FrameLatencyStatsEvent {
+            queue_wait,
+            decode,
+            present,
+        })
+    }
+}
+
+/// Installs a buffer probe on `pad` that timestamps every frame carrying a PTS
+/// at the given tap point.
+pub(crate) fn watch_frame_latency(
+    pad: &gst::Pad,
+    tracker: Arc<FrameLatencyTracker>,
+    tap: FrameLatencyTap,
+) {
+    pad.add_probe(gst::PadProbeType::BUFFER, move |_pad, info| {
+        if let Some(pts) = info.buffer().and_then(|buffer| buffer.pts()) {
+            tracker.record(tap, pts.mseconds());
+        }
+        gst::PadProbeReturn::Ok
+    });
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn timestamp_slots_match_on_pts_and_reject_collisions() {
+        let slots = TimestampSlots::new();
+        slots.store(1_000, 42);
+        assert_eq!(slots.take(1_000), Some(42));
+        // A take drains the slot.
+        assert_eq!(slots.take(1_000), None);
+
+        slots.store(1_000, 42);
+        // A colliding frame with a different fingerprint poisons the slot for
+        // the original PTS instead of producing a wrong delta.
+        let colliding = (1_001u64..)
+            .find(|pts| slot_index(*pts) == slot_index(1_000) && fingerprint(*pts) != fingerprint(1_000))
+            .expect("a colliding PTS exists");
+        slots.store(colliding, 99);
+        assert_eq!(slots.take(1_000), None);
+    }
+
+    #[test]
+    fn histogram_percentiles_cover_the_recorded_window() {
+        let histogram = LatencyHistogram::new();
+        for _ in 0..98 {
+            histogram.record_ms(2);
+        }
+        histogram.record_ms(10);
+        histogram.record_ms(90);
+
+        let stats = histogram.drain_stage_stats();
+        assert_eq!(stats.samples, 100);
+        assert_eq!(stats.p50_ms, 2.0);
+        assert_eq!(stats.p99_ms, 10.0);
+
+        // The drain resets the window.
+        assert_eq!(histogram.drain_stage_stats().samples, 0);
+    }
+
+    #[test]
+    fn histogram_clamps_outliers_into_the_last_bucket() {
+        let histogram = LatencyHistogram::new();
+        histogram.record_ms(5_000);
+        let stats = histogram.drain_stage_stats();
+        assert_eq!(stats.p50_ms, (HISTOGRAM_BUCKETS - 1) as f64);
+    }
+
+    #[test]
+    fn tracker_chains_stage_deltas_by_pts() {
+        let tracker = FrameLatencyTracker::default();
+        tracker.record(FrameLatencyTap::DepayOut, 16);
+        tracker.record(FrameLatencyTap::QueueOut, 16);
+        tracker.record(FrameLatencyTap::DecoderOut, 16);
+        tracker.record(FrameLatencyTap::SinkIn, 16);
+
+        let snapshot = tracker.drain_snapshot().expect("stages recorded");
+        assert_eq!(snapshot.queue_wait.samples, 1);
+        assert_eq!(snapshot.decode.samples, 1);
+        assert_eq!(snapshot.present.samples, 1);
+        assert!(tracker.drain_snapshot().is_none());
+    }
+
+    #[test]
+    fn tracker_ignores_unmatched_stages() {
+        let tracker = FrameLatencyTracker::default();
+        // Sink sees a frame the decoder probe never observed (e.g. installed
+        // mid-stream); nothing should be recorded.
+        tracker.record(FrameLatencyTap::SinkIn, 33);
+        assert!(tracker.drain_snapshot().is_none());
+    }
+}
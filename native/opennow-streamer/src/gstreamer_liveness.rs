@@ -1,6 +1,7 @@
 use crate::gstreamer_backend::send_log;
 use crate::gstreamer_config::use_external_renderer_window;
-use crate::gstreamer_pipeline::{configure_queue, set_property_if_supported};
+use crate::gstreamer_latency::FrameLatencyTracker;
+use crate::gstreamer_pipeline::{configure_queue, set_property_if_supported, WEBRTC_LATENCY_MS};
 use crate::gstreamer_transitions::{
     format_transition_summary, resolve_queue_mode, TransitionSnapshot, TransitionTelemetry,
     DEFAULT_VIDEO_QUEUE_DEPTH,
@@ -27,6 +28,31 @@ const VIDEO_STARTUP_RESYNC_MS: u64 = 5_000;
 const VIDEO_STARTUP_FATAL_MS: u64 = 8_000;
 const VIDEO_LIVENESS_POLL_INTERVAL: Duration = Duration::from_millis(250);
 
+// Adaptive watchdog pacing. The pad probes feeding the liveness atomics are
+// already event-driven; the remaining steady-state cost is this thread's
+// fixed timer wakeups, which show up as CPU burn on battery-powered handheld
+// clients. After a sustained healthy window the watchdog stretches to the
+// relaxed tick; any trouble signal (sink gap, jitter underrun, stall action,
+// video transition) snaps it back to the tight tick for a hold-off period.
+// The relaxed tick stays well under VIDEO_STALL_WARNING_MS, so stall
+// detection latency grows by at most one relaxed tick and trouble never runs
+// on the relaxed cadence.
+const VIDEO_LIVENESS_RELAXED_POLL_INTERVAL: Duration = Duration::from_millis(1_000);
+const VIDEO_LIVENESS_HEALTHY_BEFORE_RELAX_MS: u64 = 30_000;
+const VIDEO_LIVENESS_TIGHT_HOLD_MS: u64 = 10_000;
+
+// Adaptive jitter-buffer tuning. The pipeline starts at the aggressive
+// WEBRTC_LATENCY_MS floor; repeated render underruns while RTP keeps flowing
+// raise the webrtcbin jitter buffer in small steps, and a clean stream decays
+// it back toward the floor. No static latency works for both wired and
+// wireless clients, so the liveness watchdog closes the loop instead.
+const JITTER_LATENCY_STEP_MS: u32 = 10;
+const JITTER_LATENCY_MAX_MS: u32 = 150;
+const JITTER_UNDERRUNS_BEFORE_RAISE: u32 = 3;
+const JITTER_RAISE_COOLDOWN: Duration = Duration::from_secs(5);
+const JITTER_CLEAN_DECAY_INTERVAL: Duration = Duration::from_secs(30);
+const JITTER_UNDERRUN_RTP_RECENT_MS: u64 = 500;
+
 #[derive(Debug, Clone, Copy, PartialEq)]
 pub(crate) struct VideoRateSnapshot {
     encoded_kbps: f64,
@@ -116,6 +142,104 @@ impl VideoStallTracker {
     }
 }
 
+#[derive(Debug)]
+pub(crate) struct JitterBufferTuner {
+    latency_ms: u32,
+    underrun_streak: u32,
+    last_raise_at: Option<Instant>,
+    last_underrun_at: Option<Instant>,
+    last_change_at: Option<Instant>,
+}
+
+impl JitterBufferTuner {
+    pub(crate) fn new(initial_latency_ms: u32) -> Self {
+        Self {
+            latency_ms: initial_latency_ms,
+            underrun_streak: 0,
+            last_raise_at: None,
+            last_underrun_at: None,
+            last_change_at: None,
+        }
+    }
+
+    pub(crate) fn latency_ms(&self) -> u32 {
+        self.latency_ms
+    }
+
+    /// Feeds one watchdog poll observation into the tuner. Returns the new
+    /// latency and the reason when the jitter buffer should be reconfigured.
+    pub(crate) fn observe(&mut self, now: Instant, underrun: bool) -> Option<(u32, &'static str)> {
+        if underrun {
+            self.last_underrun_at = Some(now);
+            self.underrun_streak = self.underrun_streak.saturating_add(1);
+            if self.underrun_streak < JITTER_UNDERRUNS_BEFORE_RAISE
+                || self.latency_ms >= JITTER_LATENCY_MAX_MS
+            {
+                return None;
+            }
+            if self
+                .last_raise_at
+                .is_some_and(|at| now.duration_since(at) < JITTER_RAISE_COOLDOWN)
+            {
+                return None;
+            }
+
+            self.latency_ms = (self.latency_ms + JITTER_LATENCY_STEP_MS).min(JITTER_LATENCY_MAX_MS);
+            self.underrun_streak = 0;
+            self.last_raise_at = Some(now);
+            self.last_change_at = Some(now);
+            return Some((self.latency_ms, "repeated render underruns"));
+        }
+
+        self.underrun_streak = 0;
+        if self.latency_ms <= WEBRTC_LATENCY_MS {
+            return None;
+        }
+        let clean_since = [self.last_underrun_at, self.last_change_at]
+            .into_iter()
+            .flatten()
+            .max();
+        if clean_since.is_some_and(|at| now.duration_since(at) < JITTER_CLEAN_DECAY_INTERVAL) {
+            return None;
+        }
+
+        self.latency_ms = self
+            .latency_ms
+            .saturating_sub(JITTER_LATENCY_STEP_MS)
+            .max(WEBRTC_LATENCY_MS);
+        self.last_change_at = Some(now);
+        Some((self.latency_ms, "stream clean"))
+    }
+}
+
+#[derive(Debug, Default)]
+pub(crate) struct LivenessPollPacer {
+    healthy_since_ms: Option<u64>,
+    tight_until_ms: u64,
+}
+
+impl LivenessPollPacer {
+    /// Feeds one watchdog iteration into the pacer and returns the sleep
+    /// before the next poll. Any unhealthy observation restarts the healthy
+    /// window and pins the tight interval for a hold-off period.
+    pub(crate) fn next_interval(&mut self, now_ms: u64, healthy: bool) -> Duration {
+        if !healthy {
+            self.healthy_since_ms = None;
+            self.tight_until_ms = now_ms.saturating_add(VIDEO_LIVENESS_TIGHT_HOLD_MS);
+            return VIDEO_LIVENESS_POLL_INTERVAL;
+        }
+        if now_ms < self.tight_until_ms {
+            return VIDEO_LIVENESS_POLL_INTERVAL;
+        }
+        let healthy_since_ms = *self.healthy_since_ms.get_or_insert(now_ms);
+        if now_ms.saturating_sub(healthy_since_ms) >= VIDEO_LIVENESS_HEALTHY_BEFORE_RELAX_MS {
+            VIDEO_LIVENESS_RELAXED_POLL_INTERVAL
+        } else {
+            VIDEO_LIVENESS_POLL_INTERVAL
+        }
+    }
+}
+
 #[derive(Debug)]
 pub(crate) struct VideoLivenessState {
     started_at: Instant,
@@ -128,6 +252,7 @@ pub(crate) struct VideoLivenessState {
     finalized_streaming_features_summary: Mutex<String>,
     transition_telemetry: Mutex<TransitionTelemetry>,
     stats_overlay: Mutex<Option<gst::Element>>,
+    webrtc: Mutex<Option<gst::Element>>,
     pre_decode_queue: Mutex<Option<gst::Element>>,
     decoder: Mutex<Option<gst::Element>>,
     post_decode_queue: Mutex<Option<gst::Element>>,
@@ -138,12 +263,14 @@ pub(crate) struct VideoLivenessState {
     last_decoded_ms: AtomicU64,
     last_sink_ms: AtomicU64,
     last_audio_ms: AtomicU64,
+    last_transition_ms: AtomicU64,
     first_startup_audio_ms: AtomicU64,
     decoded_total: AtomicU64,
     sink_total: AtomicU64,
     zero_copy_d3d11: AtomicBool,
     zero_copy_d3d12: AtomicBool,
     rtp_video_src_pad: Mutex<Option<gst::Pad>>,
+    frame_latency: Arc<FrameLatencyTracker>,
     requested_fps: AtomicU32,
     framerate_mismatch_warned: AtomicBool,
     transition_flush_escalation_enabled: AtomicBool,
@@ -166,6 +293,7 @@ impl VideoLivenessState {
             finalized_streaming_features_summary: Mutex::new("none".to_owned()),
             transition_telemetry: Mutex::new(TransitionTelemetry::default()),
             stats_overlay: Mutex::new(None),
+            webrtc: Mutex::new(None),
             pre_decode_queue: Mutex::new(None),
             decoder: Mutex::new(None),
             post_decode_queue: Mutex::new(None),
@@ -176,12 +304,14 @@ impl VideoLivenessState {
             last_decoded_ms: AtomicU64::new(0),
             last_sink_ms: AtomicU64::new(0),
             last_audio_ms: AtomicU64::new(0),
+            last_transition_ms: AtomicU64::new(0),
             first_startup_audio_ms: AtomicU64::new(0),
             decoded_total: AtomicU64::new(0),
             sink_total: AtomicU64::new(0),
             zero_copy_d3d11: AtomicBool::new(false),
             zero_copy_d3d12: AtomicBool::new(false),
             rtp_video_src_pad: Mutex::new(None),
+            frame_latency: Arc::new(FrameLatencyTracker::default()),
             requested_fps: AtomicU32::new(0),
             framerate_mismatch_warned: AtomicBool::new(false),
             transition_flush_escalation_enabled: AtomicBool::new(true),
@@ -259,6 +389,7 @@ impl VideoLivenessState {
         self.startup_resync_requested
             .store(false, Ordering::Relaxed);
         self.startup_fatal_reported.store(false, Ordering::Relaxed);
+        self.last_transition_ms.store(0, Ordering::Relaxed);
     }
 
     pub(crate) fn update_hardware_acceleration(&self, value: impl Into<String>) {
@@ -396,6 +527,16 @@ impl VideoLivenessState {
             .unwrap_or(NativeQueueMode::Auto)
     }
 
+    pub(crate) fn set_webrtc(&self, webrtc: gst::Element) {
+        if let Ok(mut current) = self.webrtc.lock() {
+            *current = Some(webrtc);
+        }
+    }
+
+    fn webrtc(&self) -> Option<gst::Element> {
+        self.webrtc.lock().ok().and_then(|current| current.clone())
+    }
+
     pub(crate) fn set_post_decode_queue(&self, queue: gst::Element) {
         if let Ok(mut current) = self.post_decode_queue.lock() {
             *current = Some(queue);
@@ -545,6 +686,8 @@ impl VideoLivenessState {
         if let Ok(mut telemetry) = self.transition_telemetry.lock() {
             telemetry.last_transition = Some(snapshot.clone());
         }
+        self.last_transition_ms
+            .store(snapshot.at_ms, Ordering::Relaxed);
 
         send_log(
             event_sender,
@@ -635,6 +778,10 @@ impl VideoLivenessMonitor {
         self.state.set_rtp_video_src_pad(pad);
     }
 
+    pub(crate) fn set_webrtc(&self, webrtc: gst::Element) {
+        self.state.set_webrtc(webrtc);
+    }
+
     pub(crate) fn set_post_decode_queue(&self, queue: gst::Element) {
         self.state.set_post_decode_queue(queue);
     }
@@ -643,6 +790,10 @@ impl VideoLivenessMonitor {
         self.state.set_pre_decode_queue(queue);
     }
 
+    pub(crate) fn frame_latency_tracker(&self) -> Arc<FrameLatencyTracker> {
+        self.state.frame_latency.clone()
+    }
+
     pub(crate) fn set_decoder(&self, decoder: gst::Element) {
         self.state.set_decoder(decoder);
     }
@@ -731,6 +882,9 @@ fn run_video_liveness_watchdog(
     event_sender: Option<Sender<Event>>,
 ) {
     let mut tracker = VideoStallTracker::default();
+    let mut jitter_tuner = JitterBufferTuner::new(WEBRTC_LATENCY_MS);
+    let mut pacer = LivenessPollPacer::default();
+    let mut poll_interval = VIDEO_LIVENESS_POLL_INTERVAL;
     let mut last_rate_at = Instant::now();
     let mut last_encoded_bytes_total = state.encoded_bytes_total.load(Ordering::Relaxed);
     let mut last_decoded_total = state.decoded_total.load(Ordering::Relaxed);
@@ -742,7 +896,7 @@ fn run_video_liveness_watchdog(
     };
 
     while !stop.load(Ordering::SeqCst) {
-        thread::sleep(VIDEO_LIVENESS_POLL_INTERVAL);
+        thread::sleep(poll_interval);
 
         let elapsed = last_rate_at.elapsed();
         if elapsed >= VIDEO_SINK_RATE_LOG_INTERVAL {
@@ -777,6 +931,11 @@ fn run_video_liveness_watchdog(
                 decoded_total,
                 sink_total,
             );
+            if let (Some(sender), Some(latency)) =
+                (&event_sender, state.frame_latency.drain_snapshot())
+            {
+                let _ = sender.send(Event::FrameLatency { latency });
+            }
             last_encoded_bytes_total = encoded_bytes_total;
             last_decoded_total = decoded_total;
             last_sink_total = sink_total;
@@ -785,6 +944,7 @@ fn run_video_liveness_watchdog(
 
         let last_sink_ms = state.last_sink_ms.load(Ordering::Relaxed);
         if last_sink_ms == 0 {
+            poll_interval = pacer.next_interval(state.now_ms(), false);
             maybe_recover_video_startup(&state, &pipeline, &event_sender);
             continue;
         }
@@ -797,7 +957,38 @@ fn run_video_liveness_watchdog(
         let transition_stall = likely_stage == "decode-chain-stalled"
             && encoded_age_ms.is_some_and(|age| age <= 1_000);
 
-        match tracker.evaluate(now_ms, last_sink_ms) {
+        let underrun = detect_jitter_underrun(&state, encoded_age_ms, sink_age_ms);
+        if let Some((latency_ms, reason)) = jitter_tuner.observe(Instant::now(), underrun) {
+            apply_jitter_buffer_latency(&state, &pipeline, latency_ms, reason, &event_sender);
+        }
+
+        let stall_action = tracker.evaluate(now_ms, last_sink_ms);
+        let transition_recent =
+            age_since_ms(now_ms, state.last_transition_ms.load(Ordering::Relaxed))
+                .is_some_and(|age| age < VIDEO_LIVENESS_TIGHT_HOLD_MS);
+        let healthy = matches!(stall_action, VideoStallAction::None)
+            && !underrun
+            && !transition_recent
+            && sink_age_ms.is_some_and(|age| age < sink_gap_threshold_ms(&state));
+        let next_interval = pacer.next_interval(now_ms, healthy);
+        if next_interval != poll_interval {
+            send_log(
+                &event_sender,
+                "debug",
+                format!(
+                    "Liveness watchdog {} poll interval to {}ms.",
+                    if next_interval > poll_interval {
+                        "relaxed"
+                    } else {
+                        "tightened"
+                    },
+                    next_interval.as_millis()
+                ),
+            );
+            poll_interval = next_interval;
+        }
+
+        match stall_action {
             VideoStallAction::None => {}
             VideoStallAction::RequestKeyframe { attempt, stall_ms } => {
                 request_upstream_key_unit(&state, &event_sender);
@@ -913,6 +1104,78 @@ fn run_video_liveness_watchdog(
     }
 }
 
+fn detect_jitter_underrun(
+    state: &VideoLivenessState,
+    encoded_age_ms: Option<u64>,
+    sink_age_ms: Option<u64>,
+) -> bool {
+    let Some(sink_age_ms) = sink_age_ms else {
+        return false;
+    };
+    // Only count gaps while RTP keeps arriving; an idle uplink is not jitter.
+    if !encoded_age_ms.is_some_and(|age| age <= JITTER_UNDERRUN_RTP_RECENT_MS) {
+        return false;
+    }
+
+    // Underrun: the sink gap exceeds a few frame intervals but stays below the
+    // stall tracker's territory, where keyframe recovery takes over instead.
+    if sink_age_ms < sink_gap_threshold_ms(state) || sink_age_ms >= VIDEO_STALL_WARNING_MS {
+        return false;
+    }
+
+    // A drained pre-decode queue with RTP still arriving points at network
+    // jitter starving the decoder rather than a wedged decode chain.
+    element_queue_is_drained(state.pre_decode_queue())
+}
+
+/// Sink gap beyond a few frame intervals counts as trouble for both the
+/// jitter-underrun detector and the adaptive watchdog pacing.
+fn sink_gap_threshold_ms(state: &VideoLivenessState) -> u64 {
+    let frame_interval_ms = 1_000 / u64::from(state.requested_fps().unwrap_or(60).max(1));
+    (frame_interval_ms * 3).max(50)
+}
+
+fn element_queue_is_drained(queue: Option<gst::Element>) -> bool {
+    let Some(queue) = queue else {
+        return true;
+    };
+    if queue.find_property("current-level-buffers").is_none() {
+        return true;
+    }
+    queue.property::<u32>("current-level-buffers") == 0
+}
+
+fn apply_jitter_buffer_latency(
+    state: &VideoLivenessState,
+    pipeline: &gst::Pipeline,
+    latency_ms: u32,
+    reason: &'static str,
+    event_sender: &Option<Sender<Event>>,
+) {
+    let Some(webrtc) = state.webrtc() else {
+        send_log(
+            event_sender,
+            "warn",
+            "Cannot retune jitter buffer because no webrtcbin is registered.".to_owned(),
+        );
+        return;
+    };
+
+    set_property_if_supported(&webrtc, "latency", latency_ms);
+    if let Err(error) = pipeline.recalculate_latency() {
+        send_log(
+            event_sender,
+            "warn",
+            format!("Failed to recalculate GStreamer latency after jitter-buffer retune: {error}."),
+        );
+    }
+    send_log(
+        event_sender,
+        "info",
+        format!("Adaptive jitter buffer set webrtcbin latency to {latency_ms}ms ({reason})."),
+    );
+}
+
 fn maybe_recover_video_startup(
     state: &VideoLivenessState,
     pipeline: &gst::Pipeline,
@@ -1887,6 +2150,8 @@ pub(crate) fn memory_mode_from_caps(caps: &str) -> &'static str {
         "VulkanImage"
     } else if caps.contains("memory:VAMemory") {
         "VAMemory"
+    } else if caps.contains("memory:DMABuf") {
+        "DMABuf"
     } else if caps.contains("memory:GLMemory") {
         "GLMemory"
     } else {
@@ -1897,6 +2162,6 @@ pub(crate) fn memory_mode_from_caps(caps: &str) -> &'static str {
 pub(crate) fn is_zero_copy_memory_mode(memory_mode: &str) -> bool {
     matches!(
         memory_mode,
-        "D3D12Memory" | "D3D11Memory" | "VulkanImage" | "VAMemory" | "GLMemory"
+        "D3D12Memory" | "D3D11Memory" | "VulkanImage" | "VAMemory" | "DMABuf" | "GLMemory"
     )
 }
@@ -1,9 +1,9 @@
 use crate::gstreamer_backend::send_log;
 use crate::gstreamer_config::{
     automatic_present_max_fps, requested_video_backend, use_external_renderer_window,
-    zero_copy_requested, EXTERNAL_RENDERER_ENV, NATIVE_D3D_FULLSCREEN_ENV,
+    zero_copy_mode, ZeroCopyMode, EXTERNAL_RENDERER_ENV, NATIVE_D3D_FULLSCREEN_ENV,
     NATIVE_PRESENT_MAX_FPS_ENV, NATIVE_VIDEO_API_ENV, NATIVE_VIDEO_BACKEND_ENV,
-    PRESENT_LIMITER_AUTO_SENTINEL,
+    NATIVE_ZERO_COPY_ENV, PRESENT_LIMITER_AUTO_SENTINEL,
 };
 #[cfg(target_os = "windows")]
 use crate::gstreamer_input::NativeWindowInputBridge;
@@ -11,6 +11,7 @@ use crate::gstreamer_input::{
     create_input_data_channels, wire_remote_data_channels, GstreamerInputChannels,
     GstreamerInputState,
 };
+use crate::gstreamer_latency::{watch_frame_latency, FrameLatencyTap};
 use crate::gstreamer_liveness::{
     install_present_limiter, watch_audio_activity, watch_first_sink_buffer,
     watch_rtp_video_bitrate, watch_video_caps_transitions, watch_video_decoded_rate,
@@ -38,7 +39,7 @@ use std::sync::mpsc::Sender;
 use std::sync::{Arc, Mutex};
 use std::thread;
 
-const WEBRTC_LATENCY_MS: u32 = 2;
+pub(crate) const WEBRTC_LATENCY_MS: u32 = 2;
 const VIDEO_COMPRESSED_QUEUE_MAX_BUFFERS: u32 = 6;
 pub(crate) const VIDEO_QUEUE_MAX_BUFFERS: u32 = DEFAULT_VIDEO_QUEUE_DEPTH;
 const AUDIO_QUEUE_MAX_BUFFERS: u32 = 2;
@@ -126,14 +127,23 @@ impl RtpVideoApi {
     }
 
     fn memory_caps(self) -> Option<&'static str> {
+        let mode = zero_copy_mode();
+        if mode == ZeroCopyMode::Disabled {
+            // vulkansink only accepts VulkanImage; there is no copy path to prefer.
+            return matches!(self, Self::Vulkan).then_some("video/x-raw(memory:VulkanImage)");
+        }
         match self {
-            // D3D decoders and sinks can negotiate GPU memory directly. Keep
-            // the capsfilter opt-in so startup does not fail when a live RTP
-            // stream's raw caps are still settling.
-            Self::D3D11 => zero_copy_requested().then_some("video/x-raw(memory:D3D11Memory)"),
-            Self::D3D12 => zero_copy_requested().then_some("video/x-raw(memory:D3D12Memory)"),
-            Self::VideoToolbox => zero_copy_requested().then_some("video/x-raw(memory:GLMemory)"),
-            Self::Vaapi => zero_copy_requested().then_some("video/x-raw(memory:VAMemory)"),
+            // D3D sinks share the decoder's device, so GPU-memory negotiation is safe by
+            // default; link_rtp_video_pad retries on the system-memory copy path if the
+            // explicit caps cannot link while a live RTP stream's raw caps are settling.
+            Self::D3D11 => Some("video/x-raw(memory:D3D11Memory)"),
+            Self::D3D12 => Some("video/x-raw(memory:D3D12Memory)"),
+            Self::VideoToolbox => {
+                (mode == ZeroCopyMode::Forced).then_some("video/x-raw(memory:GLMemory)")
+            }
+            // dmabuf is the Linux GPU handoff glupload can import without readback; it also
+            // survives sinks that are not VA-aware, unlike memory:VAMemory.
+            Self::Vaapi => Some("video/x-raw(memory:DMABuf)"),
             Self::Vulkan => Some("video/x-raw(memory:VulkanImage)"),
             _ => None,
         }
@@ -143,7 +153,9 @@ impl RtpVideoApi {
         match self {
             Self::D3D11 | Self::D3D12 => None,
             Self::Vulkan => Some("vulkancolorconvert"),
-            Self::VideoToolbox | Self::Vaapi if zero_copy_requested() => None,
+            // A videoconvert stage would force a CPU readback out of GPU memory, defeating
+            // the zero-copy chain; the copy-path fallback re-inserts it when needed.
+            Self::VideoToolbox | Self::Vaapi if self.memory_caps().is_some() => None,
             // Non-D3D hardware decoders are not guaranteed to negotiate directly with every
             // platform sink. Keep these paths reliable with an explicit raw-video conversion stage.
             Self::VideoToolbox | Self::Vaapi | Self::V4L2 | Self::Software => Some("videoconvert"),
@@ -352,6 +364,9 @@ impl GstreamerPipeline {
         let input_state = GstreamerInputState::default();
         let render_state = GstreamerRenderState::default();
         let video_liveness = VideoLivenessMonitor::default();
+        // The liveness watchdog tunes the webrtcbin jitter buffer at runtime,
+        // starting from the aggressive WEBRTC_LATENCY_MS floor set above.
+        video_liveness.set_webrtc(webrtc.clone());
         wire_local_ice_events(&webrtc, event_sender.clone())?;
         wire_webrtc_state_events(&webrtc, event_sender.clone());
         wire_remote_data_channels(&webrtc, event_sender.clone());
@@ -415,6 +430,10 @@ impl GstreamerPipeline {
         self.d3d_fullscreen_sink.store(enabled, Ordering::SeqCst);
     }
 
+    pub(crate) fn set_input_redundancy(&self, level: u8) {
+        self.input_state.set_input_redundancy(level);
+    }
+
     pub(crate) fn configure_stats(
         &self,
         context: &NativeStreamerSessionContext,
@@ -1328,7 +1347,7 @@ fn rtp_video_depayloader_factory(codec: &str) -> Option<&'static str> {
     }
 }
 
-fn rtp_video_parser_factory(codec: &str) -> Option<&'static str> {
+pub(crate) fn rtp_video_parser_factory(codec: &str) -> Option<&'static str> {
     match codec {
         "H265" | "HEVC" => Some("h265parse"),
         "H264" => Some("h264parse"),
@@ -1475,9 +1494,49 @@ fn should_prefer_d3d12_for_high_fps(requested_fps: Option<u32>) -> bool {
     requested_fps.is_some_and(|fps| fps >= 200)
 }
 
+/// Last chain plan that resolved successfully. A reconnect almost always
+/// renegotiates the same codec and frame rate (the server keeps the stream
+/// profile across a transport drop), and re-resolving the plan walks the
+/// GStreamer registry for decoder, sink, and fallback factories — pure
+/// rebuild time on the reconnect path — so the result is memoized.
+struct RtpVideoChainPlan {
+    encoding: String,
+    requested_fps: Option<u32>,
+    video_api: RtpVideoApi,
+    specs: Vec<RtpVideoChainSpec>,
+}
+
+static LAST_RTP_VIDEO_CHAIN_PLAN: Mutex<Option<RtpVideoChainPlan>> = Mutex::new(None);
+
 fn rtp_video_chain_specs(
     encoding: &str,
     requested_fps: Option<u32>,
+) -> Option<(RtpVideoApi, Vec<RtpVideoChainSpec>)> {
+    let cache_key = encoding.to_ascii_uppercase();
+    if let Ok(cache) = LAST_RTP_VIDEO_CHAIN_PLAN.lock() {
+        if let Some(plan) = cache
+            .as_ref()
+            .filter(|plan| plan.encoding == cache_key && plan.requested_fps == requested_fps)
+        {
+            return Some((plan.video_api, plan.specs.clone()));
+        }
+    }
+
+    let (video_api, specs) = resolve_rtp_video_chain_specs(encoding, requested_fps)?;
+    if let Ok(mut cache) = LAST_RTP_VIDEO_CHAIN_PLAN.lock() {
+        *cache = Some(RtpVideoChainPlan {
+            encoding: cache_key,
+            requested_fps,
+            video_api,
+            specs: specs.clone(),
+        });
+    }
+    Some((video_api, specs))
+}
+
+fn resolve_rtp_video_chain_specs(
+    encoding: &str,
+    requested_fps: Option<u32>,
 ) -> Option<(RtpVideoApi, Vec<RtpVideoChainSpec>)> {
     preferred_rtp_video_apis(requested_fps)
         .into_iter()
@@ -1528,8 +1587,13 @@ fn insert_requested_fps_capssetter(specs: &mut Vec<RtpVideoChainSpec>, requested
 
 fn select_decoder_factory(video_api: RtpVideoApi, codec: &str) -> Option<&'static str> {
     let primary = video_api.decoder_factory(codec)?;
-    std::iter::once(primary)
+    let candidates: Vec<&'static str> = std::iter::once(primary)
         .chain(video_api.fallback_decoder_factories(codec).iter().copied())
+        .collect();
+    // A persisted benchmark ranking reorders the static preference table for
+    // this machine; without one the candidates come back unchanged.
+    crate::gstreamer_benchmark::rank_decoder_candidates(codec, candidates)
+        .into_iter()
         .find(|factory| gst::ElementFactory::find(factory).is_some())
 }
 
@@ -1561,6 +1625,30 @@ fn all_video_codec_labels() -> &'static [&'static str] {
     &["H264", "H265", "AV1"]
 }
 
+/// Every decoder factory any platform-eligible backend could pick for the
+/// codec, in static preference order and deduplicated. The benchmark harness
+/// measures this superset so the ranking covers whichever `RtpVideoApi` ends
+/// up selected at stream start.
+pub(crate) fn decoder_benchmark_candidates(codec: &str) -> Vec<&'static str> {
+    let mut candidates = Vec::new();
+    for video_api in all_rtp_video_apis() {
+        if !backend_runs_on_current_platform(*video_api) {
+            continue;
+        }
+        let Some(primary) = video_api.decoder_factory(codec) else {
+            continue;
+        };
+        for factory in std::iter::once(primary)
+            .chain(video_api.fallback_decoder_factories(codec).iter().copied())
+        {
+            if !candidates.contains(&factory) {
+                candidates.push(factory);
+            }
+        }
+    }
+    candidates
+}
+
 pub(crate) fn current_platform_label() -> &'static str {
     #[cfg(target_os = "windows")]
     {
@@ -1585,11 +1673,20 @@ fn backend_runs_on_current_platform(video_api: RtpVideoApi) -> bool {
 }
 
 pub(crate) fn native_video_backend_capabilities() -> Vec<NativeVideoBackendCapability> {
-    all_rtp_video_apis()
-        .iter()
-        .copied()
-        .map(native_video_backend_capability)
-        .collect()
+    // Registry lookups are thread-safe, and each backend probe is independent,
+    // so probing them concurrently cuts the cold-start cost to the slowest
+    // single backend instead of the sum of all of them.
+    thread::scope(|scope| {
+        let probes: Vec<_> = all_rtp_video_apis()
+            .iter()
+            .copied()
+            .map(|video_api| scope.spawn(move || native_video_backend_capability(video_api)))
+            .collect();
+        probes
+            .into_iter()
+            .map(|probe| probe.join().expect("capability probe thread panicked"))
+            .collect()
+    })
 }
 
 fn native_video_backend_capability(video_api: RtpVideoApi) -> NativeVideoBackendCapability {
@@ -1708,7 +1805,7 @@ fn zero_copy_modes_for_backend(video_api: RtpVideoApi) -> Vec<String> {
         RtpVideoApi::D3D11 => vec!["D3D11Memory".to_owned()],
         RtpVideoApi::D3D12 => vec!["D3D12Memory".to_owned()],
         RtpVideoApi::VideoToolbox => vec!["GLMemory".to_owned()],
-        RtpVideoApi::Vaapi => vec!["VAMemory".to_owned()],
+        RtpVideoApi::Vaapi => vec!["DMABuf".to_owned(), "VAMemory".to_owned()],
         RtpVideoApi::Vulkan => vec!["VulkanImage".to_owned()],
         RtpVideoApi::V4L2 | RtpVideoApi::Software => Vec::new(),
     }
@@ -1717,7 +1814,6 @@ fn zero_copy_modes_for_backend(video_api: RtpVideoApi) -> Vec<String> {
 fn configure_rtp_video_chain_element(
     element: &gst::Element,
     spec: RtpVideoChainSpec,
-    _video_api: RtpVideoApi,
     d3d_fullscreen_sink: bool,
 ) {
     match spec.role {
@@ -1804,62 +1900,175 @@ fn link_rtp_video_pad(
     })?;
     video_liveness.update_hardware_acceleration(format!("GStreamer {}", video_api.label()));
     video_liveness.set_stats_overlay(None);
-    let mut elements = Vec::with_capacity(specs.len());
 
-    let result = (|| -> Result<(), String> {
+    send_log(
+        event_sender,
+        "info",
+        format_video_chain_selection(encoding, video_api, &specs),
+    );
+    if video_api == RtpVideoApi::D3D12 {
         send_log(
             event_sender,
             "info",
-            format_video_chain_selection(encoding, video_api, &specs),
+            format_d3d12_selection_summary(requested_fps),
         );
-        if video_api == RtpVideoApi::D3D12 {
-            send_log(
-                event_sender,
-                "info",
-                format_d3d12_selection_summary(requested_fps),
-            );
-        }
-        let configured_present_max_fps = present_max_fps.load(Ordering::SeqCst);
-        let effective_present_max_fps = effective_present_max_fps(
-            configured_present_max_fps,
-            requested_fps,
-            video_api,
-            primary_display_refresh_hz(),
+    }
+    let configured_present_max_fps = present_max_fps.load(Ordering::SeqCst);
+    let effective_present_max_fps = effective_present_max_fps(
+        configured_present_max_fps,
+        requested_fps,
+        video_api,
+        primary_display_refresh_hz(),
+    );
+    present_max_fps.store(effective_present_max_fps, Ordering::SeqCst);
+    if effective_present_max_fps > 0 {
+        let reason = if configured_present_max_fps == PRESENT_LIMITER_AUTO_SENTINEL {
+            "auto-enabled for the D3D11 path to prevent display-rate present backpressure"
+                .to_owned()
+        } else {
+            format!("configured by {NATIVE_PRESENT_MAX_FPS_ENV}")
+        };
+        send_log(
+            event_sender,
+            "info",
+            format!(
+                "Native present limiter enabled at {effective_present_max_fps} fps for {} video path; reason: {reason}.",
+                video_api.label()
+            ),
         );
-        present_max_fps.store(effective_present_max_fps, Ordering::SeqCst);
-        if effective_present_max_fps > 0 {
-            let reason = if configured_present_max_fps == PRESENT_LIMITER_AUTO_SENTINEL {
-                "auto-enabled for the D3D11 path to prevent display-rate present backpressure"
-                    .to_owned()
-            } else {
-                format!("configured by {NATIVE_PRESENT_MAX_FPS_ENV}")
-            };
-            send_log(
-                event_sender,
-                "info",
-                format!(
-                    "Native present limiter enabled at {effective_present_max_fps} fps for {} video path; reason: {reason}.",
-                    video_api.label()
-                ),
-            );
-        }
-        if d3d_fullscreen_sink {
-            send_log(
-                event_sender,
-                "info",
-                format!(
-                    "Native D3D sink fullscreen presentation enabled for Cloud G-Sync/VRR; set {NATIVE_D3D_FULLSCREEN_ENV}=0 to disable."
-                ),
-            );
-        }
-        for spec in &specs {
+    }
+    if d3d_fullscreen_sink {
+        send_log(
+            event_sender,
+            "info",
+            format!(
+                "Native D3D sink fullscreen presentation enabled for Cloud G-Sync/VRR; set {NATIVE_D3D_FULLSCREEN_ENV}=0 to disable."
+            ),
+        );
+    }
+
+    let zero_copy_caps = rtp_video_chain_zero_copy_caps(&specs);
+    if let Err(error) = build_rtp_video_chain(
+        pipeline,
+        src_pad,
+        encoding,
+        &specs,
+        render_state,
+        event_sender,
+        streaming_reported,
+        present_max_fps.clone(),
+        d3d_fullscreen_sink,
+        video_liveness.clone(),
+    ) {
+        let Some(fallback_specs) = zero_copy_fallback_specs(&specs, video_api) else {
+            return Err(error);
+        };
+        send_log(
+            event_sender,
+            "warn",
+            format!(
+                "{error}; zero-copy GPU presentation with {} could not be linked, retrying RTP {encoding} on the system-memory copy path. Set {NATIVE_ZERO_COPY_ENV}=0 to skip the zero-copy attempt.",
+                zero_copy_caps.as_deref().unwrap_or("GPU memory caps")
+            ),
+        );
+        build_rtp_video_chain(
+            pipeline,
+            src_pad,
+            encoding,
+            &fallback_specs,
+            render_state,
+            event_sender,
+            streaming_reported,
+            present_max_fps,
+            d3d_fullscreen_sink,
+            video_liveness.clone(),
+        )?;
+    } else if let Some(caps) = zero_copy_caps {
+        send_log(
+            event_sender,
+            "info",
+            format!(
+                "Zero-copy GPU presentation active for RTP {encoding}: decoded frames stay in {caps} until the {} sink presents them; mode={}.",
+                video_api.label(),
+                zero_copy_mode().as_str()
+            ),
+        );
+    }
+
+    send_log(
+        event_sender,
+        "info",
+        format!(
+            "Linked RTP {encoding} video through explicit low-latency {} decode chain.",
+            video_api.label()
+        ),
+    );
+    Ok(())
+}
+
+fn rtp_video_chain_zero_copy_caps(specs: &[RtpVideoChainSpec]) -> Option<String> {
+    specs.iter().find_map(|spec| {
+        (spec.role == RtpVideoChainRole::PostDecodeCapsFilter)
+            .then(|| spec.caps.clone())
+            .flatten()
+            .filter(|caps| caps.contains("memory:"))
+    })
+}
+
+// Drops the explicit GPU-memory capsfilter so negotiation can fall back to a
+// CPU-visible copy, re-inserting the raw-video converter the zero-copy chain
+// skipped. Returns None when no copy path exists (Vulkan) or when the chain
+// never carried zero-copy caps in the first place.
+fn zero_copy_fallback_specs(
+    specs: &[RtpVideoChainSpec],
+    video_api: RtpVideoApi,
+) -> Option<Vec<RtpVideoChainSpec>> {
+    if video_api == RtpVideoApi::Vulkan {
+        return None;
+    }
+    let filter_index = specs.iter().position(|spec| {
+        spec.role == RtpVideoChainRole::PostDecodeCapsFilter
+            && spec
+                .caps
+                .as_deref()
+                .is_some_and(|caps| caps.contains("memory:"))
+    })?;
+
+    let mut fallback = specs.to_vec();
+    fallback.remove(filter_index);
+    let has_converter = fallback
+        .iter()
+        .any(|spec| spec.role == RtpVideoChainRole::PostDecodeConverter);
+    if !has_converter
+        && !matches!(video_api, RtpVideoApi::D3D11 | RtpVideoApi::D3D12)
+        && gst::ElementFactory::find("videoconvert").is_some()
+    {
+        fallback.insert(
+            filter_index,
+            RtpVideoChainSpec::new("videoconvert", RtpVideoChainRole::PostDecodeConverter),
+        );
+    }
+    Some(fallback)
+}
+
+fn build_rtp_video_chain(
+    pipeline: &gst::Pipeline,
+    src_pad: &gst::Pad,
+    encoding: &str,
+    specs: &[RtpVideoChainSpec],
+    render_state: &GstreamerRenderState,
+    event_sender: &Option<Sender<Event>>,
+    streaming_reported: &Arc<AtomicBool>,
+    present_max_fps: Arc<AtomicU32>,
+    d3d_fullscreen_sink: bool,
+    video_liveness: VideoLivenessMonitor,
+) -> Result<(), String> {
+    let mut elements = Vec::with_capacity(specs.len());
+
+    let result = (|| -> Result<(), String> {
+        for spec in specs {
             let element = make_element(spec.factory)?;
-            configure_rtp_video_chain_element(
-                &element,
-                spec.clone(),
-                video_api,
-                d3d_fullscreen_sink,
-            );
+            configure_rtp_video_chain_element(&element, spec.clone(), d3d_fullscreen_sink);
             if spec.role == RtpVideoChainRole::StatsOverlay {
                 video_liveness.set_stats_overlay(Some(element.clone()));
             }
@@ -1918,6 +2127,22 @@ fn link_rtp_video_pad(
         {
             video_liveness.set_pre_decode_queue(pre_decode_queue.clone());
         }
+        let latency_tracker = video_liveness.frame_latency_tracker();
+        for (role, tap, pad_name) in [
+            (RtpVideoChainRole::Depayloader, FrameLatencyTap::DepayOut, "src"),
+            (RtpVideoChainRole::PreDecodeQueue, FrameLatencyTap::QueueOut, "src"),
+            (RtpVideoChainRole::Decoder, FrameLatencyTap::DecoderOut, "src"),
+            (RtpVideoChainRole::Sink, FrameLatencyTap::SinkIn, "sink"),
+        ] {
+            if let Some(pad) = specs
+                .iter()
+                .zip(elements.iter())
+                .find_map(|(spec, element)| (spec.role == role).then_some(element))
+                .and_then(|element| element.static_pad(pad_name))
+            {
+                watch_frame_latency(&pad, latency_tracker.clone(), tap);
+            }
+        }
         if let Some(parser) = specs
             .iter()
             .zip(elements.iter())
@@ -1968,16 +2193,7 @@ fn link_rtp_video_pad(
         }
     }
 
-    result?;
-    send_log(
-        event_sender,
-        "info",
-        format!(
-            "Linked RTP {encoding} video through explicit low-latency {} decode chain.",
-            video_api.label()
-        ),
-    );
-    Ok(())
+    result
 }
 
 pub(crate) fn format_video_chain_selection(
@@ -2250,7 +2466,7 @@ fn link_decoded_media_to_fakesink(
         .map_err(|error| format!("Failed to link {label}: {error:?}"))
 }
 
-fn make_element(factory: &str) -> Result<gst::Element, String> {
+pub(crate) fn make_element(factory: &str) -> Result<gst::Element, String> {
     gst::ElementFactory::make(factory)
         .build()
         .map_err(|error| format!("Failed to create GStreamer element {factory}: {error}"))
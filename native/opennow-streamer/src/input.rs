@@ -15,6 +15,9 @@ pub const GAMEPAD_MAX_CONTROLLERS: u8 = 4;
 pub const GAMEPAD_PACKET_SIZE: usize = 38;
 pub const PARTIALLY_RELIABLE_GAMEPAD_MASK_ALL: u32 = (1 << GAMEPAD_MAX_CONTROLLERS) - 1;
 pub const PARTIALLY_RELIABLE_HID_DEVICE_MASK_ALL: u32 = 0xFFFF_FFFF;
+/// Most previous gamepad states a partially reliable packet may repeat
+/// (~45 bytes per copy).
+pub const MAX_INPUT_REDUNDANCY: u8 = 3;
 
 const WRAPPER_LEGACY_INPUT: u8 = 0x21;
 const WRAPPER_SINGLE_INPUT: u8 = 0x22;
@@ -24,6 +27,17 @@ const GAMEPAD_PAYLOAD_SIZE: u16 = 26;
 const GAMEPAD_INNER_SIZE: u16 = 20;
 const GAMEPAD_RESERVED_MARKER: u16 = 85;
 
+const MOUSE_PAYLOAD_SIZE: u16 = 22;
+
+/// Upper bound for a batched wire packet. Keeps batches comfortably below the
+/// typical SCTP datagram MTU so coalesced input never fragments on the data
+/// channel.
+const BATCH_MAX_PACKET_BYTES: usize = 1150;
+/// Worst-case framing overhead of one batched segment: the partially reliable
+/// wrapper (type, controller id, sequence) plus the length-prefixed legacy
+/// wrapper it embeds.
+const BATCH_SEGMENT_MAX_OVERHEAD: usize = 7;
+
 #[derive(Debug, Clone, Copy, PartialEq, Eq)]
 pub struct KeyboardPayload {
     pub keycode: u16,
@@ -65,18 +79,34 @@ pub struct GamepadInput {
     pub timestamp_us: u64,
 }
 
+/// Result of appending an event to the current batch.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum BatchPush {
+    /// The event was appended to the batch in progress.
+    Added,
+    /// The batch cannot hold the event; send `finish_batch()` and start a new
+    /// batch before re-pushing.
+    Full,
+}
+
 #[derive(Debug, Clone)]
 pub struct InputEncoder {
     protocol_version: u8,
     gamepad_sequences: HashMap<u8, u16>,
+    input_redundancy: u8,
+    // Previous partially reliable wire segments per controller, newest
+    // first, repeated into outgoing packets when redundancy is negotiated.
+    gamepad_redundancy_history: HashMap<u8, Vec<Vec<u8>>>,
+    // Reused wire-packet buffer. Both the single-event encode_* methods and
+    // the batch API write into this preallocated arena, so the input hot path
+    // performs no per-event heap allocations once warmed up.
+    scratch: Vec<u8>,
+    batch_events: usize,
 }
 
 impl Default for InputEncoder {
     fn default() -> Self {
-        Self {
-            protocol_version: 2,
-            gamepad_sequences: HashMap::new(),
-        }
+        Self::new(2)
     }
 }
 
@@ -85,6 +115,10 @@ impl InputEncoder {
         Self {
             protocol_version,
             gamepad_sequences: HashMap::new(),
+            input_redundancy: 0,
+            gamepad_redundancy_history: HashMap::new(),
+            scratch: Vec::with_capacity(BATCH_MAX_PACKET_BYTES),
+            batch_events: 0,
         }
     }
 
@@ -98,50 +132,57 @@ impl InputEncoder {
 
     pub fn reset_gamepad_sequences(&mut self) {
         self.gamepad_sequences.clear();
+        self.gamepad_redundancy_history.clear();
     }
 
-    pub fn encode_heartbeat(&self) -> Vec<u8> {
-        let mut payload = Vec::with_capacity(4);
-        put_u32_le(&mut payload, INPUT_HEARTBEAT);
-        payload
+    /// Enables plain-repetition redundancy on the partially reliable gamepad
+    /// path: each packet additionally carries the previous `level` states for
+    /// the same controller under their original sequence numbers. A single
+    /// lost datagram is then repaired by the next packet instead of waiting
+    /// out a retransmit, while the server's sequence tracking discards copies
+    /// that already arrived. 0 (the default) restores 1:1 packets.
+    pub fn set_input_redundancy(&mut self, level: u8) {
+        self.input_redundancy = level.min(MAX_INPUT_REDUNDANCY);
+        if self.input_redundancy == 0 {
+            self.gamepad_redundancy_history.clear();
+        }
+    }
+
+    pub fn encode_heartbeat(&mut self) -> &[u8] {
+        self.scratch.clear();
+        self.batch_events = 0;
+        put_u32_le(&mut self.scratch, INPUT_HEARTBEAT);
+        &self.scratch
     }
 
-    pub fn encode_key_down(&self, payload: KeyboardPayload) -> Vec<u8> {
+    pub fn encode_key_down(&mut self, payload: KeyboardPayload) -> &[u8] {
         self.encode_keyboard(INPUT_KEY_DOWN, payload)
     }
 
-    pub fn encode_key_up(&self, payload: KeyboardPayload) -> Vec<u8> {
+    pub fn encode_key_up(&mut self, payload: KeyboardPayload) -> &[u8] {
         self.encode_keyboard(INPUT_KEY_UP, payload)
     }
 
-    pub fn encode_mouse_move(&self, payload: MouseMovePayload) -> Vec<u8> {
-        let mut bytes = Vec::with_capacity(22);
-        put_u32_le(&mut bytes, INPUT_MOUSE_REL);
-        put_i16_be(&mut bytes, payload.dx);
-        put_i16_be(&mut bytes, payload.dy);
-        put_u16_be(&mut bytes, 0);
-        put_u32_be(&mut bytes, 0);
-        put_u64_be(&mut bytes, payload.timestamp_us);
-        wrap_legacy_input(self.protocol_version, payload.timestamp_us, &bytes)
+    pub fn encode_mouse_move(&mut self, payload: MouseMovePayload) -> &[u8] {
+        self.start_packet(payload.timestamp_us);
+        self.write_legacy_wrapper(MOUSE_PAYLOAD_SIZE);
+        self.write_mouse_payload(INPUT_MOUSE_REL, payload.dx, payload.dy, payload.timestamp_us);
+        &self.scratch
     }
 
-    pub fn encode_mouse_button_down(&self, payload: MouseButtonPayload) -> Vec<u8> {
+    pub fn encode_mouse_button_down(&mut self, payload: MouseButtonPayload) -> &[u8] {
         self.encode_mouse_button(INPUT_MOUSE_BUTTON_DOWN, payload)
     }
 
-    pub fn encode_mouse_button_up(&self, payload: MouseButtonPayload) -> Vec<u8> {
+    pub fn encode_mouse_button_up(&mut self, payload: MouseButtonPayload) -> &[u8] {
         self.encode_mouse_button(INPUT_MOUSE_BUTTON_UP, payload)
     }
 
-    pub fn encode_mouse_wheel(&self, payload: MouseWheelPayload) -> Vec<u8> {
-        let mut bytes = Vec::with_capacity(22);
-        put_u32_le(&mut bytes, INPUT_MOUSE_WHEEL);
-        put_i16_be(&mut bytes, 0);
-        put_i16_be(&mut bytes, payload.delta);
-        put_u16_be(&mut bytes, 0);
-        put_u32_be(&mut bytes, 0);
-        put_u64_be(&mut bytes, payload.timestamp_us);
-        wrap_single_input(self.protocol_version, payload.timestamp_us, &bytes)
+    pub fn encode_mouse_wheel(&mut self, payload: MouseWheelPayload) -> &[u8] {
+        self.start_packet(payload.timestamp_us);
+        self.write_single_wrapper();
+        self.write_mouse_payload(INPUT_MOUSE_WHEEL, 0, payload.delta, payload.timestamp_us);
+        &self.scratch
     }
 
     pub fn encode_gamepad_state(
@@ -149,40 +190,207 @@ impl InputEncoder {
         bitmap: u16,
         input: GamepadInput,
         use_partially_reliable: bool,
-    ) -> Vec<u8> {
-        let payload = encode_gamepad_payload(bitmap, input);
-        if !use_partially_reliable {
-            return wrap_legacy_input(self.protocol_version, input.timestamp_us, &payload);
+    ) -> &[u8] {
+        self.start_packet(input.timestamp_us);
+        self.write_gamepad_segment(bitmap, input, use_partially_reliable);
+        &self.scratch
+    }
+
+    /// Discards any batch in progress and starts a new empty batch.
+    pub fn begin_batch(&mut self) {
+        self.scratch.clear();
+        self.batch_events = 0;
+    }
+
+    /// Appends a mouse move to the current batch. The batched wire packet
+    /// carries one version-marker header followed by length-prefixed legacy
+    /// segments, so several deltas collapse into a single data channel send.
+    pub fn batch_mouse_move(&mut self, payload: MouseMovePayload) -> BatchPush {
+        if !self.batch_has_room(usize::from(MOUSE_PAYLOAD_SIZE)) {
+            return BatchPush::Full;
+        }
+
+        self.batch_packet_header(payload.timestamp_us);
+        self.write_legacy_wrapper(MOUSE_PAYLOAD_SIZE);
+        self.write_mouse_payload(INPUT_MOUSE_REL, payload.dx, payload.dy, payload.timestamp_us);
+        self.batch_events += 1;
+        BatchPush::Added
+    }
+
+    /// Appends a gamepad state to the current batch, alongside any pending
+    /// mouse deltas headed for the same channel.
+    pub fn batch_gamepad_state(
+        &mut self,
+        bitmap: u16,
+        input: GamepadInput,
+        use_partially_reliable: bool,
+    ) -> BatchPush {
+        // Reserve room for the repeated previous states as well, so negotiated
+        // redundancy never pushes a batch past the packet budget.
+        let redundancy_len = if use_partially_reliable {
+            usize::from(self.input_redundancy) * (GAMEPAD_PACKET_SIZE + BATCH_SEGMENT_MAX_OVERHEAD)
+        } else {
+            0
+        };
+        if !self.batch_has_room(GAMEPAD_PACKET_SIZE + redundancy_len) {
+            return BatchPush::Full;
+        }
+
+        self.batch_packet_header(input.timestamp_us);
+        self.write_gamepad_segment(bitmap, input, use_partially_reliable);
+        self.batch_events += 1;
+        BatchPush::Added
+    }
+
+    /// Returns the batched wire packet, or an empty slice when nothing was
+    /// batched. The slice stays valid until the next encode or batch call.
+    pub fn finish_batch(&mut self) -> &[u8] {
+        &self.scratch
+    }
+
+    fn encode_keyboard(&mut self, input_type: u32, payload: KeyboardPayload) -> &[u8] {
+        self.start_packet(payload.timestamp_us);
+        self.write_single_wrapper();
+        put_u32_le(&mut self.scratch, input_type);
+        put_u16_be(&mut self.scratch, payload.keycode);
+        put_u16_be(&mut self.scratch, payload.modifiers);
+        put_u16_be(&mut self.scratch, payload.scancode);
+        put_u64_be(&mut self.scratch, payload.timestamp_us);
+        &self.scratch
+    }
+
+    fn encode_mouse_button(&mut self, input_type: u32, payload: MouseButtonPayload) -> &[u8] {
+        self.start_packet(payload.timestamp_us);
+        self.write_single_wrapper();
+        put_u32_le(&mut self.scratch, input_type);
+        self.scratch.push(payload.button);
+        self.scratch.push(0);
+        put_u32_be(&mut self.scratch, 0);
+        put_u64_be(&mut self.scratch, payload.timestamp_us);
+        &self.scratch
+    }
+
+    fn start_packet(&mut self, timestamp_us: u64) {
+        self.scratch.clear();
+        self.batch_events = 0;
+        if self.protocol_version >= 3 {
+            self.scratch.push(WRAPPER_VERSION_MARKER);
+            put_u64_be(&mut self.scratch, timestamp_us);
         }
+    }
 
-        let sequence = self.next_gamepad_sequence(input.controller_id);
-        wrap_partially_reliable_input(
-            self.protocol_version,
-            input.timestamp_us,
-            input.controller_id,
-            sequence,
-            &payload,
-        )
+    fn batch_packet_header(&mut self, timestamp_us: u64) {
+        // The packet header carries the timestamp of the first batched event;
+        // each segment payload still embeds its own timestamp.
+        if self.batch_events == 0 {
+            self.start_packet(timestamp_us);
+        }
     }
 
-    fn encode_keyboard(&self, input_type: u32, payload: KeyboardPayload) -> Vec<u8> {
-        let mut bytes = Vec::with_capacity(18);
-        put_u32_le(&mut bytes, input_type);
-        put_u16_be(&mut bytes, payload.keycode);
-        put_u16_be(&mut bytes, payload.modifiers);
-        put_u16_be(&mut bytes, payload.scancode);
-        put_u64_be(&mut bytes, payload.timestamp_us);
-        wrap_single_input(self.protocol_version, payload.timestamp_us, &bytes)
+    fn batch_has_room(&self, payload_len: usize) -> bool {
+        if self.batch_events == 0 {
+            return true;
+        }
+        // Protocol v2 packets carry no wrapper framing, so each holds exactly
+        // one event.
+        if self.protocol_version < 3 {
+            return false;
+        }
+        self.scratch.len() + BATCH_SEGMENT_MAX_OVERHEAD + payload_len <= BATCH_MAX_PACKET_BYTES
+    }
+
+    fn write_single_wrapper(&mut self) {
+        if self.protocol_version >= 3 {
+            self.scratch.push(WRAPPER_SINGLE_INPUT);
+        }
+    }
+
+    fn write_legacy_wrapper(&mut self, payload_len: u16) {
+        if self.protocol_version >= 3 {
+            self.scratch.push(WRAPPER_LEGACY_INPUT);
+            put_u16_be(&mut self.scratch, payload_len);
+        }
     }
 
-    fn encode_mouse_button(&self, input_type: u32, payload: MouseButtonPayload) -> Vec<u8> {
-        let mut bytes = Vec::with_capacity(18);
-        put_u32_le(&mut bytes, input_type);
-        bytes.push(payload.button);
-        bytes.push(0);
-        put_u32_be(&mut bytes, 0);
-        put_u64_be(&mut bytes, payload.timestamp_us);
-        wrap_single_input(self.protocol_version, payload.timestamp_us, &bytes)
+    fn write_partially_reliable_wrapper(
+        &mut self,
+        controller_id: u8,
+        sequence: u16,
+        payload_len: u16,
+    ) {
+        if self.protocol_version >= 3 {
+            self.scratch.push(WRAPPER_PARTIALLY_RELIABLE_INPUT);
+            self.scratch.push(controller_id);
+            put_u16_be(&mut self.scratch, sequence);
+            self.write_legacy_wrapper(payload_len);
+        }
+    }
+
+    fn write_mouse_payload(&mut self, input_type: u32, first: i16, second: i16, timestamp_us: u64) {
+        put_u32_le(&mut self.scratch, input_type);
+        put_i16_be(&mut self.scratch, first);
+        put_i16_be(&mut self.scratch, second);
+        put_u16_be(&mut self.scratch, 0);
+        put_u32_be(&mut self.scratch, 0);
+        put_u64_be(&mut self.scratch, timestamp_us);
+    }
+
+    fn write_gamepad_segment(
+        &mut self,
+        bitmap: u16,
+        input: GamepadInput,
+        use_partially_reliable: bool,
+    ) {
+        let apply_redundancy =
+            use_partially_reliable && self.protocol_version >= 3 && self.input_redundancy > 0;
+        let segment_start = self.scratch.len();
+        if use_partially_reliable {
+            let sequence = self.next_gamepad_sequence(input.controller_id);
+            self.write_partially_reliable_wrapper(
+                input.controller_id,
+                sequence,
+                GAMEPAD_PACKET_SIZE as u16,
+            );
+        } else {
+            self.write_legacy_wrapper(GAMEPAD_PACKET_SIZE as u16);
+        }
+
+        put_u32_le(&mut self.scratch, INPUT_GAMEPAD);
+        put_u16_le(&mut self.scratch, GAMEPAD_PAYLOAD_SIZE);
+        put_u16_le(&mut self.scratch, input.controller_id as u16);
+        put_u16_le(&mut self.scratch, bitmap);
+        put_u16_le(&mut self.scratch, GAMEPAD_INNER_SIZE);
+        put_u16_le(&mut self.scratch, input.buttons);
+        put_u16_le(
+            &mut self.scratch,
+            input.left_trigger as u16 | ((input.right_trigger as u16) << 8),
+        );
+        put_i16_le(&mut self.scratch, input.left_stick_x);
+        put_i16_le(&mut self.scratch, input.left_stick_y);
+        put_i16_le(&mut self.scratch, input.right_stick_x);
+        put_i16_le(&mut self.scratch, input.right_stick_y);
+        put_u16_le(&mut self.scratch, 0);
+        put_u16_le(&mut self.scratch, GAMEPAD_RESERVED_MARKER);
+        put_u16_le(&mut self.scratch, 0);
+        put_u64_le(&mut self.scratch, input.timestamp_us);
+
+        if apply_redundancy {
+            // Plain-repetition FEC: repeat the previous states for this
+            // controller (original sequence numbers kept) after the fresh
+            // segment, then remember the fresh segment for the next packet.
+            let segment = self.scratch[segment_start..].to_vec();
+            let mut history = self
+                .gamepad_redundancy_history
+                .remove(&input.controller_id)
+                .unwrap_or_default();
+            for previous in &history {
+                self.scratch.extend_from_slice(previous);
+            }
+            history.insert(0, segment);
+            history.truncate(usize::from(self.input_redundancy));
+            self.gamepad_redundancy_history
+                .insert(input.controller_id, history);
+        }
     }
 
     fn next_gamepad_sequence(&mut self, controller_id: u8) -> u16 {
@@ -330,79 +538,6 @@ pub(crate) fn layout_mapped_keyboard_keycode(fallback_keycode: u16, physical_sca
     }
 }
 
-fn encode_gamepad_payload(bitmap: u16, input: GamepadInput) -> Vec<u8> {
-    let mut payload = Vec::with_capacity(GAMEPAD_PACKET_SIZE);
-    put_u32_le(&mut payload, INPUT_GAMEPAD);
-    put_u16_le(&mut payload, GAMEPAD_PAYLOAD_SIZE);
-    put_u16_le(&mut payload, input.controller_id as u16);
-    put_u16_le(&mut payload, bitmap);
-    put_u16_le(&mut payload, GAMEPAD_INNER_SIZE);
-    put_u16_le(&mut payload, input.buttons);
-    put_u16_le(
-        &mut payload,
-        input.left_trigger as u16 | ((input.right_trigger as u16) << 8),
-    );
-    put_i16_le(&mut payload, input.left_stick_x);
-    put_i16_le(&mut payload, input.left_stick_y);
-    put_i16_le(&mut payload, input.right_stick_x);
-    put_i16_le(&mut payload, input.right_stick_y);
-    put_u16_le(&mut payload, 0);
-    put_u16_le(&mut payload, GAMEPAD_RESERVED_MARKER);
-    put_u16_le(&mut payload, 0);
-    put_u64_le(&mut payload, input.timestamp_us);
-    payload
-}
-
-fn wrap_single_input(protocol_version: u8, timestamp_us: u64, payload: &[u8]) -> Vec<u8> {
-    if protocol_version < 3 {
-        return payload.to_vec();
-    }
-
-    let mut bytes = Vec::with_capacity(10 + payload.len());
-    bytes.push(WRAPPER_VERSION_MARKER);
-    put_u64_be(&mut bytes, timestamp_us);
-    bytes.push(WRAPPER_SINGLE_INPUT);
-    bytes.extend_from_slice(payload);
-    bytes
-}
-
-fn wrap_legacy_input(protocol_version: u8, timestamp_us: u64, payload: &[u8]) -> Vec<u8> {
-    if protocol_version < 3 {
-        return payload.to_vec();
-    }
-
-    let mut bytes = Vec::with_capacity(12 + payload.len());
-    bytes.push(WRAPPER_VERSION_MARKER);
-    put_u64_be(&mut bytes, timestamp_us);
-    bytes.push(WRAPPER_LEGACY_INPUT);
-    put_u16_be(&mut bytes, payload.len() as u16);
-    bytes.extend_from_slice(payload);
-    bytes
-}
-
-fn wrap_partially_reliable_input(
-    protocol_version: u8,
-    timestamp_us: u64,
-    controller_id: u8,
-    sequence: u16,
-    payload: &[u8],
-) -> Vec<u8> {
-    if protocol_version < 3 {
-        return payload.to_vec();
-    }
-
-    let mut bytes = Vec::with_capacity(15 + payload.len());
-    bytes.push(WRAPPER_VERSION_MARKER);
-    put_u64_be(&mut bytes, timestamp_us);
-    bytes.push(WRAPPER_PARTIALLY_RELIABLE_INPUT);
-    bytes.push(controller_id);
-    put_u16_be(&mut bytes, sequence);
-    bytes.push(WRAPPER_LEGACY_INPUT);
-    put_u16_be(&mut bytes, payload.len() as u16);
-    bytes.extend_from_slice(payload);
-    bytes
-}
-
 fn put_u16_be(bytes: &mut Vec<u8>, value: u16) {
     bytes.extend_from_slice(&value.to_be_bytes());
 }
@@ -441,13 +576,13 @@ mod tests {
 
     #[test]
     fn encodes_heartbeat_as_raw_little_endian_type() {
-        let encoder = InputEncoder::default();
-        assert_eq!(encoder.encode_heartbeat(), vec![2, 0, 0, 0]);
+        let mut encoder = InputEncoder::default();
+        assert_eq!(encoder.encode_heartbeat(), &[2, 0, 0, 0]);
     }
 
     #[test]
     fn encodes_protocol_v2_keyboard_without_wrapper() {
-        let encoder = InputEncoder::new(2);
+        let mut encoder = InputEncoder::new(2);
         let payload = encoder.encode_key_down(KeyboardPayload {
             keycode: 0x0041,
             scancode: 0x001e,
@@ -458,7 +593,7 @@ mod tests {
         assert_eq!(payload.len(), 18);
         assert_eq!(
             payload,
-            vec![
+            &[
                 0x03, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x02, 0x00, 0x1e, 0x01, 0x02, 0x03, 0x04,
                 0x05, 0x06, 0x07, 0x08,
             ],
@@ -467,7 +602,7 @@ mod tests {
 
     #[test]
     fn wraps_protocol_v3_keyboard_as_single_input() {
-        let encoder = InputEncoder::new(3);
+        let mut encoder = InputEncoder::new(3);
         let payload = encoder.encode_key_up(KeyboardPayload {
             keycode: 0x0041,
             scancode: 0x001e,
@@ -484,7 +619,7 @@ mod tests {
 
     #[test]
     fn wraps_protocol_v3_mouse_move_with_payload_size() {
-        let encoder = InputEncoder::new(3);
+        let mut encoder = InputEncoder::new(3);
         let payload = encoder.encode_mouse_move(MouseMovePayload {
             dx: -2,
             dy: 300,
@@ -502,11 +637,13 @@ mod tests {
 
     #[test]
     fn encodes_mouse_button_and_wheel_payloads() {
-        let encoder = InputEncoder::new(2);
-        let button = encoder.encode_mouse_button_down(MouseButtonPayload {
-            button: 1,
-            timestamp_us: 5,
-        });
+        let mut encoder = InputEncoder::new(2);
+        let button = encoder
+            .encode_mouse_button_down(MouseButtonPayload {
+                button: 1,
+                timestamp_us: 5,
+            })
+            .to_vec();
         assert_eq!(button.len(), 18);
         assert_eq!(&button[0..4], &[0x08, 0, 0, 0]);
         assert_eq!(button[4], 1);
@@ -538,7 +675,7 @@ mod tests {
             timestamp_us: 11,
         };
 
-        let reliable = encoder.encode_gamepad_state(0x00ff, input, false);
+        let reliable = encoder.encode_gamepad_state(0x00ff, input, false).to_vec();
         assert_eq!(reliable.len(), 50);
         assert_eq!(reliable[9], WRAPPER_LEGACY_INPUT);
         assert_eq!(&reliable[10..12], &[0, GAMEPAD_PACKET_SIZE as u8]);
@@ -554,7 +691,7 @@ mod tests {
         assert_eq!(&raw[26..28], &GAMEPAD_RESERVED_MARKER.to_le_bytes());
         assert_eq!(&raw[30..38], &11_u64.to_le_bytes());
 
-        let partially_reliable = encoder.encode_gamepad_state(0x00ff, input, true);
+        let partially_reliable = encoder.encode_gamepad_state(0x00ff, input, true).to_vec();
         assert_eq!(partially_reliable.len(), 54);
         assert_eq!(partially_reliable[9], WRAPPER_PARTIALLY_RELIABLE_INPUT);
         assert_eq!(partially_reliable[10], 2);
@@ -562,14 +699,218 @@ mod tests {
         assert_eq!(partially_reliable[13], WRAPPER_LEGACY_INPUT);
         assert_eq!(&partially_reliable[14..16], &[0, GAMEPAD_PACKET_SIZE as u8]);
 
-        let next = encoder.encode_gamepad_state(0x00ff, input, true);
+        let next = encoder.encode_gamepad_state(0x00ff, input, true).to_vec();
         assert_eq!(&next[11..13], &2_u16.to_be_bytes());
 
         encoder.reset_gamepad_sequences();
-        let reset = encoder.encode_gamepad_state(0x00ff, input, true);
+        let reset = encoder.encode_gamepad_state(0x00ff, input, true).to_vec();
         assert_eq!(&reset[11..13], &1_u16.to_be_bytes());
     }
 
+    #[test]
+    fn repeats_previous_partially_reliable_gamepad_states_when_redundant() {
+        const SEGMENT_SIZE: usize = 7 + GAMEPAD_PACKET_SIZE;
+        let mut encoder = InputEncoder::new(3);
+        encoder.set_input_redundancy(2);
+        let state = |controller_id: u8, buttons: u16| GamepadInput {
+            controller_id,
+            buttons,
+            left_trigger: 0,
+            right_trigger: 0,
+            left_stick_x: 0,
+            left_stick_y: 0,
+            right_stick_x: 0,
+            right_stick_y: 0,
+            connected: true,
+            timestamp_us: 1,
+        };
+        let read_segment = |packet: &[u8], index: usize| {
+            let offset = 9 + index * SEGMENT_SIZE;
+            assert_eq!(packet[offset], WRAPPER_PARTIALLY_RELIABLE_INPUT);
+            let sequence = u16::from_be_bytes([packet[offset + 2], packet[offset + 3]]);
+            let buttons = u16::from_le_bytes([packet[offset + 19], packet[offset + 20]]);
+            (packet[offset + 1], sequence, buttons)
+        };
+
+        let first = encoder
+            .encode_gamepad_state(0x0102, state(1, 0x1000), true)
+            .to_vec();
+        assert_eq!(first.len(), 9 + SEGMENT_SIZE);
+
+        let second = encoder
+            .encode_gamepad_state(0x0102, state(1, 0x2000), true)
+            .to_vec();
+        assert_eq!(second.len(), 9 + 2 * SEGMENT_SIZE);
+
+        // Fresh state first, then the previous copies with their original
+        // sequence numbers so the server's de-dup discards what it already saw.
+        let third = encoder
+            .encode_gamepad_state(0x0102, state(1, 0x4000), true)
+            .to_vec();
+        assert_eq!(third.len(), 9 + 3 * SEGMENT_SIZE);
+        assert_eq!(read_segment(&third, 0), (1, 3, 0x4000));
+        assert_eq!(read_segment(&third, 1), (1, 2, 0x2000));
+        assert_eq!(read_segment(&third, 2), (1, 1, 0x1000));
+
+        // History stays capped at the negotiated level.
+        let fourth = encoder
+            .encode_gamepad_state(0x0102, state(1, 0x8000), true)
+            .to_vec();
+        assert_eq!(fourth.len(), 9 + 3 * SEGMENT_SIZE);
+        assert_eq!(read_segment(&fourth, 2), (1, 2, 0x2000));
+
+        // Each controller keeps its own history.
+        let other = encoder
+            .encode_gamepad_state(0x0102, state(2, 0x1000), true)
+            .to_vec();
+        assert_eq!(other.len(), 9 + SEGMENT_SIZE);
+
+        encoder.set_input_redundancy(0);
+        let plain = encoder
+            .encode_gamepad_state(0x0102, state(1, 0x1000), true)
+            .to_vec();
+        assert_eq!(plain.len(), 9 + SEGMENT_SIZE);
+
+        encoder.set_input_redundancy(2);
+        encoder.reset_gamepad_sequences();
+        let after_reset = encoder
+            .encode_gamepad_state(0x0102, state(1, 0x1000), true)
+            .to_vec();
+        assert_eq!(after_reset.len(), 9 + SEGMENT_SIZE);
+        assert_eq!(read_segment(&after_reset, 0), (1, 1, 0x1000));
+    }
+
+    #[test]
+    fn batches_multiple_mouse_moves_into_one_packet() {
+        let mut encoder = InputEncoder::new(3);
+        encoder.begin_batch();
+        for index in 0..3_i16 {
+            assert_eq!(
+                encoder.batch_mouse_move(MouseMovePayload {
+                    dx: index + 1,
+                    dy: -(index + 1),
+                    timestamp_us: 100 + index as u64,
+                }),
+                BatchPush::Added,
+            );
+        }
+
+        let packet = encoder.finish_batch();
+        // Header (marker + timestamp) plus three length-prefixed segments.
+        assert_eq!(packet.len(), 9 + 3 * 25);
+        assert_eq!(packet[0], WRAPPER_VERSION_MARKER);
+        assert_eq!(&packet[1..9], &100_u64.to_be_bytes());
+        for index in 0..3 {
+            let segment = &packet[9 + index * 25..9 + (index + 1) * 25];
+            assert_eq!(segment[0], WRAPPER_LEGACY_INPUT);
+            assert_eq!(&segment[1..3], &[0, 22]);
+            assert_eq!(&segment[3..7], &[0x07, 0x00, 0x00, 0x00]);
+            assert_eq!(&segment[7..9], &((index as i16) + 1).to_be_bytes());
+            assert_eq!(&segment[17..25], &(100 + index as u64).to_be_bytes());
+        }
+    }
+
+    #[test]
+    fn batches_mouse_moves_with_gamepad_state() {
+        let mut encoder = InputEncoder::new(3);
+        encoder.begin_batch();
+        assert_eq!(
+            encoder.batch_mouse_move(MouseMovePayload {
+                dx: 4,
+                dy: 5,
+                timestamp_us: 20,
+            }),
+            BatchPush::Added,
+        );
+        assert_eq!(
+            encoder.batch_gamepad_state(
+                0x0001,
+                GamepadInput {
+                    controller_id: 0,
+                    buttons: 1,
+                    left_trigger: 0,
+                    right_trigger: 0,
+                    left_stick_x: 0,
+                    left_stick_y: 0,
+                    right_stick_x: 0,
+                    right_stick_y: 0,
+                    connected: true,
+                    timestamp_us: 21,
+                },
+                true,
+            ),
+            BatchPush::Added,
+        );
+
+        let packet = encoder.finish_batch();
+        assert_eq!(packet.len(), 9 + 25 + 7 + GAMEPAD_PACKET_SIZE);
+        assert_eq!(packet[9], WRAPPER_LEGACY_INPUT);
+        let gamepad = &packet[34..];
+        assert_eq!(gamepad[0], WRAPPER_PARTIALLY_RELIABLE_INPUT);
+        assert_eq!(gamepad[1], 0);
+        assert_eq!(&gamepad[2..4], &1_u16.to_be_bytes());
+        assert_eq!(gamepad[4], WRAPPER_LEGACY_INPUT);
+        assert_eq!(&gamepad[5..7], &[0, GAMEPAD_PACKET_SIZE as u8]);
+    }
+
+    #[test]
+    fn batch_reports_full_at_packet_budget() {
+        let mut encoder = InputEncoder::new(3);
+        encoder.begin_batch();
+        let mut added = 0_u64;
+        loop {
+            let push = encoder.batch_mouse_move(MouseMovePayload {
+                dx: 1,
+                dy: 1,
+                timestamp_us: added,
+            });
+            if push == BatchPush::Full {
+                break;
+            }
+            added += 1;
+        }
+
+        assert!(added > 1);
+        assert!(encoder.finish_batch().len() <= BATCH_MAX_PACKET_BYTES);
+
+        // A fresh batch accepts the overflowing event again.
+        encoder.begin_batch();
+        assert_eq!(
+            encoder.batch_mouse_move(MouseMovePayload {
+                dx: 1,
+                dy: 1,
+                timestamp_us: added,
+            }),
+            BatchPush::Added,
+        );
+    }
+
+    #[test]
+    fn protocol_v2_batches_hold_one_event_per_packet() {
+        let mut encoder = InputEncoder::new(2);
+        encoder.begin_batch();
+        assert_eq!(
+            encoder.batch_mouse_move(MouseMovePayload {
+                dx: 1,
+                dy: 2,
+                timestamp_us: 3,
+            }),
+            BatchPush::Added,
+        );
+        assert_eq!(
+            encoder.batch_mouse_move(MouseMovePayload {
+                dx: 4,
+                dy: 5,
+                timestamp_us: 6,
+            }),
+            BatchPush::Full,
+        );
+
+        // Without the v3 wrapper there is no segment framing: the packet is
+        // the raw single-event payload.
+        assert_eq!(encoder.finish_batch().len(), 22);
+    }
+
     #[test]
     fn computes_partially_reliable_hid_masks() {
         assert_eq!(
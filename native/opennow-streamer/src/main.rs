@@ -1,13 +1,20 @@
 #![cfg_attr(all(windows, not(debug_assertions)), windows_subsystem = "windows")]
 
 mod backend;
+mod binary_transport;
 #[cfg(feature = "gstreamer")]
 mod gstreamer_backend;
 #[cfg(feature = "gstreamer")]
+mod gstreamer_benchmark;
+#[cfg(feature = "gstreamer")]
+mod gstreamer_capabilities;
+#[cfg(feature = "gstreamer")]
 mod gstreamer_config;
 #[cfg(feature = "gstreamer")]
 mod gstreamer_input;
 #[cfg(feature = "gstreamer")]
+mod gstreamer_latency;
+#[cfg(feature = "gstreamer")]
 mod gstreamer_liveness;
 #[cfg(feature = "gstreamer")]
 mod gstreamer_pipeline;
@@ -27,7 +34,8 @@ use std::sync::mpsc;
 use std::thread;
 
 use backend::{create_backend, BackendReply, NativeStreamerBackend};
-use protocol::{parse_command, CommandEnvelope, Event, Response, PROTOCOL_VERSION};
+use binary_transport::{BinaryInputFrame, BinaryTransport};
+use protocol::{parse_command, CommandEnvelope, Event, NativeInputPacket, Response, PROTOCOL_VERSION};
 
 fn write_json<T: Serialize>(value: &T) -> io::Result<()> {
     let mut stdout = io::stdout().lock();
@@ -104,6 +112,9 @@ fn handle_command(
         "update-shortcuts" => {
             return write_reply(backend.update_shortcuts(command));
         }
+        "benchmark-decoders" => {
+            return write_reply(backend.benchmark_decoders(command));
+        }
         "stop" => {
             return write_reply(backend.stop(command));
         }
@@ -119,11 +130,54 @@ fn handle_command(
     Ok(true)
 }
 
+enum LoopMessage {
+    Line(String),
+    BinaryInput(BinaryInputFrame),
+    StdinClosed,
+}
+
+fn binary_input_command(frame: BinaryInputFrame) -> CommandEnvelope {
+    CommandEnvelope {
+        id: String::new(),
+        command_type: "input".to_owned(),
+        protocol_version: None,
+        context: None,
+        sdp: None,
+        candidate: None,
+        input: Some(NativeInputPacket {
+            payload: frame.payload,
+            payload_base64: None,
+            partially_reliable: frame.partially_reliable,
+        }),
+        surface: None,
+        max_bitrate_kbps: None,
+        reason: None,
+        shortcuts: None,
+    }
+}
+
 fn main() -> io::Result<()> {
-    let stdin = io::stdin();
+    let (loop_sender, loop_receiver) = mpsc::channel::<LoopMessage>();
     let (event_sender, event_receiver) = mpsc::channel::<Event>();
+
+    // High-rate input and stats traffic moves to the negotiated binary channel
+    // when the Electron side published an endpoint; stdio keeps control flow.
+    let binary_transport = BinaryTransport::default();
+    let binary_input_sender = loop_sender.clone();
+    binary_transport.start_from_env(move |frame| {
+        let _ = binary_input_sender.send(LoopMessage::BinaryInput(frame));
+    });
+
+    let writer_transport = binary_transport.clone();
     let event_writer = thread::spawn(move || {
         for event in event_receiver {
+            // Stats prefer the fixed-layout frame; the JSON event frame covers
+            // the rare encode failure, and stdio covers a missing channel.
+            if let Event::Stats { stats } = &event {
+                if writer_transport.send_stats(stats) || writer_transport.send_event(&event) {
+                    continue;
+                }
+            }
             if let Err(error) = write_event(&event) {
                 eprintln!("[NativeStreamer] Failed to write async event: {error}");
                 break;
@@ -132,8 +186,31 @@ fn main() -> io::Result<()> {
     });
     let mut backend = create_backend(Some(event_sender));
 
-    for line in stdin.lock().lines() {
-        let line = line?;
+    thread::spawn(move || {
+        let stdin = io::stdin();
+        for line in stdin.lock().lines() {
+            let Ok(line) = line else {
+                break;
+            };
+            if loop_sender.send(LoopMessage::Line(line)).is_err() {
+                return;
+            }
+        }
+        let _ = loop_sender.send(LoopMessage::StdinClosed);
+    });
+
+    for message in loop_receiver {
+        let line = match message {
+            LoopMessage::Line(line) => line,
+            LoopMessage::BinaryInput(frame) => {
+                if !write_reply(backend.send_input(binary_input_command(frame)))? {
+                    break;
+                }
+                continue;
+            }
+            LoopMessage::StdinClosed => break,
+        };
+
         let trimmed = line.trim();
         if trimmed.is_empty() {
             continue;
@@ -136,6 +136,10 @@ pub struct NegotiatedStreamProfile {
     pub fps: Option<u32>,
     #[serde(default)]
     pub codec: Option<VideoCodec>,
+    /// Client-side frame-pacing hint: the fps the renderer measured it can
+    /// present at a judder-free divisor of the panel refresh rate.
+    #[serde(default)]
+    pub pacing_fps_hint: Option<u32>,
 }
 
 #[derive(Debug, Clone, Copy, Default, Deserialize, Serialize, PartialEq, Eq)]
@@ -329,7 +333,7 @@ pub struct NativeStreamerCapabilities {
     pub video_backends: Vec<NativeVideoBackendCapability>,
 }
 
-#[derive(Debug, Clone, Serialize)]
+#[derive(Debug, Clone, Serialize, Deserialize)]
 #[serde(rename_all = "camelCase")]
 pub struct NativeVideoBackendCapability {
     pub backend: String,
@@ -344,7 +348,7 @@ pub struct NativeVideoBackendCapability {
     pub reason: Option<String>,
 }
 
-#[derive(Debug, Clone, Serialize)]
+#[derive(Debug, Clone, Serialize, Deserialize)]
 #[serde(rename_all = "camelCase")]
 pub struct NativeVideoCodecCapability {
     pub codec: String,
@@ -500,6 +504,26 @@ pub struct NativeStatsEvent {
     pub zero_copy_d3d12: bool,
 }
 
+/// Windowed latency percentiles for one pipeline stage.
+#[derive(Debug, Clone, Copy, Serialize)]
+#[serde(rename_all = "camelCase")]
+pub struct FrameLatencyStageStats {
+    pub p50_ms: f64,
+    pub p99_ms: f64,
+    pub samples: u32,
+}
+
+/// Per-stage frame latency breakdown measured between the pad probes inside
+/// the native video chain: depayloader -> pre-decode queue out (queue wait),
+/// queue out -> decoder out (decode), decoder out -> sink (present).
+#[derive(Debug, Clone, Copy, Serialize)]
+#[serde(rename_all = "camelCase")]
+pub struct FrameLatencyStatsEvent {
+    pub queue_wait: FrameLatencyStageStats,
+    pub decode: FrameLatencyStageStats,
+    pub present: FrameLatencyStageStats,
+}
+
 #[derive(Debug, Clone, Serialize)]
 #[allow(dead_code)]
 #[serde(tag = "type")]
@@ -532,6 +556,8 @@ pub enum Event {
     VideoTransition { transition: VideoTransitionEvent },
     #[serde(rename = "stats")]
     Stats { stats: NativeStatsEvent },
+    #[serde(rename = "frame-latency")]
+    FrameLatency { latency: FrameLatencyStatsEvent },
     #[serde(rename = "error")]
     Error { code: String, message: String },
 }
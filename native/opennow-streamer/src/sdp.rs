@@ -1,9 +1,13 @@
 #![allow(dead_code)]
 
 use regex::Regex;
+use std::borrow::Cow;
 use std::collections::{HashMap, HashSet};
 
-use crate::input::{PARTIALLY_RELIABLE_GAMEPAD_MASK_ALL, PARTIALLY_RELIABLE_HID_DEVICE_MASK_ALL};
+use crate::input::{
+    MAX_INPUT_REDUNDANCY, PARTIALLY_RELIABLE_GAMEPAD_MASK_ALL,
+    PARTIALLY_RELIABLE_HID_DEVICE_MASK_ALL,
+};
 use crate::protocol::{ColorQuality, VideoCodec};
 
 // Match the official web client's 240 FPS profile. Disabling split encode at
@@ -71,79 +75,15 @@ pub fn extract_public_ip(host_or_ip: &str) -> Option<String> {
 }
 
 pub fn fix_server_ip(sdp: &str, server_ip: &str) -> String {
-    let Some(ip) = extract_public_ip(server_ip) else {
-        return sdp.to_owned();
-    };
-
-    let fixed = sdp.replace("c=IN IP4 0.0.0.0", &format!("c=IN IP4 {ip}"));
-    let candidate_re =
-        Regex::new(r"(a=candidate:\S+\s+\d+\s+\w+\s+\d+\s+)0\.0\.0\.0(\s+)").expect("valid regex");
-    candidate_re
-        .replace_all(&fixed, format!("${{1}}{ip}${{2}}"))
-        .into_owned()
+    let mut table = SdpLineTable::parse(sdp);
+    table.fix_server_ip(server_ip);
+    table.emit()
 }
 
 pub fn duplicate_session_webrtc_attributes_to_media(sdp: &str) -> String {
-    let ending = line_ending(sdp);
-    let lines = split_lines_lossless(sdp);
-    let first_media_index = lines.iter().position(|line| line.starts_with("m="));
-    let Some(first_media_index) = first_media_index else {
-        return sdp.to_owned();
-    };
-
-    let session_attributes: Vec<&str> = lines[..first_media_index]
-        .iter()
-        .copied()
-        .filter(|line| {
-            line.starts_with("a=ice-ufrag:")
-                || line.starts_with("a=ice-pwd:")
-                || line.starts_with("a=ice-options:")
-                || line.starts_with("a=fingerprint:")
-                || line.starts_with("a=setup:")
-        })
-        .collect();
-
-    if session_attributes.is_empty() {
-        return sdp.to_owned();
-    }
-
-    let mut output: Vec<String> = lines[..first_media_index]
-        .iter()
-        .filter(|line| !is_media_transport_attribute(line))
-        .map(|line| (*line).to_owned())
-        .collect();
-
-    let mut index = first_media_index;
-    while index < lines.len() {
-        let section_start = index;
-        index += 1;
-        while index < lines.len() && !lines[index].starts_with("m=") {
-            index += 1;
-        }
-        let section = &lines[section_start..index];
-        let insert_index = section
-            .iter()
-            .position(|line| line.starts_with("a="))
-            .unwrap_or(section.len());
-
-        for line in &section[..insert_index] {
-            output.push((*line).to_owned());
-        }
-        for attribute in &session_attributes {
-            let prefix = attribute
-                .split_once(':')
-                .map(|(prefix, _)| format!("{prefix}:"))
-                .unwrap_or_else(|| (*attribute).to_owned());
-            if !section.iter().any(|line| line.starts_with(&prefix)) {
-                output.push((*attribute).to_owned());
-            }
-        }
-        for line in &section[insert_index..] {
-            output.push((*line).to_owned());
-        }
-    }
-
-    output.join(ending)
+    let mut table = SdpLineTable::parse(sdp);
+    table.duplicate_session_webrtc_attributes_to_media();
+    table.emit()
 }
 
 pub fn summarize_media_transport_attributes(sdp: &str) -> String {
@@ -192,26 +132,9 @@ pub fn summarize_media_transport_attributes(sdp: &str) -> String {
 }
 
 pub fn sanitize_ice_pwd_for_gstreamer(sdp: &str) -> (String, usize) {
-    let ending = line_ending(sdp);
-    let mut replacements = 0usize;
-    let lines = split_lines_lossless(sdp)
-        .into_iter()
-        .map(|line| {
-            let Some(value) = line.strip_prefix("a=ice-pwd:") else {
-                return line.to_owned();
-            };
-
-            let sanitized = sanitize_ice_pwd_value(value);
-            if sanitized == value {
-                return line.to_owned();
-            }
-
-            replacements += 1;
-            format!("a=ice-pwd:{sanitized}")
-        })
-        .collect::<Vec<_>>();
-
-    (lines.join(ending), replacements)
+    let mut table = SdpLineTable::parse(sdp);
+    let replacements = table.sanitize_ice_pwd_for_gstreamer();
+    (table.emit(), replacements)
 }
 
 fn sanitize_ice_pwd_value(value: &str) -> String {
@@ -285,6 +208,18 @@ fn extract_fingerprint_value(line: &str) -> Option<&str> {
     }
 }
 
+/// Reads the `a=ri.inputRedundancy:` attribute from the server offer: how many
+/// previous gamepad states each partially reliable packet should repeat.
+/// Missing or malformed values fall back to 0 (no redundancy), and advertised
+/// levels are clamped to [`MAX_INPUT_REDUNDANCY`].
+pub fn parse_input_redundancy(sdp: &str) -> u8 {
+    sdp.lines()
+        .find_map(|line| line.trim().strip_prefix("a=ri.inputRedundancy:"))
+        .and_then(|value| value.trim().parse::<u8>().ok())
+        .unwrap_or(0)
+        .min(MAX_INPUT_REDUNDANCY)
+}
+
 pub fn build_nvst_sdp_for_answer(params: &NvstParams, answer_sdp: &str) -> Result<String, String> {
     let credentials = extract_ice_credentials(answer_sdp);
     if credentials.ufrag.is_empty()
@@ -371,193 +306,505 @@ fn split_lines_lossless(sdp: &str) -> Vec<&str> {
         .collect()
 }
 
-pub fn prefer_codec(sdp: &str, codec: VideoCodec, options: PreferCodecOptions) -> String {
-    let ending = line_ending(sdp);
-    let lines = split_lines_lossless(sdp);
-    let target_codec = codec.as_str();
-    let mut in_video_section = false;
-    let mut payload_types_by_codec: HashMap<String, Vec<String>> = HashMap::new();
-    let mut codec_by_payload_type: HashMap<String, String> = HashMap::new();
-    let mut rtx_apt_by_payload_type: HashMap<String, String> = HashMap::new();
-    let mut fmtp_by_payload_type: HashMap<String, String> = HashMap::new();
+/// Indexed line table over one SDP document. Offer preparation runs a chain
+/// of rewrites on the session-start critical path (and again on every
+/// reconnect), so instead of each transform re-splitting and re-joining the
+/// whole document, the document is parsed into the table once, transforms
+/// edit lines in place (untouched lines stay borrowed from the source), and
+/// [`SdpLineTable::emit`] writes the result with a single output allocation.
+pub struct SdpLineTable<'a> {
+    ending: &'static str,
+    trailing_ending: bool,
+    lines: Vec<SdpLine<'a>>,
+}
 
-    for line in &lines {
-        if line.starts_with("m=video") {
-            in_video_section = true;
-            continue;
+enum SdpLine<'a> {
+    /// Unmodified line borrowed from the source document.
+    Source(&'a str),
+    /// Line rewritten or inserted by a transform.
+    Owned(String),
+    /// Dropped line. The slot stays so earlier indices remain valid.
+    Removed,
+}
+
+impl SdpLine<'_> {
+    fn text(&self) -> Option<&str> {
+        match self {
+            Self::Source(line) => Some(line),
+            Self::Owned(line) => Some(line.as_str()),
+            Self::Removed => None,
         }
-        if line.starts_with("m=") && in_video_section {
-            in_video_section = false;
+    }
+}
+
+impl<'a> SdpLineTable<'a> {
+    pub fn parse(sdp: &'a str) -> Self {
+        let ending = line_ending(sdp);
+        Self {
+            ending,
+            trailing_ending: sdp.ends_with(ending),
+            lines: split_lines_lossless(sdp)
+                .into_iter()
+                .map(SdpLine::Source)
+                .collect(),
         }
-        if !in_video_section || !line.starts_with("a=rtpmap:") {
-            continue;
+    }
+
+    fn text(&self, index: usize) -> Option<&str> {
+        self.lines.get(index).and_then(SdpLine::text)
+    }
+
+    fn live_lines(&self) -> impl Iterator<Item = (usize, &str)> {
+        self.lines
+            .iter()
+            .enumerate()
+            .filter_map(|(index, line)| line.text().map(|text| (index, text)))
+    }
+
+    fn replace(&mut self, index: usize, line: String) {
+        self.lines[index] = SdpLine::Owned(line);
+    }
+
+    fn remove(&mut self, index: usize) {
+        self.lines[index] = SdpLine::Removed;
+    }
+
+    fn insert(&mut self, index: usize, line: String) {
+        self.lines.insert(index, SdpLine::Owned(line));
+    }
+
+    /// Writes the current document with one allocation, preserving the source
+    /// line-ending style and trailing terminator.
+    pub fn emit(&self) -> String {
+        let mut text_len = 0usize;
+        let mut live = 0usize;
+        for line in &self.lines {
+            if let Some(text) = line.text() {
+                text_len += text.len();
+                live += 1;
+            }
+        }
+        if live == 0 {
+            return String::new();
         }
 
-        let rest = line.strip_prefix("a=rtpmap:").unwrap_or_default();
-        let mut parts = rest.split_whitespace();
-        let Some(pt) = parts.next() else {
-            continue;
-        };
-        let Some(codec_part) = parts.next() else {
-            continue;
+        let separators = live - 1 + usize::from(self.trailing_ending);
+        let mut output = String::with_capacity(text_len + separators * self.ending.len());
+        let mut first = true;
+        for line in &self.lines {
+            let Some(text) = line.text() else { continue };
+            if !first {
+                output.push_str(self.ending);
+            }
+            output.push_str(text);
+            first = false;
+        }
+        if self.trailing_ending {
+            output.push_str(self.ending);
+        }
+        output
+    }
+
+    /// Rewrites `0.0.0.0` connection and candidate addresses to the server's
+    /// public IP. No-op when the address cannot be derived.
+    pub fn fix_server_ip(&mut self, server_ip: &str) {
+        let Some(ip) = extract_public_ip(server_ip) else {
+            return;
         };
-        let codec_name = normalize_codec(codec_part.split('/').next().unwrap_or_default());
-        if codec_name.is_empty() {
-            continue;
+
+        let connection_replacement = format!("c=IN IP4 {ip}");
+        let candidate_re = Regex::new(r"(a=candidate:\S+\s+\d+\s+\w+\s+\d+\s+)0\.0\.0\.0(\s+)")
+            .expect("valid regex");
+        let candidate_replacement = format!("${{1}}{ip}${{2}}");
+
+        for index in 0..self.lines.len() {
+            let rewritten = match self.text(index) {
+                Some(text) if text.contains("c=IN IP4 0.0.0.0") => {
+                    Some(text.replace("c=IN IP4 0.0.0.0", &connection_replacement))
+                }
+                Some(text) if text.starts_with("a=candidate:") => {
+                    match candidate_re.replace_all(text, candidate_replacement.as_str()) {
+                        Cow::Owned(fixed) => Some(fixed),
+                        Cow::Borrowed(_) => None,
+                    }
+                }
+                _ => None,
+            };
+            if let Some(line) = rewritten {
+                self.replace(index, line);
+            }
         }
-        payload_types_by_codec
-            .entry(codec_name.clone())
-            .or_default()
-            .push(pt.to_owned());
-        codec_by_payload_type.insert(pt.to_owned(), codec_name);
     }
 
-    in_video_section = false;
-    let apt_re = Regex::new(r"(?i)(?:^|;)\s*apt=(\d+)").expect("valid regex");
-    for line in &lines {
-        if line.starts_with("m=video") {
-            in_video_section = true;
-            continue;
+    /// Copies session-level ICE/DTLS attributes into every media section that
+    /// lacks them and strips the transport attributes from the session part.
+    pub fn duplicate_session_webrtc_attributes_to_media(&mut self) {
+        let Some(first_media_index) = self
+            .live_lines()
+            .find_map(|(index, text)| text.starts_with("m=").then_some(index))
+        else {
+            return;
+        };
+
+        let session_attributes: Vec<String> = self
+            .live_lines()
+            .take_while(|(index, _)| *index < first_media_index)
+            .filter(|(_, text)| {
+                text.starts_with("a=ice-ufrag:")
+                    || text.starts_with("a=ice-pwd:")
+                    || text.starts_with("a=ice-options:")
+                    || text.starts_with("a=fingerprint:")
+                    || text.starts_with("a=setup:")
+            })
+            .map(|(_, text)| text.to_owned())
+            .collect();
+        if session_attributes.is_empty() {
+            return;
         }
-        if line.starts_with("m=") && in_video_section {
-            in_video_section = false;
+
+        for index in 0..first_media_index {
+            if self.text(index).is_some_and(is_media_transport_attribute) {
+                self.remove(index);
+            }
         }
-        if !in_video_section || !line.starts_with("a=fmtp:") {
-            continue;
+
+        let mut inserts: Vec<(usize, String)> = Vec::new();
+        let mut index = first_media_index;
+        while index < self.lines.len() {
+            let section_start = index;
+            index += 1;
+            while index < self.lines.len()
+                && !self.text(index).is_some_and(|line| line.starts_with("m="))
+            {
+                index += 1;
+            }
+            let section_end = index;
+
+            let insert_at = (section_start + 1..section_end)
+                .find(|&candidate| {
+                    self.text(candidate)
+                        .is_some_and(|line| line.starts_with("a="))
+                })
+                .unwrap_or(section_end);
+            for attribute in &session_attributes {
+                let prefix_end = attribute.find(':').map_or(attribute.len(), |at| at + 1);
+                let prefix = &attribute[..prefix_end];
+                let already_present = (section_start..section_end).any(|candidate| {
+                    self.text(candidate)
+                        .is_some_and(|line| line.starts_with(prefix))
+                });
+                if !already_present {
+                    inserts.push((insert_at, attribute.clone()));
+                }
+            }
         }
 
-        let rest = line
-            .split_once(':')
-            .map(|(_, rest)| rest)
-            .unwrap_or_default();
-        let mut parts = rest.splitn(2, char::is_whitespace);
-        let Some(pt) = parts.next() else {
-            continue;
-        };
-        let params = parts.next().unwrap_or_default().trim();
-        if pt.is_empty() || params.is_empty() {
-            continue;
+        // Applied back to front so earlier insertion points stay valid.
+        for (at, line) in inserts.into_iter().rev() {
+            self.insert(at, line);
         }
+    }
 
-        if let Some(captures) = apt_re.captures(params) {
-            if let Some(apt) = captures.get(1) {
-                rtx_apt_by_payload_type.insert(pt.to_owned(), apt.as_str().to_owned());
+    /// Strips characters GStreamer's SDP parser rejects from `a=ice-pwd:`
+    /// values. Returns how many lines were rewritten.
+    pub fn sanitize_ice_pwd_for_gstreamer(&mut self) -> usize {
+        let mut replacements = 0usize;
+        for index in 0..self.lines.len() {
+            let rewritten = self
+                .text(index)
+                .and_then(|line| line.strip_prefix("a=ice-pwd:"))
+                .and_then(|value| {
+                    let sanitized = sanitize_ice_pwd_value(value);
+                    (sanitized != value).then(|| format!("a=ice-pwd:{sanitized}"))
+                });
+            if let Some(line) = rewritten {
+                self.replace(index, line);
+                replacements += 1;
             }
         }
-        fmtp_by_payload_type.insert(pt.to_owned(), params.to_owned());
+        replacements
     }
 
-    let Some(preferred_payloads) = payload_types_by_codec.get(target_codec) else {
-        return sdp.to_owned();
-    };
-    if preferred_payloads.is_empty() {
-        return sdp.to_owned();
-    }
+    /// Reorders the `m=video` payload list so `codec` is negotiated first and
+    /// drops the description lines of payload types no longer offered,
+    /// keeping RTX for the preferred payloads plus FLEXFEC. No-op when the
+    /// codec is not offered at all.
+    pub fn prefer_codec(&mut self, codec: VideoCodec, options: PreferCodecOptions) {
+        let target_codec = codec.as_str();
+        let mut in_video_section = false;
+        let mut payload_types_by_codec: HashMap<String, Vec<String>> = HashMap::new();
+        let mut codec_by_payload_type: HashMap<String, String> = HashMap::new();
+        let mut rtx_apt_by_payload_type: HashMap<String, String> = HashMap::new();
+        let mut fmtp_by_payload_type: HashMap<String, String> = HashMap::new();
+
+        for (_, line) in self.live_lines() {
+            if line.starts_with("m=video") {
+                in_video_section = true;
+                continue;
+            }
+            if line.starts_with("m=") && in_video_section {
+                in_video_section = false;
+            }
+            if !in_video_section || !line.starts_with("a=rtpmap:") {
+                continue;
+            }
 
-    let mut ordered_preferred_payloads = preferred_payloads.clone();
-    if codec == VideoCodec::H265 {
-        if let Some(preferred_profile) = options.prefer_hevc_profile_id {
-            ordered_preferred_payloads.sort_by_key(|pt| {
-                let fmtp = fmtp_by_payload_type
-                    .get(pt)
-                    .map(String::as_str)
-                    .unwrap_or_default();
-                let profile = capture_numeric_param(fmtp, "profile-id");
-                if profile == Some(preferred_profile as u32) {
-                    0
-                } else if profile.is_none() {
-                    1
-                } else {
-                    2
+            let rest = line.strip_prefix("a=rtpmap:").unwrap_or_default();
+            let mut parts = rest.split_whitespace();
+            let Some(pt) = parts.next() else {
+                continue;
+            };
+            let Some(codec_part) = parts.next() else {
+                continue;
+            };
+            let codec_name = normalize_codec(codec_part.split('/').next().unwrap_or_default());
+            if codec_name.is_empty() {
+                continue;
+            }
+            payload_types_by_codec
+                .entry(codec_name.clone())
+                .or_default()
+                .push(pt.to_owned());
+            codec_by_payload_type.insert(pt.to_owned(), codec_name);
+        }
+
+        in_video_section = false;
+        let apt_re = Regex::new(r"(?i)(?:^|;)\s*apt=(\d+)").expect("valid regex");
+        for (_, line) in self.live_lines() {
+            if line.starts_with("m=video") {
+                in_video_section = true;
+                continue;
+            }
+            if line.starts_with("m=") && in_video_section {
+                in_video_section = false;
+            }
+            if !in_video_section || !line.starts_with("a=fmtp:") {
+                continue;
+            }
+
+            let rest = line
+                .split_once(':')
+                .map(|(_, rest)| rest)
+                .unwrap_or_default();
+            let mut parts = rest.splitn(2, char::is_whitespace);
+            let Some(pt) = parts.next() else {
+                continue;
+            };
+            let params = parts.next().unwrap_or_default().trim();
+            if pt.is_empty() || params.is_empty() {
+                continue;
+            }
+
+            if let Some(captures) = apt_re.captures(params) {
+                if let Some(apt) = captures.get(1) {
+                    rtx_apt_by_payload_type.insert(pt.to_owned(), apt.as_str().to_owned());
                 }
-            });
+            }
+            fmtp_by_payload_type.insert(pt.to_owned(), params.to_owned());
         }
-    }
 
-    let preferred: HashSet<String> = ordered_preferred_payloads.iter().cloned().collect();
-    let mut allowed = preferred.clone();
+        let Some(preferred_payloads) = payload_types_by_codec.get(target_codec) else {
+            return;
+        };
+        if preferred_payloads.is_empty() {
+            return;
+        }
 
-    for (rtx_pt, apt) in rtx_apt_by_payload_type {
-        if preferred.contains(&apt)
-            && codec_by_payload_type
-                .get(&rtx_pt)
-                .is_some_and(|name| name == "RTX")
-        {
-            allowed.insert(rtx_pt);
+        let mut ordered_preferred_payloads = preferred_payloads.clone();
+        if codec == VideoCodec::H265 {
+            if let Some(preferred_profile) = options.prefer_hevc_profile_id {
+                ordered_preferred_payloads.sort_by_key(|pt| {
+                    let fmtp = fmtp_by_payload_type
+                        .get(pt)
+                        .map(String::as_str)
+                        .unwrap_or_default();
+                    let profile = capture_numeric_param(fmtp, "profile-id");
+                    if profile == Some(preferred_profile as u32) {
+                        0
+                    } else if profile.is_none() {
+                        1
+                    } else {
+                        2
+                    }
+                });
+            }
         }
-    }
 
-    for (pt, codec_name) in &codec_by_payload_type {
-        if matches!(codec_name.as_str(), "FLEXFEC-03") {
-            allowed.insert(pt.clone());
+        let preferred: HashSet<String> = ordered_preferred_payloads.iter().cloned().collect();
+        let mut allowed = preferred.clone();
+
+        for (rtx_pt, apt) in rtx_apt_by_payload_type {
+            if preferred.contains(&apt)
+                && codec_by_payload_type
+                    .get(&rtx_pt)
+                    .is_some_and(|name| name == "RTX")
+            {
+                allowed.insert(rtx_pt);
+            }
         }
-    }
 
-    let mut filtered = Vec::new();
-    in_video_section = false;
+        for (pt, codec_name) in &codec_by_payload_type {
+            if matches!(codec_name.as_str(), "FLEXFEC-03") {
+                allowed.insert(pt.clone());
+            }
+        }
 
-    for line in lines {
-        if line.starts_with("m=video") {
-            in_video_section = true;
-            let parts: Vec<&str> = line.split_whitespace().collect();
-            let header = &parts[..parts.len().min(3)];
-            let available: Vec<&str> = parts
-                .iter()
-                .skip(3)
-                .copied()
-                .filter(|pt| allowed.contains(*pt))
-                .collect();
-            let mut ordered = Vec::new();
-
-            for pt in &ordered_preferred_payloads {
-                if available.contains(&pt.as_str()) {
-                    ordered.push(pt.as_str());
+        let mut replacements: Vec<(usize, String)> = Vec::new();
+        let mut removals: Vec<usize> = Vec::new();
+        in_video_section = false;
+
+        for (index, line) in self.live_lines() {
+            if line.starts_with("m=video") {
+                in_video_section = true;
+                let parts: Vec<&str> = line.split_whitespace().collect();
+                let header = &parts[..parts.len().min(3)];
+                let available: Vec<&str> = parts
+                    .iter()
+                    .skip(3)
+                    .copied()
+                    .filter(|pt| allowed.contains(*pt))
+                    .collect();
+                let mut ordered = Vec::new();
+
+                for pt in &ordered_preferred_payloads {
+                    if available.contains(&pt.as_str()) {
+                        ordered.push(pt.as_str());
+                    }
+                }
+                for pt in available {
+                    if !preferred.contains(pt) {
+                        ordered.push(pt);
+                    }
+                }
+
+                if !ordered.is_empty() {
+                    replacements.push((
+                        index,
+                        header
+                            .iter()
+                            .chain(ordered.iter())
+                            .copied()
+                            .collect::<Vec<_>>()
+                            .join(" "),
+                    ));
                 }
+                continue;
+            }
+
+            if line.starts_with("m=") && in_video_section {
+                in_video_section = false;
             }
-            for pt in available {
-                if !preferred.contains(pt) {
-                    ordered.push(pt);
+
+            if in_video_section
+                && (line.starts_with("a=rtpmap:")
+                    || line.starts_with("a=fmtp:")
+                    || line.starts_with("a=rtcp-fb:"))
+            {
+                let rest = line
+                    .split_once(':')
+                    .map(|(_, rest)| rest)
+                    .unwrap_or_default();
+                let pt = rest.split_whitespace().next().unwrap_or_default();
+                if !pt.is_empty() && !allowed.contains(pt) {
+                    removals.push(index);
                 }
             }
+        }
 
-            if ordered.is_empty() {
-                filtered.push(line.to_owned());
-            } else {
-                filtered.push(
-                    header
-                        .iter()
-                        .chain(ordered.iter())
-                        .copied()
-                        .collect::<Vec<_>>()
-                        .join(" "),
-                );
+        for (index, line) in replacements {
+            self.replace(index, line);
+        }
+        for index in removals {
+            self.remove(index);
+        }
+    }
+
+    /// Forces `a=framerate:` in every video section to `fps`, inserting the
+    /// attribute when absent. Returns whether anything changed.
+    pub fn align_video_framerate(&mut self, fps: u32) -> bool {
+        if fps == 0 {
+            return false;
+        }
+
+        let target = format!("a=framerate:{fps}");
+        let mut in_video = false;
+        let mut video_has_framerate = false;
+        let mut replacements: Vec<usize> = Vec::new();
+        let mut inserts: Vec<usize> = Vec::new();
+
+        for (index, line) in self.live_lines() {
+            if line.starts_with("m=") {
+                if in_video && !video_has_framerate {
+                    inserts.push(index);
+                }
+                in_video = line.starts_with("m=video");
+                video_has_framerate = false;
+                continue;
+            }
+            if in_video && line.starts_with("a=framerate:") {
+                video_has_framerate = true;
+                if line != target {
+                    replacements.push(index);
+                }
             }
-            continue;
+        }
+        if in_video && !video_has_framerate {
+            inserts.push(self.lines.len());
         }
 
-        if line.starts_with("m=") && in_video_section {
-            in_video_section = false;
+        let changed = !replacements.is_empty() || !inserts.is_empty();
+        for index in replacements {
+            self.replace(index, target.clone());
+        }
+        for index in inserts.into_iter().rev() {
+            self.insert(index, target.clone());
         }
+        changed
+    }
+
+    /// Answer-side munging: forces Opus stereo on `minptime` fmtp lines and
+    /// inserts `b=AS:` bandwidth caps after the audio/video section headers.
+    pub fn munge_answer(&mut self, max_bitrate_kbps: u32) {
+        let mut replacements: Vec<(usize, String)> = Vec::new();
+        let mut inserts: Vec<(usize, String)> = Vec::new();
 
-        if in_video_section
-            && (line.starts_with("a=rtpmap:")
-                || line.starts_with("a=fmtp:")
-                || line.starts_with("a=rtcp-fb:"))
         {
-            let rest = line
-                .split_once(':')
-                .map(|(_, rest)| rest)
-                .unwrap_or_default();
-            let pt = rest.split_whitespace().next().unwrap_or_default();
-            if !pt.is_empty() && !allowed.contains(pt) {
-                continue;
+            let live: Vec<(usize, &str)> = self.live_lines().collect();
+            for (position, (index, line)) in live.iter().enumerate() {
+                if line.starts_with("a=fmtp:")
+                    && line.contains("minptime=")
+                    && !line.contains("stereo=1")
+                {
+                    replacements.push((*index, format!("{line};stereo=1")));
+                }
+
+                if line.starts_with("m=video") || line.starts_with("m=audio") {
+                    let bitrate = if line.starts_with("m=video") {
+                        max_bitrate_kbps
+                    } else {
+                        128
+                    };
+                    let next_line = live.get(position + 1).map(|(_, text)| *text).unwrap_or_default();
+                    if !next_line.starts_with("b=") {
+                        inserts.push((index + 1, format!("b=AS:{bitrate}")));
+                    }
+                }
             }
         }
 
-        filtered.push(line.to_owned());
+        for (index, line) in replacements {
+            self.replace(index, line);
+        }
+        for (at, line) in inserts.into_iter().rev() {
+            self.insert(at, line);
+        }
     }
+}
 
-    filtered.join(ending)
+pub fn prefer_codec(sdp: &str, codec: VideoCodec, options: PreferCodecOptions) -> String {
+    let mut table = SdpLineTable::parse(sdp);
+    table.prefer_codec(codec, options);
+    table.emit()
 }
 
 fn capture_numeric_param(params: &str, key: &str) -> Option<u32> {
@@ -573,35 +820,16 @@ fn capture_numeric_param(params: &str, key: &str) -> Option<u32> {
     None
 }
 
-pub fn munge_answer_sdp(sdp: &str, max_bitrate_kbps: u32) -> String {
-    let ending = line_ending(sdp);
-    let lines = split_lines_lossless(sdp);
-    let mut result = Vec::new();
-
-    for (index, line) in lines.iter().enumerate() {
-        let mut current = (*line).to_owned();
-        if current.starts_with("a=fmtp:")
-            && current.contains("minptime=")
-            && !current.contains("stereo=1")
-        {
-            current.push_str(";stereo=1");
-        }
-        result.push(current);
-
-        if line.starts_with("m=video") || line.starts_with("m=audio") {
-            let bitrate = if line.starts_with("m=video") {
-                max_bitrate_kbps
-            } else {
-                128
-            };
-            let next_line = lines.get(index + 1).copied().unwrap_or_default();
-            if !next_line.starts_with("b=") {
-                result.push(format!("b=AS:{bitrate}"));
-            }
-        }
-    }
+pub fn align_video_sdp_framerate_for_gstreamer(sdp: &str, fps: u32) -> (String, bool) {
+    let mut table = SdpLineTable::parse(sdp);
+    let changed = table.align_video_framerate(fps);
+    (table.emit(), changed)
+}
 
-    result.join(ending)
+pub fn munge_answer_sdp(sdp: &str, max_bitrate_kbps: u32) -> String {
+    let mut table = SdpLineTable::parse(sdp);
+    table.munge_answer(max_bitrate_kbps);
+    table.emit()
 }
 
 pub fn build_nvst_sdp(params: &NvstParams) -> String {
@@ -943,6 +1171,111 @@ mod tests {
         assert!(sanitized.contains("a=ice-pwd:alreadyValidPassword123456"));
     }
 
+    #[test]
+    fn aligns_gstreamer_video_sdp_framerate() {
+        let sdp = "v=0\nm=video 9 UDP/TLS/RTP/SAVPF 96\na=framerate:60\na=rtpmap:96 H265/90000\n";
+
+        let (aligned, changed) = align_video_sdp_framerate_for_gstreamer(sdp, 240);
+
+        assert!(changed);
+        assert!(aligned.contains("a=framerate:240\n"));
+        assert!(!aligned.contains("a=framerate:60"));
+    }
+
+    #[test]
+    fn inserts_gstreamer_video_sdp_framerate_when_absent() {
+        let sdp = "v=0\nm=audio 9 UDP/TLS/RTP/SAVPF 111\na=rtpmap:111 OPUS/48000/2\nm=video 9 UDP/TLS/RTP/SAVPF 96\na=rtpmap:96 H265/90000\nm=application 9 UDP/DTLS/SCTP webrtc-datachannel\n";
+
+        let (aligned, changed) = align_video_sdp_framerate_for_gstreamer(sdp, 120);
+
+        assert!(changed);
+        assert!(aligned.contains(
+            "m=video 9 UDP/TLS/RTP/SAVPF 96\na=rtpmap:96 H265/90000\na=framerate:120\nm=application"
+        ));
+    }
+
+    #[test]
+    fn preserves_gstreamer_video_sdp_framerate_line_endings() {
+        let sdp = "v=0\r\nm=video 9 UDP/TLS/RTP/SAVPF 96\r\na=rtpmap:96 H265/90000\r\n";
+
+        let (aligned, changed) = align_video_sdp_framerate_for_gstreamer(sdp, 240);
+
+        assert!(changed);
+        assert!(aligned.contains("a=framerate:240\r\n"));
+        assert!(!aligned.contains('\n') || aligned.contains("\r\n"));
+    }
+
+    #[test]
+    fn line_table_round_trips_untouched_documents() {
+        let sdp = "v=0\r\no=- 0 0 IN IP4 0.0.0.0\r\nm=video 9 UDP/TLS/RTP/SAVPF 96\r\na=rtpmap:96 H265/90000\r\n";
+        assert_eq!(SdpLineTable::parse(sdp).emit(), sdp);
+
+        let without_trailing = "v=0\nm=video 9 UDP/TLS/RTP/SAVPF 96";
+        assert_eq!(SdpLineTable::parse(without_trailing).emit(), without_trailing);
+    }
+
+    #[test]
+    fn line_table_emits_with_a_single_exact_allocation() {
+        let sdp = [
+            "v=0",
+            "a=ice-ufrag:user",
+            "a=ice-pwd:48ca4c4b-199a-454c-b58a-3d14739335a3",
+            "m=video 9 UDP/TLS/RTP/SAVPF 96",
+            "c=IN IP4 0.0.0.0",
+        ]
+        .join("\r\n");
+
+        let mut table = SdpLineTable::parse(&sdp);
+        table.fix_server_ip("161.248.11.132");
+        table.sanitize_ice_pwd_for_gstreamer();
+        let emitted = table.emit();
+
+        assert_eq!(emitted.len(), emitted.capacity());
+        assert!(emitted.contains("c=IN IP4 161.248.11.132"));
+    }
+
+    #[test]
+    fn line_table_chains_transforms_on_one_parse() {
+        let offer = [
+            "v=0",
+            "a=ice-ufrag:user",
+            "a=ice-pwd:pass-with-dashes",
+            "a=fingerprint:sha-256 AA:BB",
+            "a=setup:actpass",
+            "c=IN IP4 0.0.0.0",
+            "m=video 9 UDP/TLS/RTP/SAVPF 96 97",
+            "a=candidate:1 1 udp 1 0.0.0.0 49000 typ host",
+            "a=rtpmap:96 H265/90000",
+            "a=rtpmap:97 H264/90000",
+        ]
+        .join("\r\n");
+
+        let chained = sanitize_ice_pwd_for_gstreamer(&prefer_codec(
+            &duplicate_session_webrtc_attributes_to_media(&fix_server_ip(
+                &offer,
+                "161.248.11.132",
+            )),
+            VideoCodec::H265,
+            PreferCodecOptions {
+                prefer_hevc_profile_id: None,
+            },
+        ))
+        .0;
+
+        let mut table = SdpLineTable::parse(&offer);
+        table.fix_server_ip("161.248.11.132");
+        table.duplicate_session_webrtc_attributes_to_media();
+        table.prefer_codec(
+            VideoCodec::H265,
+            PreferCodecOptions {
+                prefer_hevc_profile_id: None,
+            },
+        );
+        table.sanitize_ice_pwd_for_gstreamer();
+
+        assert_eq!(table.emit(), chained);
+    }
+
     #[test]
     fn extracts_ice_credentials() {
         let sdp = "a=ice-ufrag:user\r\na=ice-pwd:pass\r\na=fingerprint:sha-256 AA:BB\r\na=ice-ufrag:other\r\na=ice-pwd:other-pass\r\na=fingerprint:sha-256 CC:DD\r\n";
@@ -1198,4 +1531,16 @@ mod tests {
         assert!(nvst.contains("a=vqos.rtcPreemptiveIdrSettings.minBurstNackSize:65535"));
         assert!(nvst.contains("a=vqos.rtcPreemptiveIdrSettings.minNackPacketCaptureAgeMs:65535"));
     }
+
+    #[test]
+    fn parses_input_redundancy_with_clamping_and_default() {
+        let offer = "v=0\r\nm=application 9 UDP/DTLS/SCTP webrtc-datachannel\r\na=ri.inputRedundancy:2\r\n";
+        assert_eq!(parse_input_redundancy(offer), 2);
+        assert_eq!(
+            parse_input_redundancy("a=ri.inputRedundancy:9\r\n"),
+            MAX_INPUT_REDUNDANCY
+        );
+        assert_eq!(parse_input_redundancy("a=ri.inputRedundancy:junk\r\n"), 0);
+        assert_eq!(parse_input_redundancy("v=0\r\n"), 0);
+    }
 }
@@ -1,7 +1,9 @@
-import { resolve } from "node:path";
+import { readFileSync, readdirSync } from "node:fs";
+import { join, resolve } from "node:path";
 
 import { defineConfig, externalizeDepsPlugin } from "electron-vite";
 import react from "@vitejs/plugin-react";
+import type { Plugin } from "vite";
 
 function readBuildMetadata(): Record<string, string> {
   return {
@@ -19,6 +21,56 @@ function readBuildMetadata(): Record<string, string> {
   };
 }
 
+const LOCALE_MANIFEST_ID = "virtual:locale-bundles";
+const LOCALE_BUNDLE_PREFIX = "virtual:locale-bundle/";
+
+/**
+ * Precompiles the Crowdin-managed locales/*.json files into per-namespace ESM
+ * bundles at build time. The renderer imports a manifest of lazy importers
+ * (one per locale + top-level namespace) and i18n.ts loads only the active
+ * language and only the namespaces in use, instead of shipping every locale
+ * eagerly in the startup chunk. The JSON stays untouched on disk, so the
+ * Crowdin mapping in crowdin.yml is unaffected.
+ */
+function localeNamespaceBundles(): Plugin {
+  const localesDir = resolve("../locales");
+  const readLocaleTree = (locale: string): Record<string, unknown> =>
+    JSON.parse(readFileSync(join(localesDir, `${locale}.json`), "utf8")) as Record<string, unknown>;
+
+  return {
+    name: "opennow:locale-namespace-bundles",
+    resolveId(id) {
+      if (id === LOCALE_MANIFEST_ID || id.startsWith(LOCALE_BUNDLE_PREFIX)) {
+        return `\0${id}`;
+      }
+      return null;
+    },
+    load(id) {
+      if (id === `\0${LOCALE_MANIFEST_ID}`) {
+        const entries = readdirSync(localesDir)
+          .filter((name) => name.endsWith(".json"))
+          .sort()
+          .map((name) => {
+            const locale = name.slice(0, -".json".length);
+            this.addWatchFile(join(localesDir, name));
+            const importers = Object.keys(readLocaleTree(locale)).map((namespace) => {
+              const bundleId = `${LOCALE_BUNDLE_PREFIX}${locale}/${namespace}`;
+              return `${JSON.stringify(namespace)}: () => import(${JSON.stringify(bundleId)}).then((bundle) => bundle.default)`;
+            });
+            return `${JSON.stringify(locale)}: { ${importers.join(", ")} }`;
+          });
+        return `export default { ${entries.join(", ")} };`;
+      }
+      if (id.startsWith(`\0${LOCALE_BUNDLE_PREFIX}`)) {
+        const [locale, namespace] = id.slice(`\0${LOCALE_BUNDLE_PREFIX}`.length).split("/");
+        this.addWatchFile(join(localesDir, `${locale}.json`));
+        return `export default ${JSON.stringify(readLocaleTree(locale)[namespace] ?? {})};`;
+      }
+      return null;
+    },
+  };
+}
+
 export default defineConfig({
   main: {
     plugins: [externalizeDepsPlugin()],
@@ -47,7 +99,7 @@ export default defineConfig({
     build: {
       outDir: "dist",
     },
-    plugins: [react()],
+    plugins: [react(), localeNamespaceBundles()],
     resolve: {
       alias: {
         "@shared": resolve("src/shared"),
@@ -0,0 +1,109 @@
+import { mkdir, readFile, readdir, writeFile } from "node:fs/promises";
+import { dirname, join, sep } from "node:path";
+import { spawn } from "node:child_process";
+import { createRequire } from "node:module";
+
+const require = createRequire(import.meta.url);
+
+const BASELINE_PATH = "benchmarks/baseline.txt";
+const RECORD = process.argv.includes("--record");
+
+async function discoverBenches(dir) {
+  const entries = await readdir(dir, { withFileTypes: true });
+  const files = await Promise.all(entries.map(async (entry) => {
+    const path = join(dir, entry.name);
+    if (entry.isDirectory()) return discoverBenches(path);
+    return entry.isFile() && entry.name.endsWith(".bench.ts") ? [path] : [];
+  }));
+  return files.flat();
+}
+
+function parseBenchLines(output) {
+  const results = new Map();
+  for (const line of output.split(/\r?\n/)) {
+    const match = line.match(/^bench (\S+): ([\d,]+) ops\/s/);
+    if (match) results.set(match[1], Number.parseInt(match[2].replaceAll(",", ""), 10));
+  }
+  return results;
+}
+
+async function readBaseline() {
+  try {
+    const text = await readFile(BASELINE_PATH, "utf8");
+    return parseBenchLines(text);
+  } catch {
+    return null;
+  }
+}
+
+function runBenchFile(tsxCliPath, file) {
+  return new Promise((resolve, reject) => {
+    let output = "";
+    const child = spawn(process.execPath, [tsxCliPath, file], {
+      stdio: ["inherit", "pipe", "inherit"],
+    });
+    child.stdout.on("data", (chunk) => {
+      output += chunk.toString();
+      process.stdout.write(chunk);
+    });
+    child.on("error", reject);
+    child.on("exit", (code, signal) => {
+      if (signal || code !== 0) {
+        reject(new Error(`${file} exited with ${signal ?? code}`));
+        return;
+      }
+      resolve(output);
+    });
+  });
+}
+
+const benches = (await discoverBenches("src"))
+  .map((path) => path.split(sep).join("/"))
+  .sort();
+
+if (benches.length === 0) {
+  console.error("No benchmark files found under src/**/*.bench.ts");
+  process.exit(1);
+}
+
+const tsxPackagePath = require.resolve("tsx/package.json");
+const tsxCliPath = join(dirname(tsxPackagePath), "dist", "cli.mjs");
+
+const results = new Map();
+for (const file of benches) {
+  console.log(`\n# ${file}`);
+  const output = await runBenchFile(tsxCliPath, file).catch((error) => {
+    console.error(error.message);
+    process.exit(1);
+  });
+  for (const [name, opsPerSec] of parseBenchLines(output)) {
+    results.set(name, opsPerSec);
+  }
+}
+
+if (RECORD) {
+  const lines = [
+    "# Renderer micro-benchmark baseline. Regenerate on the reference machine",
+    "# with: npm run bench -- --record",
+    ...[...results].map(([name, opsPerSec]) => `bench ${name}: ${opsPerSec.toLocaleString("en-US")} ops/s`),
+  ];
+  await mkdir(dirname(BASELINE_PATH), { recursive: true });
+  await writeFile(BASELINE_PATH, `${lines.join("\n")}\n`);
+  console.log(`\nRecorded ${results.size} baselines to ${BASELINE_PATH}`);
+} else {
+  const baseline = await readBaseline();
+  if (!baseline) {
+    console.log(`\nNo baseline at ${BASELINE_PATH}; record one with: npm run bench -- --record`);
+  } else {
+    console.log("\n# vs baseline");
+    for (const [name, opsPerSec] of results) {
+      const base = baseline.get(name);
+      if (!base) {
+        console.log(`${name}: no baseline entry`);
+        continue;
+      }
+      const delta = ((opsPerSec - base) / base) * 100;
+      console.log(`${name}: ${delta >= 0 ? "+" : ""}${delta.toFixed(1)}% vs baseline`);
+    }
+  }
+}
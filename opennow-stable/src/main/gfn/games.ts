@@ -18,6 +18,7 @@ import {
 } from "./clientHeaders";
 import { fetchAllAppsPages, type AppsPageResponse } from "./paginatedApps";
 import { fetchWithOptionalProxy } from "./proxyFetch";
+import { readAppsPageResponse } from "./streamingAppsPage";
 import { sessionProxyCacheKeyPart, sessionProxyHasCredentials } from "./proxyUrl";
 
 const GRAPHQL_URL = "https://games.geforce.com/graphql";
@@ -208,22 +209,6 @@ interface FilterSortDefinitionsResponse {
   errors?: Array<{ message: string }>;
 }
 
-interface AppsSearchResponse {
-  data?: {
-    apps?: {
-      numberReturned?: number;
-      numberSupported?: number;
-      pageInfo?: {
-        hasNextPage?: boolean;
-        endCursor?: string;
-        totalCount?: number;
-      };
-      items?: AppData[];
-    };
-  };
-  errors?: Array<{ message: string }>;
-}
-
 type AppsPage = AppsPageResponse<AppData>;
 
 interface GraphQlFilterGroup {
@@ -363,6 +348,31 @@ async function postGraphQl<T>(
   return (await response.json()) as T;
 }
 
+/**
+ * Apps-page variant of {@link postGraphQl}: parses the paged `items` array
+ * incrementally while the response body streams in, instead of buffering the
+ * whole page before a single blocking parse.
+ */
+async function postGraphQlAppsPage(
+  query: string,
+  variables: Record<string, unknown>,
+  token?: string,
+  proxyUrl?: string,
+): Promise<AppsPage> {
+  const response = await fetchWithOptionalProxy(GRAPHQL_URL, {
+    method: "POST",
+    headers: buildGfnGraphQlHeaders(token),
+    body: JSON.stringify({ query, variables }),
+  }, proxyUrl);
+
+  if (!response.ok) {
+    const text = await response.text();
+    throw new Error(`GFN GraphQL failed (${response.status}): ${text.slice(0, 400)}`);
+  }
+
+  return readAppsPageResponse<AppData>(response);
+}
+
 async function getVpcId(token: string, providerStreamingBaseUrl?: string, proxyUrl?: string): Promise<string> {
   let validatedBaseUrl: URL;
   try {
@@ -1067,7 +1077,7 @@ ${appFields}
   let cursor = "";
 
   for (let page = 0; page < MAX_CATALOG_PAGES; page += 1) {
-    const payload = await postGraphQl<AppsSearchResponse>(
+    const payload = await postGraphQlAppsPage(
       query,
       searchQuery.length > 0
         ? {
@@ -1145,10 +1155,10 @@ export async function browseCatalog(input: CatalogBrowseRequest): Promise<Catalo
     return cached;
   }
 
-  const result = await browseCatalogUncached(input);
   const accountId = resolveAccountCacheId(input.userId, token);
+  const cacheKey = catalogBrowseCacheKey(input, accountId);
+  const result = await cacheManager.coalesce(cacheKey, () => browseCatalogUncached(input));
   if (!shouldBypassGamesCache(input.proxyUrl)) {
-    const cacheKey = catalogBrowseCacheKey(input, accountId);
     await cacheManager.saveToCache(cacheKey, result);
   }
   return result;
@@ -1203,9 +1213,9 @@ export async function fetchMainGames(
     return mergePublicGameVariants(cached.data, await fetchPublicGames(proxyUrl));
   }
 
-  const games = await fetchMainGamesUncached(token, providerStreamingBaseUrl, proxyUrl);
+  const cacheKey = accountScopedGamesCacheKey("main", resolveAccountCacheId(accountId, token), providerStreamingBaseUrl, proxyUrl);
+  const games = await cacheManager.coalesce(cacheKey, () => fetchMainGamesUncached(token, providerStreamingBaseUrl, proxyUrl));
   if (!shouldBypassGamesCache(proxyUrl)) {
-    const cacheKey = accountScopedGamesCacheKey("main", resolveAccountCacheId(accountId, token), providerStreamingBaseUrl, proxyUrl);
     await cacheManager.saveToCache(cacheKey, games);
   }
   return games;
@@ -1266,9 +1276,9 @@ export async function fetchLibraryGames(
     return mergePublicGameVariants(cached.data, await fetchPublicGames(proxyUrl));
   }
 
-  const games = await fetchLibraryGamesUncached(token, providerStreamingBaseUrl, proxyUrl);
+  const cacheKey = accountScopedGamesCacheKey(LIBRARY_GAMES_CACHE_SCOPE, resolveAccountCacheId(accountId, token), providerStreamingBaseUrl, proxyUrl);
+  const games = await cacheManager.coalesce(cacheKey, () => fetchLibraryGamesUncached(token, providerStreamingBaseUrl, proxyUrl));
   if (!shouldBypassGamesCache(proxyUrl)) {
-    const cacheKey = accountScopedGamesCacheKey(LIBRARY_GAMES_CACHE_SCOPE, resolveAccountCacheId(accountId, token), providerStreamingBaseUrl, proxyUrl);
     await cacheManager.saveToCache(cacheKey, games);
   }
   return games;
@@ -1351,7 +1361,7 @@ async function fetchPaginatedLibraryApps(token: string, vpcId: string, proxyUrl?
   }`;
 
   const result = await fetchAllAppsPages<AppData>(
-    (cursor) => postGraphQl<AppsPage>(
+    (cursor) => postGraphQlAppsPage(
       query,
       {
         vpcId,
@@ -0,0 +1,201 @@
+import {
+  connect,
+  constants,
+  type ClientHttp2Session,
+  type IncomingHttpHeaders,
+  type OutgoingHttpHeaders,
+} from "node:http2";
+import { Readable } from "node:stream";
+
+// Closing idle sessions well below typical server/GOAWAY timeouts keeps the
+// pool from racing a server-side close on the next request.
+const IDLE_SESSION_TIMEOUT_MS = 45_000;
+const CONNECT_TIMEOUT_MS = 10_000;
+
+// One multiplexed session per origin. Catalog sync issues many requests to
+// the same GFN hosts, so reusing a session removes the per-request TCP/TLS
+// handshake and lets paged fetches share one connection.
+const sessions = new Map<string, ClientHttp2Session>();
+// Origins that refused an HTTP/2 session (no h2 ALPN, middlebox, connect
+// failure). These stay on global fetch, whose keep-alive pool still reuses
+// HTTP/1.1 connections.
+const http1Origins = new Set<string>();
+
+function isUsable(session: ClientHttp2Session): boolean {
+  return !session.closed && !session.destroyed;
+}
+
+function obtainSession(origin: string): Promise<ClientHttp2Session> {
+  const existing = sessions.get(origin);
+  if (existing && isUsable(existing)) {
+    return Promise.resolve(existing);
+  }
+
+  return new Promise((resolveSession, rejectSession) => {
+    const session = connect(origin);
+    const connectTimer = setTimeout(() => {
+      session.destroy(new Error(`HTTP/2 connect to ${origin} timed out.`));
+    }, CONNECT_TIMEOUT_MS);
+    connectTimer.unref?.();
+
+    session.once("error", (error) => {
+      clearTimeout(connectTimer);
+      if (sessions.get(origin) === session) {
+        sessions.delete(origin);
+      }
+      rejectSession(error instanceof Error ? error : new Error(String(error)));
+    });
+
+    session.once("connect", () => {
+      clearTimeout(connectTimer);
+      // Replace the startup rejection handler: a connection-level error after
+      // connect only evicts the session so the next request redials.
+      session.removeAllListeners("error");
+      session.on("error", () => {
+        if (sessions.get(origin) === session) {
+          sessions.delete(origin);
+        }
+      });
+      session.setTimeout(IDLE_SESSION_TIMEOUT_MS, () => {
+        session.close();
+      });
+      session.once("close", () => {
+        if (sessions.get(origin) === session) {
+          sessions.delete(origin);
+        }
+      });
+      sessions.set(origin, session);
+      resolveSession(session);
+    });
+  });
+}
+
+function flattenRequestHeaders(headers: RequestInit["headers"]): Record<string, string> {
+  const flattened: Record<string, string> = {};
+  if (!headers) {
+    return flattened;
+  }
+  for (const [name, value] of new Headers(headers).entries()) {
+    flattened[name] = value;
+  }
+  return flattened;
+}
+
+function toResponseHeaders(incoming: IncomingHttpHeaders): Headers {
+  const headers = new Headers();
+  for (const [name, value] of Object.entries(incoming)) {
+    if (name.startsWith(":") || value === undefined) {
+      continue;
+    }
+    if (Array.isArray(value)) {
+      for (const entry of value) {
+        headers.append(name, entry);
+      }
+    } else {
+      headers.set(name, value);
+    }
+  }
+  return headers;
+}
+
+function statusAllowsBody(status: number): boolean {
+  return status >= 200 && status !== 204 && status !== 304;
+}
+
+function requestOverSession(
+  session: ClientHttp2Session,
+  url: URL,
+  init: RequestInit | undefined,
+): Promise<Response> {
+  const requestHeaders: OutgoingHttpHeaders = {
+    [constants.HTTP2_HEADER_METHOD]: init?.method ?? "GET",
+    [constants.HTTP2_HEADER_PATH]: `${url.pathname}${url.search}`,
+    ...flattenRequestHeaders(init?.headers),
+  };
+
+  return new Promise((resolveResponse, rejectResponse) => {
+    const stream = session.request(requestHeaders);
+    stream.once("error", (error) => {
+      rejectResponse(error instanceof Error ? error : new Error(String(error)));
+    });
+    stream.once("response", (responseHeaders) => {
+      const status = Number(responseHeaders[constants.HTTP2_HEADER_STATUS] ?? 0);
+      const body = statusAllowsBody(status)
+        ? (Readable.toWeb(stream) as unknown as ReadableStream<Uint8Array>)
+        : null;
+      if (body === null) {
+        stream.resume();
+      }
+      resolveResponse(new Response(body, {
+        status,
+        headers: toResponseHeaders(responseHeaders),
+      }));
+    });
+
+    const body = init?.body;
+    if (typeof body === "string") {
+      stream.end(body);
+    } else if (body instanceof Uint8Array) {
+      stream.end(body);
+    } else {
+      stream.end();
+    }
+  });
+}
+
+/**
+ * Fetch-compatible request over a pooled per-origin HTTP/2 session. Paged
+ * catalog fetches to the same host multiplex over one persistent connection
+ * instead of paying a TCP/TLS handshake per request, and the returned
+ * `Response` exposes the live body stream so parsing can start before the
+ * full payload has arrived.
+ *
+ * Falls back to global fetch for non-HTTPS URLs, origins that do not speak
+ * HTTP/2, request bodies it cannot replay, redirects, and any transport
+ * error (GOAWAY races included) — the GFN commands here use string bodies,
+ * so a fallback retry is always safe.
+ */
+export async function fetchOverSharedHttp2(input: string, init?: RequestInit): Promise<Response> {
+  let url: URL;
+  try {
+    url = new URL(input);
+  } catch {
+    return fetch(input, init);
+  }
+
+  const body = init?.body;
+  const replayableBody = body === undefined || body === null || typeof body === "string" || body instanceof Uint8Array;
+  if (url.protocol !== "https:" || http1Origins.has(url.origin) || !replayableBody) {
+    return fetch(input, init);
+  }
+
+  let session: ClientHttp2Session;
+  try {
+    session = await obtainSession(url.origin);
+  } catch (error) {
+    console.warn(`[GfnTransport] HTTP/2 unavailable for ${url.origin}; using HTTP/1.1 keep-alive:`, error);
+    http1Origins.add(url.origin);
+    return fetch(input, init);
+  }
+
+  try {
+    const response = await requestOverSession(session, url, init);
+    if (response.status >= 300 && response.status < 400) {
+      // node:http2 does not follow redirects; let fetch handle them.
+      response.body?.cancel().catch(() => undefined);
+      return fetch(input, init);
+    }
+    return response;
+  } catch (error) {
+    console.warn(`[GfnTransport] HTTP/2 request to ${url.origin} failed; retrying over fetch:`, error);
+    return fetch(input, init);
+  }
+}
+
+/** Closes all pooled sessions; subsequent requests redial on demand. */
+export function closeSharedHttp2Sessions(): void {
+  for (const [origin, session] of sessions.entries()) {
+    sessions.delete(origin);
+    session.close();
+  }
+}
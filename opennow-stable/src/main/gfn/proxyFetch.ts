@@ -1,3 +1,4 @@
+import { fetchOverSharedHttp2 } from "./http2Transport";
 import { normalizeSessionProxyUrl, sessionProxyPartitionForUrl } from "./proxyUrl";
 
 type ElectronSessionWithFetch = Electron.Session & {
@@ -11,7 +12,9 @@ export async function fetchWithOptionalProxy(
 ): Promise<Response> {
   const normalizedProxyUrl = normalizeSessionProxyUrl(proxyUrl);
   if (!normalizedProxyUrl) {
-    return fetch(input, init);
+    // Direct requests share pooled HTTP/2 sessions per origin; proxied
+    // requests stay on the Electron session so proxy rules apply.
+    return fetchOverSharedHttp2(input, init);
   }
 
   const { session: electronSession } = await import("electron");
@@ -0,0 +1,83 @@
+/// <reference types="node" />
+
+import test from "node:test";
+import assert from "node:assert/strict";
+
+import { parseAppsPageChunks } from "./streamingAppsPage";
+
+interface Item {
+  id: string;
+  title?: string;
+}
+
+function pageDocument(items: string, extra = ""): string {
+  return `{"data":{"apps":{"numberReturned":2,"numberSupported":2,`
+    + `"pageInfo":{"hasNextPage":false,"endCursor":"abc","totalCount":2},`
+    + `"items":[${items}]${extra}}}}`;
+}
+
+function chunked(text: string, size: number): string[] {
+  const chunks: string[] = [];
+  for (let offset = 0; offset < text.length; offset += size) {
+    chunks.push(text.slice(offset, offset + size));
+  }
+  return chunks;
+}
+
+test("parses items incrementally across arbitrary chunk boundaries", () => {
+  const document = pageDocument('{"id":"1","title":"Alpha"},{"id":"2","title":"Beta"}');
+
+  for (const size of [1, 3, 7, document.length]) {
+    const seen: Item[] = [];
+    const payload = parseAppsPageChunks<Item>(chunked(document, size), (item) => seen.push(item));
+
+    assert.deepEqual(payload.data?.apps?.items, [
+      { id: "1", title: "Alpha" },
+      { id: "2", title: "Beta" },
+    ]);
+    assert.deepEqual(seen, payload.data?.apps?.items);
+    assert.equal(payload.data?.apps?.pageInfo?.endCursor, "abc");
+    assert.equal(payload.data?.apps?.pageInfo?.totalCount, 2);
+  }
+});
+
+test("ignores braces, brackets, and items-like keys inside string values", () => {
+  const document = pageDocument(
+    '{"id":"1","title":"Weird \\"items\\": [{]} title"},{"id":"2","title":"a,b]c"}',
+  );
+
+  const payload = parseAppsPageChunks<Item>([document]);
+  assert.equal(payload.data?.apps?.items?.length, 2);
+  assert.equal(payload.data?.apps?.items?.[0]?.title, 'Weird "items": [{]} title');
+  assert.equal(payload.data?.apps?.items?.[1]?.title, "a,b]c");
+});
+
+test("handles nested arrays and objects inside items", () => {
+  const document = pageDocument(
+    '{"id":"1","variants":[{"gfn":{"library":{"status":"OWNED"}}},{"gfn":null}]}',
+  );
+
+  const payload = parseAppsPageChunks<Record<string, unknown>>([document]);
+  assert.equal(payload.data?.apps?.items?.length, 1);
+  assert.deepEqual(
+    (payload.data?.apps?.items?.[0] as { variants?: unknown[] }).variants?.length,
+    2,
+  );
+});
+
+test("parses an empty items array and the surrounding envelope", () => {
+  const payload = parseAppsPageChunks<Item>([pageDocument("")]);
+  assert.deepEqual(payload.data?.apps?.items, []);
+  assert.equal(payload.data?.apps?.numberReturned, 2);
+});
+
+test("falls back to whole-document parsing when no items array exists", () => {
+  const document = '{"errors":[{"message":"backend unavailable"}]}';
+  const payload = parseAppsPageChunks<Item>(chunked(document, 5));
+  assert.equal(payload.errors?.[0]?.message, "backend unavailable");
+});
+
+test("throws on truncated documents like the non-streaming path", () => {
+  const document = pageDocument('{"id":"1"}').slice(0, 40);
+  assert.throws(() => parseAppsPageChunks<Item>([document]), SyntaxError);
+});
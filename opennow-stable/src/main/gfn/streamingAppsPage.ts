@@ -0,0 +1,171 @@
+import type { AppsPageResponse } from "./paginatedApps";
+
+/**
+ * Incremental parser for GFN apps-page responses. The `items` array dominates
+ * the payload (hundreds of app entries per page), so instead of buffering the
+ * whole body and parsing it in one blocking `JSON.parse`, the scanner parses
+ * each completed item object as its bytes arrive and parses only the small
+ * residual envelope (pageInfo, counts, errors) once the body ends. Any input
+ * the scanner does not recognize falls back to a whole-text `JSON.parse`, so
+ * behavior matches the non-streaming path for unexpected shapes.
+ */
+class AppsPageScanner<T> {
+  private text = "";
+  private position = 0;
+  private phase: "seek" | "array" | "done" | "bail" = "seek";
+  private inString = false;
+  private escaped = false;
+  private lastString = "";
+  private stringStart = -1;
+  private pendingKey = "";
+  /** Index just after the `[` of the items array. */
+  private itemsOpen = -1;
+  /** Index of the matching `]` of the items array. */
+  private itemsClose = -1;
+  private elementStart = -1;
+  private elementDepth = 0;
+  readonly items: T[] = [];
+
+  constructor(private readonly onItem?: (item: T) => void) {}
+
+  push(chunk: string): void {
+    this.text += chunk;
+    if (this.phase === "done" || this.phase === "bail") {
+      return;
+    }
+    this.scan();
+  }
+
+  finish(): AppsPageResponse<T> {
+    if (this.phase !== "done") {
+      return JSON.parse(this.text) as AppsPageResponse<T>;
+    }
+
+    const envelopeText = this.text.slice(0, this.itemsOpen) + this.text.slice(this.itemsClose);
+    const envelope = JSON.parse(envelopeText) as AppsPageResponse<T>;
+    const apps = envelope.data?.apps;
+    if (!apps || !Array.isArray(apps.items) || apps.items.length !== 0) {
+      // The excised array was not data.apps.items after all; trust the
+      // whole document over the scanner.
+      return JSON.parse(this.text) as AppsPageResponse<T>;
+    }
+    apps.items = this.items;
+    return envelope;
+  }
+
+  private scan(): void {
+    for (; this.position < this.text.length; this.position += 1) {
+      const char = this.text[this.position];
+
+      if (this.inString) {
+        if (this.escaped) {
+          this.escaped = false;
+        } else if (char === "\\") {
+          this.escaped = true;
+        } else if (char === '"') {
+          this.inString = false;
+          this.lastString = this.text.slice(this.stringStart + 1, this.position);
+        }
+        continue;
+      }
+
+      if (char === '"') {
+        this.inString = true;
+        this.stringStart = this.position;
+        continue;
+      }
+
+      if (this.phase === "seek") {
+        if (char === ":") {
+          this.pendingKey = this.lastString;
+        } else if (char === "[") {
+          if (this.pendingKey === "items") {
+            this.phase = "array";
+            this.itemsOpen = this.position + 1;
+          }
+          this.pendingKey = "";
+        } else if (char === "{" || char === ",") {
+          this.pendingKey = "";
+        }
+        continue;
+      }
+
+      // phase === "array": split the array into top-level elements.
+      if (this.elementDepth === 0 && this.elementStart < 0) {
+        if (char === "]") {
+          this.itemsClose = this.position;
+          this.phase = "done";
+          return;
+        }
+        if (char === "," || /\s/.test(char)) {
+          continue;
+        }
+        if (char !== "{") {
+          // Items are expected to be objects; anything else gets the
+          // whole-text fallback.
+          this.phase = "bail";
+          return;
+        }
+        this.elementStart = this.position;
+        this.elementDepth = 1;
+        continue;
+      }
+
+      if (char === "{" || char === "[") {
+        this.elementDepth += 1;
+      } else if (char === "}" || char === "]") {
+        this.elementDepth -= 1;
+        if (this.elementDepth === 0) {
+          const item = JSON.parse(this.text.slice(this.elementStart, this.position + 1)) as T;
+          this.items.push(item);
+          this.onItem?.(item);
+          this.elementStart = -1;
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Parses an apps-page JSON document from text chunks, delivering each item to
+ * `onItem` as soon as its closing brace arrives. Exposed for tests; callers
+ * use {@link readAppsPageResponse}.
+ */
+export function parseAppsPageChunks<T>(
+  chunks: Iterable<string>,
+  onItem?: (item: T) => void,
+): AppsPageResponse<T> {
+  const scanner = new AppsPageScanner<T>(onItem);
+  for (const chunk of chunks) {
+    scanner.push(chunk);
+  }
+  return scanner.finish();
+}
+
+/**
+ * Reads an apps-page response body incrementally, so item parsing overlaps
+ * the network transfer instead of waiting for the last byte. The caller must
+ * have checked `response.ok` already.
+ */
+export async function readAppsPageResponse<T>(
+  response: Response,
+  onItem?: (item: T) => void,
+): Promise<AppsPageResponse<T>> {
+  const body = response.body;
+  if (!body) {
+    return JSON.parse(await response.text()) as AppsPageResponse<T>;
+  }
+
+  const scanner = new AppsPageScanner<T>(onItem);
+  const decoder = new TextDecoder();
+  const reader = body.getReader();
+  for (;;) {
+    const { done, value } = await reader.read();
+    if (done) {
+      break;
+    }
+    scanner.push(decoder.decode(value, { stream: true }));
+  }
+  scanner.push(decoder.decode());
+  return scanner.finish();
+}
@@ -22,7 +22,9 @@ import { existsSync, readFileSync } from "node:fs";
 import { IPC_CHANNELS } from "@shared/ipc";
 import { registerOpenNowMediaProtocol } from "./mediaPaths";
 import { initLogCapture, exportLogs } from "@shared/logger";
+import { assetCache, registerOpenNowAssetProtocol } from "./services/assetCache";
 import { cacheManager } from "./services/cacheManager";
+import { catalogSnapshotStore } from "./services/catalogSnapshotStore";
 import { refreshScheduler } from "./services/refreshScheduler";
 import { cacheEventBus } from "./services/cacheEventBus";
 import {
@@ -170,6 +172,15 @@ protocol.registerSchemesAsPrivileged([
       corsEnabled: true,
     },
   },
+  {
+    scheme: "opennow-asset",
+    privileges: {
+      standard: true,
+      secure: true,
+      supportFetchAPI: true,
+      corsEnabled: true,
+    },
+  },
 ]);
 
 let mainWindow: BrowserWindow | null = null;
@@ -1107,9 +1118,28 @@ function registerIpcHandlers(): void {
 
   ipcMain.handle(IPC_CHANNELS.CACHE_DELETE_ALL, async (): Promise<void> => {
     await cacheManager.deleteAll();
+    await assetCache.deleteAll();
     console.log("[IPC] Cache deletion completed successfully");
   });
 
+  ipcMain.handle(
+    IPC_CHANNELS.CATALOG_SNAPSHOT_LOAD,
+    async (_event, input: { part: "summary" | "full" }): Promise<string | null> => {
+      return catalogSnapshotStore.loadSection(input.part);
+    },
+  );
+
+  ipcMain.handle(
+    IPC_CHANNELS.CATALOG_SNAPSHOT_SAVE,
+    async (_event, input: { summaryJson: string; fullJson: string }): Promise<void> => {
+      await catalogSnapshotStore.save(input);
+    },
+  );
+
+  ipcMain.handle(IPC_CHANNELS.CATALOG_SNAPSHOT_CLEAR, async (): Promise<void> => {
+    await catalogSnapshotStore.clear();
+  });
+
   ipcMain.handle(
     IPC_CHANNELS.COMMUNITY_GET_THANKS,
     async (): Promise<ThankYouDataResult> => {
@@ -1164,6 +1194,7 @@ app.whenReady().then(async () => {
   initLogCapture("main");
 
   await cacheManager.initialize();
+  await assetCache.initialize();
 
   authService = new AuthService(
     join(app.getPath("userData"), "auth-state.json"),
@@ -1227,6 +1258,7 @@ app.whenReady().then(async () => {
   );
 
   registerOpenNowMediaProtocol();
+  registerOpenNowAssetProtocol();
   registerIpcHandlers();
 
   refreshScheduler.initialize(
@@ -1,4 +1,5 @@
 import { execFile } from "node:child_process";
+import { screen } from "electron";
 
 import {
   DEFAULT_MINIMUM_FPS_FOR_CLOUD_GSYNC,
@@ -20,11 +21,26 @@ function assumedWindowsCapabilities(reason: string): NativeCloudGsyncCapabilitie
     isGsyncDisplay: true,
     minimumFpsForCloudGsync: DEFAULT_MINIMUM_FPS_FOR_CLOUD_GSYNC,
     minimumFpsForReflexWithoutVrr: DEFAULT_MINIMUM_FPS_FOR_REFLEX_WITHOUT_VRR,
+    displayRefreshHz: primaryDisplayRefreshHz(),
     detectionSource: "assumed",
     reason,
   };
 }
 
+/**
+ * Refresh rate of the primary display, 0 when Electron cannot report it (e.g.
+ * before app ready). Pacing matters most on fixed-refresh panels, so this is
+ * populated on every platform, not just VRR-capable ones.
+ */
+function primaryDisplayRefreshHz(): number {
+  try {
+    const frequency = screen.getPrimaryDisplay().displayFrequency;
+    return Number.isFinite(frequency) && frequency > 0 ? Math.round(frequency) : 0;
+  } catch {
+    return 0;
+  }
+}
+
 function execFileText(file: string, args: string[], timeoutMs: number): Promise<string> {
   return new Promise((resolve, reject) => {
     execFile(file, args, { timeout: timeoutMs, windowsHide: true }, (error, stdout) => {
@@ -68,7 +84,10 @@ export async function getNativeCloudGsyncCapabilities(
   }
 
   if (process.platform !== "win32") {
-    return unsupportedNativeCloudGsyncCapabilities("unsupported-platform");
+    return {
+      ...unsupportedNativeCloudGsyncCapabilities("unsupported-platform"),
+      displayRefreshHz: primaryDisplayRefreshHz(),
+    };
   }
 
   try {
@@ -80,6 +99,7 @@ export async function getNativeCloudGsyncCapabilities(
     if (!hasNvidiaAdapter) {
       return {
         ...unsupportedNativeCloudGsyncCapabilities("no-nvidia-adapter"),
+        displayRefreshHz: primaryDisplayRefreshHz(),
         reason: `no-nvidia-adapter adapters=${adapters.join(",") || "none"} monitors=${monitors.join(",") || "none"}`,
       };
     }
@@ -93,6 +113,7 @@ export async function getNativeCloudGsyncCapabilities(
   } catch (error) {
     return {
       ...unsupportedNativeCloudGsyncCapabilities("detection-failed"),
+      displayRefreshHz: primaryDisplayRefreshHz(),
       reason: `detection-failed ${error instanceof Error ? error.message : String(error)}`,
     };
   }
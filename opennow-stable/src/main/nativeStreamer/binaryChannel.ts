@@ -0,0 +1,166 @@
+import { randomUUID } from "node:crypto";
+import { rmSync } from "node:fs";
+import { createServer, type Server, type Socket } from "node:net";
+import { tmpdir } from "node:os";
+import { join } from "node:path";
+
+import type { NativeStreamerEvent } from "@shared/nativeStreamer";
+
+// Length-prefixed binary frames over a local socket (Unix domain socket, or a
+// named pipe on Windows). JSON-over-stdio stays in place for control commands;
+// this channel carries the high-rate traffic: input packets from the main
+// process and stats events from the native streamer. Frame layout is a
+// little-endian u32 body length followed by the body, whose first byte is the
+// frame type.
+const FRAME_TYPE_INPUT = 1;
+const FRAME_TYPE_EVENT = 2;
+const FRAME_TYPE_STATS = 3;
+const MAX_FRAME_BYTES = 1024 * 1024;
+const MAX_SOCKET_BUFFER_BYTES = 256 * 1024;
+
+export type BinaryInputResult = "sent" | "dropped" | "unavailable";
+
+function createEndpointPath(): string {
+  const token = `${process.pid}-${randomUUID().slice(0, 8)}`;
+  return process.platform === "win32"
+    ? `\\\\.\\pipe\\opennow-native-streamer-${token}`
+    : join(tmpdir(), `opennow-native-streamer-${token}.sock`);
+}
+
+export class NativeStreamerBinaryChannel {
+  private server: Server | null = null;
+  private socket: Socket | null = null;
+  private receiveBuffer: Buffer = Buffer.alloc(0);
+  private endpointPath: string | null = null;
+
+  constructor(
+    private readonly onEvent: (event: NativeStreamerEvent) => void,
+    private readonly onStatsFrame: (frame: ArrayBuffer) => void,
+  ) {}
+
+  get connected(): boolean {
+    return this.socket !== null && !this.socket.destroyed;
+  }
+
+  async listen(): Promise<string> {
+    const endpointPath = createEndpointPath();
+    const server = createServer((socket) => this.handleConnection(socket));
+    this.server = server;
+    this.endpointPath = endpointPath;
+
+    await new Promise<void>((resolveListen, rejectListen) => {
+      server.once("error", rejectListen);
+      server.listen(endpointPath, () => {
+        server.removeListener("error", rejectListen);
+        resolveListen();
+      });
+    });
+
+    server.on("error", (error) => {
+      console.warn("[NativeStreamer] Binary IPC server error:", error);
+    });
+    return endpointPath;
+  }
+
+  sendInput(payload: Uint8Array, partiallyReliable: boolean): BinaryInputResult {
+    const socket = this.socket;
+    if (!socket || socket.destroyed || !socket.writable) {
+      return "unavailable";
+    }
+
+    if (socket.writableLength > MAX_SOCKET_BUFFER_BYTES) {
+      return "dropped";
+    }
+
+    const frame = Buffer.allocUnsafe(4 + 2 + payload.byteLength);
+    frame.writeUInt32LE(2 + payload.byteLength, 0);
+    frame[4] = FRAME_TYPE_INPUT;
+    frame[5] = partiallyReliable ? 1 : 0;
+    frame.set(payload, 6);
+    socket.write(frame);
+    return "sent";
+  }
+
+  close(): void {
+    const socket = this.socket;
+    this.socket = null;
+    this.receiveBuffer = Buffer.alloc(0);
+    socket?.destroy();
+
+    const server = this.server;
+    this.server = null;
+    server?.close();
+
+    if (this.endpointPath && process.platform !== "win32") {
+      rmSync(this.endpointPath, { force: true });
+    }
+    this.endpointPath = null;
+  }
+
+  private handleConnection(socket: Socket): void {
+    if (this.socket) {
+      // The native streamer opens a single connection; anything else is stale.
+      socket.destroy();
+      return;
+    }
+
+    console.log("[NativeStreamer] Binary IPC channel connected; input and stats leave the JSON path.");
+    this.socket = socket;
+    socket.on("data", (chunk: Buffer) => this.handleData(chunk));
+    socket.on("error", (error) => {
+      console.warn("[NativeStreamer] Binary IPC socket error:", error);
+    });
+    socket.on("close", () => {
+      if (this.socket === socket) {
+        this.socket = null;
+        this.receiveBuffer = Buffer.alloc(0);
+      }
+    });
+  }
+
+  private handleData(chunk: Buffer): void {
+    this.receiveBuffer = this.receiveBuffer.length === 0
+      ? chunk
+      : Buffer.concat([this.receiveBuffer, chunk]);
+
+    while (this.receiveBuffer.length >= 4) {
+      const frameLength = this.receiveBuffer.readUInt32LE(0);
+      if (frameLength === 0 || frameLength > MAX_FRAME_BYTES) {
+        console.warn(`[NativeStreamer] Dropping binary IPC stream after invalid frame length ${frameLength}.`);
+        this.socket?.destroy();
+        return;
+      }
+      if (this.receiveBuffer.length < 4 + frameLength) {
+        return;
+      }
+
+      const body = this.receiveBuffer.subarray(4, 4 + frameLength);
+      this.receiveBuffer = this.receiveBuffer.subarray(4 + frameLength);
+      this.handleFrame(body);
+    }
+  }
+
+  private handleFrame(body: Buffer): void {
+    if (body[0] === FRAME_TYPE_STATS) {
+      // Copy out of the receive buffer: the subarray aliases bytes that the
+      // next chunk handler will reuse. The body stays a fixed-layout frame the
+      // renderer decodes; only this copy happens on the main process.
+      const frame = new ArrayBuffer(body.length - 1);
+      new Uint8Array(frame).set(body.subarray(1));
+      this.onStatsFrame(frame);
+      return;
+    }
+    if (body[0] !== FRAME_TYPE_EVENT) {
+      return;
+    }
+
+    let event: NativeStreamerEvent;
+    try {
+      event = JSON.parse(body.subarray(1).toString("utf8")) as NativeStreamerEvent;
+    } catch (error) {
+      console.warn("[NativeStreamer] Ignoring malformed binary IPC event frame:", error);
+      return;
+    }
+    this.onEvent(event);
+  }
+}
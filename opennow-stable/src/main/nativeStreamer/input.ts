@@ -43,12 +43,10 @@ export function normalizeNativeInputPacket(
     return null;
   }
 
+  // Base64 is only needed by the JSON-over-stdio fallback; the manager encodes
+  // it lazily so the binary IPC path forwards the raw bytes untouched.
   return {
-    payloadBase64: Buffer.from(
-      bytes.buffer,
-      bytes.byteOffset,
-      bytes.byteLength,
-    ).toString("base64"),
+    payloadBytes: bytes,
     partiallyReliable: packet.partiallyReliable === true,
   };
 }
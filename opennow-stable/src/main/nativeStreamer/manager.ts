@@ -44,6 +44,9 @@ import {
   type NativeStreamerResponse,
 } from "@shared/nativeStreamer";
 import type { NativeStreamerShortcutBindings } from "@shared/gfn";
+import { getHotPathLogger } from "@shared/hotPathLog";
+import { refreshScheduler } from "../services/refreshScheduler";
+import { NativeStreamerBinaryChannel } from "./binaryChannel";
 
 type NativeStreamerCommandInput = NativeStreamerCommand extends infer T
   ? T extends NativeStreamerCommand
@@ -66,6 +69,7 @@ interface NativeStreamerManagerOptions extends NativeStreamerCallbacks {
   getCloudGsyncMode(): NativeStreamerFeatureMode;
   getD3dFullscreenMode(): NativeStreamerFeatureMode;
   getExternalRendererEnabled(): boolean;
+  getWarmPoolEnabled(): boolean;
 }
 
 interface PendingRequest {
@@ -82,6 +86,9 @@ const SURFACE_UPDATE_TIMEOUT_MS = 15000;
 const OFFER_TIMEOUT_MS = 20000;
 const STOP_TIMEOUT_MS = 1200;
 const MAX_INPUT_STDIN_BUFFER_BYTES = 64 * 1024;
+// Delays warm-pool spawns so a replacement process never competes with
+// session teardown or app startup for disk and CPU.
+const WARM_POOL_SPAWN_DELAY_MS = 3000;
 const MIN_NATIVE_BITRATE_KBPS = 5_000;
 const MAX_NATIVE_BITRATE_KBPS = 150_000;
 
@@ -500,6 +507,10 @@ export class NativeStreamerManager {
   private lastSurface: NativeRenderSurface | null = null;
   private surfaceUpdateInFlight = false;
   private surfaceUpdateQueued = false;
+  private binaryChannel: NativeStreamerBinaryChannel | null = null;
+  private sessionCriticalPathActive = false;
+  private warmPoolTimer: NodeJS.Timeout | null = null;
+  private disposed = false;
 
   constructor(private readonly options: NativeStreamerManagerOptions) {}
 
@@ -511,10 +522,64 @@ export class NativeStreamerManager {
     return this.activeSessionId !== null;
   }
 
+  /**
+   * Tracks whether this manager currently holds the refresh scheduler's
+   * session-critical-path signal, so begin/end always pair up even when a
+   * session ends through stop, dispose or a process crash.
+   */
+  private markSessionCriticalPath(active: boolean, reason: string): void {
+    if (this.sessionCriticalPathActive === active) {
+      return;
+    }
+    this.sessionCriticalPathActive = active;
+    if (active) {
+      refreshScheduler.beginSessionCriticalPath(reason);
+    } else {
+      refreshScheduler.endSessionCriticalPath(reason);
+    }
+  }
+
+  /**
+   * Warm-pool mode: spawns the streamer process and completes the hello
+   * handshake ahead of the next session, so hitting Play skips process spawn
+   * plus GStreamer registry and plugin init (over a second on spinning-rust
+   * machines) and goes straight to the `start` command. The warm process is
+   * the same one `prepareForSession` adopts; when a session ends, a
+   * replacement is re-warmed in the background.
+   */
+  prewarm(reason: string, delayMs = WARM_POOL_SPAWN_DELAY_MS): void {
+    if (
+      this.disposed
+      || this.warmPoolTimer
+      || !isNativeStreamerSupportedPlatform(process.platform)
+    ) {
+      return;
+    }
+
+    const timer = setTimeout(() => {
+      this.warmPoolTimer = null;
+      if (
+        this.disposed
+        || this.activeSessionId
+        || (this.child && this.capabilities)
+        || !this.options.getWarmPoolEnabled()
+      ) {
+        return;
+      }
+      console.log(`[NativeStreamer] Warming standby streamer process (${reason}).`);
+      void this.ensureProcess().catch((error) => {
+        console.warn(`[NativeStreamer] Warm-pool startup failed (${reason}):`, formatError(error));
+      });
+    }, delayMs);
+    timer.unref?.();
+    this.warmPoolTimer = timer;
+  }
+
   async prepareForSession(context: NativeStreamerSessionContext): Promise<void> {
     if (this.activeSessionId && this.activeSessionId !== context.session.sessionId) {
       await this.stop("new native streamer session");
     }
+    this.markSessionCriticalPath(true, "session launch");
     this.prepareRemoteIceQueue(context.session.sessionId);
 
     await this.ensureProcess();
@@ -698,7 +763,28 @@ export class NativeStreamerManager {
       return;
     }
 
+    const payloadBytes = input.payloadBytes
+      ?? (input.payloadBase64 ? Buffer.from(input.payloadBase64, "base64") : undefined);
+    if (payloadBytes && this.binaryChannel) {
+      const result = this.binaryChannel.sendInput(payloadBytes, input.partiallyReliable === true);
+      if (result === "sent") {
+        getHotPathLogger().log("NativeStreamer", "input sent bytes", payloadBytes.byteLength);
+        this.inputBackpressureWarned = false;
+        return;
+      }
+      if (result === "dropped") {
+        getHotPathLogger().log("NativeStreamer", "input dropped (binary channel backpressure) bytes", payloadBytes.byteLength);
+        if (!this.inputBackpressureWarned) {
+          this.inputBackpressureWarned = true;
+          console.warn("[NativeStreamer] Dropping native input while the binary IPC channel is backpressured.");
+        }
+        return;
+      }
+      // The channel never connected or has closed; fall through to stdio.
+    }
+
     if (child.stdin.writableLength > MAX_INPUT_STDIN_BUFFER_BYTES) {
+      getHotPathLogger().log("NativeStreamer", "input dropped (stdin backpressure) buffered", child.stdin.writableLength);
       if (!this.inputBackpressureWarned) {
         this.inputBackpressureWarned = true;
         console.warn("[NativeStreamer] Dropping native input while streamer stdin is backpressured.");
@@ -709,7 +795,13 @@ export class NativeStreamerManager {
     const payload = {
       id: randomUUID(),
       type: "input",
-      input,
+      input: {
+        payloadBase64: input.payloadBase64
+          ?? (payloadBytes
+            ? Buffer.from(payloadBytes.buffer, payloadBytes.byteOffset, payloadBytes.byteLength).toString("base64")
+            : ""),
+        partiallyReliable: input.partiallyReliable,
+      },
     } satisfies NativeStreamerCommand;
 
     const flushed = child.stdin.write(`${JSON.stringify(payload)}\n`, "utf8", (error) => {
@@ -763,6 +855,7 @@ export class NativeStreamerManager {
 
   async stop(reason = "stopped"): Promise<void> {
     const child = this.child;
+    this.markSessionCriticalPath(false, reason);
     this.activeSessionId = null;
     this.capabilities = null;
     this.clearQueuedRemoteIce();
@@ -777,10 +870,14 @@ export class NativeStreamerManager {
       console.warn("[NativeStreamer] Stop request failed:", error);
     } finally {
       this.terminateProcess();
+      this.prewarm(`replacement after ${reason}`);
     }
   }
 
   dispose(reason = "disposed"): void {
+    this.disposed = true;
+    this.cancelPendingWarmPoolSpawn();
+    this.markSessionCriticalPath(false, reason);
     this.activeSessionId = null;
     this.capabilities = null;
     this.clearQueuedRemoteIce();
@@ -870,6 +967,21 @@ export class NativeStreamerManager {
     if (backendPreference !== "auto") {
       childEnv.OPENNOW_NATIVE_STREAMER_BACKEND = backendPreference;
     }
+    this.closeBinaryChannel();
+    const binaryChannel = new NativeStreamerBinaryChannel(
+      (event) => this.handleEvent(event),
+      (frame) => this.options.emit({ type: "native-stream-stats-frame", frame }),
+    );
+    try {
+      childEnv.OPENNOW_NATIVE_BINARY_ENDPOINT = await binaryChannel.listen();
+      this.binaryChannel = binaryChannel;
+    } catch (error) {
+      console.warn(
+        "[NativeStreamer] Binary IPC channel unavailable; input and stats stay on JSON-over-stdio:",
+        error,
+      );
+      binaryChannel.close();
+    }
     const runtimeStatus = configureBundledGstreamerRuntime(childEnv, executablePath);
     this.gstreamerRuntime = runtimeStatus;
     if (runtimeStatus.bundled) {
@@ -1251,11 +1363,21 @@ export class NativeStreamerManager {
       return;
     }
 
+    if (message.type === "frame-latency") {
+      this.options.emit({
+        type: "native-frame-latency",
+        latency: message.latency,
+      });
+      return;
+    }
+
     if (message.type === "status") {
       console.log(`[NativeStreamer] Status: ${message.status}${message.message ? ` (${message.message})` : ""}`);
       if (message.status === "streaming") {
+        this.markSessionCriticalPath(false, "streaming established");
         this.options.emit({ type: "native-stream-started", message: message.message });
       } else if (message.status === "stopped") {
+        this.markSessionCriticalPath(false, "stream stopped");
         this.options.emit({ type: "native-stream-stopped", reason: message.message });
       }
       return;
@@ -1275,17 +1397,29 @@ export class NativeStreamerManager {
     const hadActiveSession = this.activeSessionId !== null;
     const stoppedReason = `process ended (${reason})`;
     console.warn(`[NativeStreamer] Process ended (${reason})${tail}`);
+    this.markSessionCriticalPath(false, stoppedReason);
     this.child = null;
     this.stdoutBuffer = "";
     this.stderrTail = [];
     this.activeSessionId = null;
     this.capabilities = null;
+    this.closeBinaryChannel();
     this.clearQueuedRemoteIce();
     this.rejectPending(new Error(`Native streamer process ended (${reason}).${tail}`));
 
     if (hadActiveSession) {
       this.options.emit({ type: "native-stream-stopped", reason: stoppedReason });
       this.options.emit({ type: "error", message: `Native streamer ${stoppedReason}.${tail}` });
+      // Only re-warm after a session actually ran; re-warming after startup
+      // failures would just respawn a process that cannot initialize.
+      this.prewarm(`replacement after ${stoppedReason}`);
+    }
+  }
+
+  private cancelPendingWarmPoolSpawn(): void {
+    if (this.warmPoolTimer) {
+      clearTimeout(this.warmPoolTimer);
+      this.warmPoolTimer = null;
     }
   }
 
@@ -1354,7 +1488,14 @@ export class NativeStreamerManager {
     }
   }
 
+  private closeBinaryChannel(): void {
+    const binaryChannel = this.binaryChannel;
+    this.binaryChannel = null;
+    binaryChannel?.close();
+  }
+
   private terminateProcess(): void {
+    this.closeBinaryChannel();
     const child = this.child;
     if (!child) {
       return;
@@ -0,0 +1,258 @@
+import { app, protocol } from "electron";
+import { createHash } from "node:crypto";
+import { mkdir, readFile, rename, unlink, writeFile } from "node:fs/promises";
+import { existsSync } from "node:fs";
+import { join } from "node:path";
+
+import { cacheEventBus } from "./cacheEventBus";
+import { fetchWithTimeout } from "./requestTimeout";
+import {
+  selectAssetCacheEvictions,
+  totalAssetCacheBytes,
+  type AssetCacheEntry,
+} from "./assetCacheIndex";
+
+const ASSET_DIRECTORY = "gfn-assets";
+const ASSET_INDEX_FILE = "index.json";
+const ASSET_BYTE_BUDGET = 256 * 1024 * 1024;
+const ASSET_FRESH_TTL_MS = 7 * 24 * 60 * 60 * 1000;
+const ASSET_FETCH_TIMEOUT_MS = 15_000;
+const MAX_ASSET_URL_LENGTH = 4096;
+
+const OPENNOW_ASSET_HOST = "opennow";
+
+let openNowAssetProtocolHandleInstalled = false;
+
+interface AssetIndexDocument {
+  version: 1;
+  entries: AssetCacheEntry[];
+}
+
+export interface CachedAsset {
+  filePath: string;
+  contentType: string;
+}
+
+// Content-addressed store for box art and other remote images, fronted by the
+// opennow-asset:// scheme. Every distinct URL is fetched from the network at
+// most once no matter how many GameCard mounts ask for it concurrently
+// (in-flight coalescing); later opens are served from disk. Entries are fresh
+// for a week, after which a hit is still served immediately and revalidated in
+// the background (stale-while-revalidate) — if the bytes changed, the update
+// is published on cacheEventBus so listeners can refresh. The store holds a
+// byte budget via least-recently-accessed eviction.
+class AssetCache {
+  private assetDir: string;
+  private initialized = false;
+  private readonly index = new Map<string, AssetCacheEntry>();
+  private readonly inflight = new Map<string, Promise<CachedAsset | null>>();
+  private readonly revalidating = new Set<string>();
+  private indexWritePending = false;
+
+  constructor() {
+    this.assetDir = join(app.getPath("userData"), ASSET_DIRECTORY);
+  }
+
+  async initialize(): Promise<void> {
+    if (this.initialized) return;
+    try {
+      await mkdir(this.assetDir, { recursive: true });
+      await this.loadIndex();
+      this.initialized = true;
+      console.log(`[ASSETS] Initialized asset cache: ${this.assetDir} (${this.index.size} entries, ${totalAssetCacheBytes(this.index.values())} bytes)`);
+    } catch (error) {
+      console.error(`[ASSETS] Failed to initialize asset cache:`, error);
+      throw error;
+    }
+  }
+
+  /**
+   * Cached bytes for the URL, fetching (coalesced) on a miss. A stale hit is
+   * returned immediately and revalidated in the background. Null means the
+   * asset is not cached and could not be fetched.
+   */
+  async getAsset(url: string): Promise<CachedAsset | null> {
+    if (!this.initialized) return null;
+
+    const entry = this.index.get(url);
+    if (entry) {
+      const filePath = join(this.assetDir, entry.fileName);
+      if (existsSync(filePath)) {
+        entry.lastAccessAt = Date.now();
+        this.scheduleIndexWrite();
+        if (Date.now() - entry.fetchedAt > ASSET_FRESH_TTL_MS) {
+          this.revalidateInBackground(url);
+        }
+        return { filePath, contentType: entry.contentType };
+      }
+      // File vanished out from under the index (manual deletion, crash
+      // mid-eviction) — drop the entry and fall through to a refetch.
+      this.index.delete(url);
+    }
+
+    const pending = this.inflight.get(url);
+    if (pending) {
+      return pending;
+    }
+
+    const fetchPromise = this.fetchAndStore(url).finally(() => {
+      this.inflight.delete(url);
+    });
+    this.inflight.set(url, fetchPromise);
+    return fetchPromise;
+  }
+
+  async deleteAll(): Promise<void> {
+    if (!this.initialized) return;
+
+    const entries = [...this.index.values()];
+    this.index.clear();
+    await Promise.all(entries.map(async (entry) => {
+      await unlink(join(this.assetDir, entry.fileName)).catch(() => undefined);
+    }));
+    await this.writeIndex();
+    console.log(`[ASSETS] Cleared asset cache (${entries.length} entries)`);
+  }
+
+  private async fetchAndStore(url: string): Promise<CachedAsset | null> {
+    try {
+      const response = await fetchWithTimeout(url, {}, ASSET_FETCH_TIMEOUT_MS, "Asset fetch");
+      if (!response.ok) {
+        console.warn(`[ASSETS] Fetch failed (${response.status}): ${url}`);
+        return null;
+      }
+      const bytes = Buffer.from(await response.arrayBuffer());
+      const contentType = response.headers.get("content-type") ?? "application/octet-stream";
+      return await this.store(url, bytes, contentType);
+    } catch (error) {
+      console.warn(`[ASSETS] Fetch failed: ${url}`, error);
+      return null;
+    }
+  }
+
+  private async store(url: string, bytes: Buffer, contentType: string): Promise<CachedAsset> {
+    const fileName = createHash("sha256").update(url).digest("hex");
+    const filePath = join(this.assetDir, fileName);
+    const tmpPath = `${filePath}.tmp`;
+    await writeFile(tmpPath, bytes);
+    await rename(tmpPath, filePath);
+
+    const now = Date.now();
+    this.index.set(url, {
+      url,
+      fileName,
+      contentHash: createHash("sha256").update(bytes).digest("hex"),
+      size: bytes.length,
+      contentType,
+      fetchedAt: now,
+      lastAccessAt: now,
+    });
+    await this.enforceByteBudget();
+    this.scheduleIndexWrite();
+    return { filePath, contentType };
+  }
+
+  private revalidateInBackground(url: string): void {
+    if (this.revalidating.has(url)) return;
+    this.revalidating.add(url);
+
+    void (async () => {
+      const previousHash = this.index.get(url)?.contentHash;
+      const refreshed = await this.fetchAndStore(url);
+      if (refreshed && previousHash && this.index.get(url)?.contentHash !== previousHash) {
+        cacheEventBus.emit("cache:asset-updated", { url });
+      } else if (!refreshed) {
+        // Keep serving the stale copy; freshness is retried on the next hit.
+        const entry = this.index.get(url);
+        if (entry) entry.fetchedAt = Date.now();
+      }
+    })().finally(() => {
+      this.revalidating.delete(url);
+    });
+  }
+
+  private async enforceByteBudget(): Promise<void> {
+    const evictions = selectAssetCacheEvictions([...this.index.values()], ASSET_BYTE_BUDGET);
+    if (evictions.length === 0) return;
+
+    for (const entry of evictions) {
+      this.index.delete(entry.url);
+      await unlink(join(this.assetDir, entry.fileName)).catch(() => undefined);
+    }
+    console.log(`[ASSETS] Evicted ${evictions.length} assets to stay within byte budget`);
+  }
+
+  private async loadIndex(): Promise<void> {
+    const indexPath = join(this.assetDir, ASSET_INDEX_FILE);
+    if (!existsSync(indexPath)) return;
+
+    try {
+      const parsed = JSON.parse(await readFile(indexPath, "utf-8")) as Partial<AssetIndexDocument>;
+      if (parsed.version !== 1 || !Array.isArray(parsed.entries)) return;
+      for (const entry of parsed.entries) {
+        if (entry && typeof entry.url === "string" && typeof entry.fileName === "string") {
+          this.index.set(entry.url, entry);
+        }
+      }
+    } catch (error) {
+      console.warn(`[ASSETS] Ignoring corrupt asset index:`, error);
+    }
+  }
+
+  private scheduleIndexWrite(): void {
+    if (this.indexWritePending) return;
+    this.indexWritePending = true;
+    setTimeout(() => {
+      this.indexWritePending = false;
+      void this.writeIndex();
+    }, 1000);
+  }
+
+  private async writeIndex(): Promise<void> {
+    const document: AssetIndexDocument = { version: 1, entries: [...this.index.values()] };
+    try {
+      await writeFile(join(this.assetDir, ASSET_INDEX_FILE), JSON.stringify(document), "utf-8");
+    } catch (error) {
+      console.warn(`[ASSETS] Failed to write asset index:`, error);
+    }
+  }
+}
+
+export const assetCache = new AssetCache();
+
+/**
+ * Must run during app startup (after ready), before windows load asset URLs.
+ */
+export function registerOpenNowAssetProtocol(): void {
+  if (openNowAssetProtocolHandleInstalled) return;
+  openNowAssetProtocolHandleInstalled = true;
+
+  protocol.handle("opennow-asset", async (request) => {
+    try {
+      const url = new URL(request.url);
+      if (url.hostname.toLowerCase() !== OPENNOW_ASSET_HOST) {
+        return new Response(null, { status: 404 });
+      }
+      const target = url.searchParams.get("u");
+      if (!target || target.length > MAX_ASSET_URL_LENGTH || !/^https:\/\//i.test(target)) {
+        return new Response(null, { status: 400 });
+      }
+
+      const asset = await assetCache.getAsset(target);
+      if (!asset) {
+        // Cache and network both failed — let the renderer try the origin
+        // directly rather than showing a broken image.
+        return Response.redirect(target, 307);
+      }
+
+      const bytes = await readFile(asset.filePath);
+      return new Response(bytes, {
+        status: 200,
+        headers: { "Content-Type": asset.contentType },
+      });
+    } catch (err) {
+      console.warn("[opennow-asset] protocol handler:", err);
+      return new Response(null, { status: 500 });
+    }
+  });
+}
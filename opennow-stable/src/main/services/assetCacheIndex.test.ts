@@ -0,0 +1,56 @@
+/// <reference types="node" />
+
+import test from "node:test";
+import assert from "node:assert/strict";
+
+import {
+  selectAssetCacheEvictions,
+  totalAssetCacheBytes,
+  type AssetCacheEntry,
+} from "./assetCacheIndex";
+
+function makeEntry(url: string, size: number, lastAccessAt: number): AssetCacheEntry {
+  return {
+    url,
+    fileName: `hash-${url}`,
+    contentHash: `content-${url}`,
+    size,
+    contentType: "image/jpeg",
+    fetchedAt: lastAccessAt,
+    lastAccessAt,
+  };
+}
+
+test("no evictions while within the byte budget", () => {
+  const entries = [makeEntry("a", 40, 1), makeEntry("b", 40, 2)];
+  assert.equal(totalAssetCacheBytes(entries), 80);
+  assert.deepEqual(selectAssetCacheEvictions(entries, 100), []);
+});
+
+test("evicts least recently accessed entries first", () => {
+  const entries = [
+    makeEntry("old", 50, 1),
+    makeEntry("newest", 50, 30),
+    makeEntry("middle", 50, 20),
+  ];
+
+  const evicted = selectAssetCacheEvictions(entries, 100).map((entry) => entry.url);
+  assert.deepEqual(evicted, ["old"]);
+});
+
+test("keeps evicting until the remainder fits", () => {
+  const entries = [
+    makeEntry("a", 60, 1),
+    makeEntry("b", 60, 2),
+    makeEntry("c", 60, 3),
+  ];
+
+  const evicted = selectAssetCacheEvictions(entries, 70).map((entry) => entry.url);
+  assert.deepEqual(evicted, ["a", "b"]);
+});
+
+test("eviction does not mutate the input order", () => {
+  const entries = [makeEntry("b", 60, 2), makeEntry("a", 60, 1)];
+  selectAssetCacheEvictions(entries, 10);
+  assert.deepEqual(entries.map((entry) => entry.url), ["b", "a"]);
+});
@@ -0,0 +1,46 @@
+// Pure bookkeeping for the content-addressed asset cache: entry shape, byte
+// accounting and LRU eviction selection. Kept free of filesystem and Electron
+// imports so the budget math is unit-testable.
+
+export interface AssetCacheEntry {
+  url: string;
+  /** sha256(url) hex — doubles as the on-disk file name. */
+  fileName: string;
+  /** sha256 of the cached bytes, used to detect changed artwork on revalidation. */
+  contentHash: string;
+  size: number;
+  contentType: string;
+  fetchedAt: number;
+  lastAccessAt: number;
+}
+
+export function totalAssetCacheBytes(entries: Iterable<AssetCacheEntry>): number {
+  let total = 0;
+  for (const entry of entries) {
+    total += entry.size;
+  }
+  return total;
+}
+
+/**
+ * Entries to delete so the cache fits the byte budget, least recently
+ * accessed first. Returns an empty array when already within budget.
+ */
+export function selectAssetCacheEvictions(
+  entries: AssetCacheEntry[],
+  byteBudget: number,
+): AssetCacheEntry[] {
+  let excess = totalAssetCacheBytes(entries) - byteBudget;
+  if (excess <= 0) {
+    return [];
+  }
+
+  const byAge = [...entries].sort((left, right) => left.lastAccessAt - right.lastAccessAt);
+  const evictions: AssetCacheEntry[] = [];
+  for (const entry of byAge) {
+    if (excess <= 0) break;
+    evictions.push(entry);
+    excess -= entry.size;
+  }
+  return evictions;
+}
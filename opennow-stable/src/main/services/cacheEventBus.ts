@@ -5,10 +5,15 @@ interface CacheRefreshErrorEvent {
   error: string;
 }
 
+interface CacheAssetUpdatedEvent {
+  url: string;
+}
+
 class CacheEventBus extends EventEmitter {
   emit(event: "cache:refresh-start"): boolean;
   emit(event: "cache:refresh-success"): boolean;
   emit(event: "cache:refresh-error", details: CacheRefreshErrorEvent): boolean;
+  emit(event: "cache:asset-updated", details: CacheAssetUpdatedEvent): boolean;
   emit(event: string, ...args: unknown[]): boolean {
     return super.emit(event, ...args);
   }
@@ -21,11 +21,30 @@ const THUMBNAILS_DIRECTORY = "media-thumbs";
 class CacheManager {
   private cacheDir: string;
   private initialized: boolean = false;
+  private readonly inflight = new Map<string, Promise<unknown>>();
 
   constructor() {
     this.cacheDir = join(app.getPath("userData"), CACHE_DIRECTORY);
   }
 
+  /**
+   * Runs `operation` at most once per key at a time; concurrent callers share
+   * the in-flight promise. Keeps a cold start from issuing the same uncached
+   * network fetch once per renderer request racing the empty cache.
+   */
+  async coalesce<T>(key: string, operation: () => Promise<T>): Promise<T> {
+    const pending = this.inflight.get(key);
+    if (pending) {
+      return pending as Promise<T>;
+    }
+
+    const promise = operation().finally(() => {
+      this.inflight.delete(key);
+    });
+    this.inflight.set(key, promise);
+    return promise;
+  }
+
   async initialize(): Promise<void> {
     if (this.initialized) return;
     try {
@@ -0,0 +1,65 @@
+/// <reference types="node" />
+
+import test from "node:test";
+import assert from "node:assert/strict";
+
+import {
+  CATALOG_SNAPSHOT_FORMAT_VERSION,
+  CATALOG_SNAPSHOT_HEADER_LENGTH,
+  catalogSnapshotSectionRange,
+  decodeCatalogSnapshotHeader,
+  decodeCatalogSnapshotSection,
+  encodeCatalogSnapshotFile,
+} from "./catalogSnapshotFormat";
+
+const sections = {
+  summaryJson: JSON.stringify({ version: 2, games: [{ id: "1", title: "Portal 2" }] }),
+  fullJson: JSON.stringify({ version: 2, games: [{ id: "1", title: "Portal 2", description: "x".repeat(4096) }] }),
+};
+
+test("sections round-trip through encode and per-section decode", () => {
+  const encoded = encodeCatalogSnapshotFile(sections);
+  const lengths = decodeCatalogSnapshotHeader(encoded);
+  assert.ok(lengths);
+
+  const summaryRange = catalogSnapshotSectionRange(lengths, "summary");
+  const fullRange = catalogSnapshotSectionRange(lengths, "full");
+  const summary = decodeCatalogSnapshotSection(encoded.subarray(summaryRange.offset, summaryRange.offset + summaryRange.length));
+  const full = decodeCatalogSnapshotSection(encoded.subarray(fullRange.offset, fullRange.offset + fullRange.length));
+
+  assert.equal(summary, sections.summaryJson);
+  assert.equal(full, sections.fullJson);
+});
+
+test("section ranges tile the file exactly", () => {
+  const encoded = encodeCatalogSnapshotFile(sections);
+  const lengths = decodeCatalogSnapshotHeader(encoded);
+  assert.ok(lengths);
+
+  const summaryRange = catalogSnapshotSectionRange(lengths, "summary");
+  const fullRange = catalogSnapshotSectionRange(lengths, "full");
+  assert.equal(summaryRange.offset, CATALOG_SNAPSHOT_HEADER_LENGTH);
+  assert.equal(fullRange.offset, summaryRange.offset + summaryRange.length);
+  assert.equal(fullRange.offset + fullRange.length, encoded.length);
+});
+
+test("header rejects bad magic, wrong version, and truncation", () => {
+  const encoded = encodeCatalogSnapshotFile(sections);
+
+  const badMagic = Buffer.from(encoded);
+  badMagic.write("NOPE", 0, "ascii");
+  assert.equal(decodeCatalogSnapshotHeader(badMagic), null);
+
+  const badVersion = Buffer.from(encoded);
+  badVersion.writeUInt32LE(CATALOG_SNAPSHOT_FORMAT_VERSION + 1, 4);
+  assert.equal(decodeCatalogSnapshotHeader(badVersion), null);
+
+  assert.equal(decodeCatalogSnapshotHeader(encoded.subarray(0, CATALOG_SNAPSHOT_HEADER_LENGTH - 1)), null);
+});
+
+test("compression keeps the repetitive full section smaller than its JSON", () => {
+  const encoded = encodeCatalogSnapshotFile(sections);
+  const lengths = decodeCatalogSnapshotHeader(encoded);
+  assert.ok(lengths);
+  assert.ok(lengths.fullLength < Buffer.byteLength(sections.fullJson, "utf-8"));
+});
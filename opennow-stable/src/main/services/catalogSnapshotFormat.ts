@@ -0,0 +1,76 @@
+import { gzipSync, gunzipSync } from "node:zlib";
+
+// On-disk framing for the catalog snapshot file. The file carries two
+// independently compressed JSON sections: a small "summary" with just the
+// fields the home screen needs for first paint, and the "full" catalog with
+// variants, descriptions and store metadata. Keeping the sections separate
+// lets the loader read and inflate only the summary bytes on startup and
+// defer the (much larger) full section until after the UI is on screen.
+//
+// Layout, all integers little-endian:
+//   bytes 0..4   magic "ONCS"
+//   bytes 4..8   format version (u32)
+//   bytes 8..12  summary section length in bytes (u32)
+//   bytes 12..16 full section length in bytes (u32)
+//   then gzip(summaryJson) followed by gzip(fullJson)
+
+const CATALOG_SNAPSHOT_MAGIC = "ONCS";
+
+export const CATALOG_SNAPSHOT_FORMAT_VERSION = 2;
+export const CATALOG_SNAPSHOT_HEADER_LENGTH = 16;
+
+export type CatalogSnapshotPart = "summary" | "full";
+
+export interface CatalogSnapshotSections {
+  summaryJson: string;
+  fullJson: string;
+}
+
+export interface CatalogSnapshotSectionLengths {
+  summaryLength: number;
+  fullLength: number;
+}
+
+export function encodeCatalogSnapshotFile(sections: CatalogSnapshotSections): Buffer {
+  const summary = gzipSync(Buffer.from(sections.summaryJson, "utf-8"));
+  const full = gzipSync(Buffer.from(sections.fullJson, "utf-8"));
+
+  const header = Buffer.alloc(CATALOG_SNAPSHOT_HEADER_LENGTH);
+  header.write(CATALOG_SNAPSHOT_MAGIC, 0, "ascii");
+  header.writeUInt32LE(CATALOG_SNAPSHOT_FORMAT_VERSION, 4);
+  header.writeUInt32LE(summary.length, 8);
+  header.writeUInt32LE(full.length, 12);
+
+  return Buffer.concat([header, summary, full]);
+}
+
+/** Parses and validates the fixed-size header; null on magic/version mismatch. */
+export function decodeCatalogSnapshotHeader(header: Buffer): CatalogSnapshotSectionLengths | null {
+  if (header.length < CATALOG_SNAPSHOT_HEADER_LENGTH) return null;
+  if (header.toString("ascii", 0, 4) !== CATALOG_SNAPSHOT_MAGIC) return null;
+  if (header.readUInt32LE(4) !== CATALOG_SNAPSHOT_FORMAT_VERSION) return null;
+
+  return {
+    summaryLength: header.readUInt32LE(8),
+    fullLength: header.readUInt32LE(12),
+  };
+}
+
+/** Byte range of one section within the file, so callers can read it in isolation. */
+export function catalogSnapshotSectionRange(
+  lengths: CatalogSnapshotSectionLengths,
+  part: CatalogSnapshotPart,
+): { offset: number; length: number } {
+  if (part === "summary") {
+    return { offset: CATALOG_SNAPSHOT_HEADER_LENGTH, length: lengths.summaryLength };
+  }
+  return {
+    offset: CATALOG_SNAPSHOT_HEADER_LENGTH + lengths.summaryLength,
+    length: lengths.fullLength,
+  };
+}
+
+/** Inflates one section's bytes back to JSON text; throws on corrupt data. */
+export function decodeCatalogSnapshotSection(bytes: Buffer): string {
+  return gunzipSync(bytes).toString("utf-8");
+}
@@ -0,0 +1,86 @@
+import { app } from "electron";
+import { open, rename, unlink, writeFile } from "node:fs/promises";
+import { join } from "node:path";
+
+import {
+  CATALOG_SNAPSHOT_HEADER_LENGTH,
+  catalogSnapshotSectionRange,
+  decodeCatalogSnapshotHeader,
+  decodeCatalogSnapshotSection,
+  encodeCatalogSnapshotFile,
+  type CatalogSnapshotPart,
+  type CatalogSnapshotSections,
+} from "./catalogSnapshotFormat";
+
+const SNAPSHOT_FILE = "catalog-snapshot.bin";
+
+// Persists the renderer's catalog snapshot as a compressed two-section file
+// under userData (replacing the old localStorage JSON blob, which had to be
+// parsed in full on the UI thread before first paint). Loads read only the
+// requested section's bytes, so the startup path touches a few kilobytes of
+// summary instead of the whole catalog. Any validation or decode failure
+// degrades to "no snapshot" — the renderer just falls back to a network load.
+class CatalogSnapshotStore {
+  private readonly filePath: string;
+
+  constructor() {
+    this.filePath = join(app.getPath("userData"), SNAPSHOT_FILE);
+  }
+
+  async save(sections: CatalogSnapshotSections): Promise<void> {
+    const encoded = encodeCatalogSnapshotFile(sections);
+    const tmpPath = `${this.filePath}.tmp`;
+    try {
+      await writeFile(tmpPath, encoded);
+      await rename(tmpPath, this.filePath);
+    } catch (error) {
+      console.error("[SNAPSHOT] Failed to write catalog snapshot:", error);
+      throw error;
+    }
+  }
+
+  async loadSection(part: CatalogSnapshotPart): Promise<string | null> {
+    let handle;
+    try {
+      handle = await open(this.filePath, "r");
+    } catch {
+      return null;
+    }
+
+    try {
+      const header = Buffer.alloc(CATALOG_SNAPSHOT_HEADER_LENGTH);
+      const headerRead = await handle.read(header, 0, CATALOG_SNAPSHOT_HEADER_LENGTH, 0);
+      if (headerRead.bytesRead !== CATALOG_SNAPSHOT_HEADER_LENGTH) return null;
+
+      const lengths = decodeCatalogSnapshotHeader(header);
+      if (!lengths) {
+        console.warn("[SNAPSHOT] Catalog snapshot header invalid or outdated, ignoring");
+        return null;
+      }
+
+      const range = catalogSnapshotSectionRange(lengths, part);
+      const bytes = Buffer.alloc(range.length);
+      const sectionRead = await handle.read(bytes, 0, range.length, range.offset);
+      if (sectionRead.bytesRead !== range.length) return null;
+
+      return decodeCatalogSnapshotSection(bytes);
+    } catch (error) {
+      console.warn(`[SNAPSHOT] Failed to read catalog snapshot ${part} section:`, error);
+      return null;
+    } finally {
+      await handle.close();
+    }
+  }
+
+  async clear(): Promise<void> {
+    try {
+      await unlink(this.filePath);
+    } catch (error) {
+      if ((error as NodeJS.ErrnoException)?.code !== "ENOENT") {
+        console.warn("[SNAPSHOT] Failed to delete catalog snapshot:", error);
+      }
+    }
+  }
+}
+
+export const catalogSnapshotStore = new CatalogSnapshotStore();
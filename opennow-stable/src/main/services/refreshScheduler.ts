@@ -1,212 +1,359 @@
-import type { GameInfo } from "@shared/gfn";
-import { getAccountGamesCacheKeys } from "../gfn/games";
-import { sessionProxyHasCredentials } from "../gfn/proxyUrl";
-import { cacheEventBus } from "./cacheEventBus";
-import { cacheManager } from "./cacheManager";
-
-export interface RefreshAuthContext {
-  token: string;
-  userId: string;
-  providerStreamingBaseUrl?: string;
-  proxyUrl?: string;
-}
-
-type FetchFunction<T> = (
-  token: string,
-  providerStreamingBaseUrl?: string,
-  proxyUrl?: string,
-) => Promise<T>;
-type PublicFetchFunction = (proxyUrl?: string) => Promise<GameInfo[]>;
-
-class RefreshScheduler {
-  private refreshTimer: ReturnType<typeof setInterval> | null = null;
-  private isRefreshing: boolean = false;
-  private authContext: RefreshAuthContext | null = null;
-  private fetchMainGamesUncached: FetchFunction<GameInfo[]> | null = null;
-  private fetchLibraryGamesUncached: FetchFunction<GameInfo[]> | null = null;
-  private fetchPublicGamesUncached: PublicFetchFunction | null = null;
-  private refreshIntervalMs: number = 12 * 60 * 60 * 1000;
-
-  initialize(
-    fetchMainGamesUncached: FetchFunction<GameInfo[]>,
-    fetchLibraryGamesUncached: FetchFunction<GameInfo[]>,
-    fetchPublicGamesUncached: PublicFetchFunction,
-  ): void {
-    this.fetchMainGamesUncached = fetchMainGamesUncached;
-    this.fetchLibraryGamesUncached = fetchLibraryGamesUncached;
-    this.fetchPublicGamesUncached = fetchPublicGamesUncached;
-    console.log(`[CACHE] RefreshScheduler initialized (interval: ${this.refreshIntervalMs / 60000} minutes)`);
-  }
-
-  updateAuthContext(token: string, userId: string, providerStreamingBaseUrl?: string, proxyUrl?: string): void {
-    this.authContext = { token, userId, providerStreamingBaseUrl, proxyUrl };
-    console.log(`[CACHE] Auth context updated for refresh scheduler`);
-  }
-
-  start(): void {
-    if (this.refreshTimer) {
-      console.warn(`[CACHE] RefreshScheduler already started`);
-      return;
-    }
-
-    if (!this.fetchMainGamesUncached || !this.fetchLibraryGamesUncached || !this.fetchPublicGamesUncached) {
-      console.error(`[CACHE] Cannot start RefreshScheduler: fetch functions not initialized`);
-      return;
-    }
-
-    console.log(`[CACHE] Starting RefreshScheduler`);
-    void this.performRefresh();
-    this.refreshTimer = setInterval(() => {
-      void this.performRefresh();
-    }, this.refreshIntervalMs);
-    this.refreshTimer.unref?.();
-  }
-
-  stop(): void {
-    if (!this.refreshTimer) {
-      console.log(`[CACHE] RefreshScheduler already stopped`);
-      return;
-    }
-
-    clearInterval(this.refreshTimer);
-    this.refreshTimer = null;
-    console.log(`[CACHE] RefreshScheduler stopped`);
-  }
-
-  async performRefresh(options: { force?: boolean } = {}): Promise<void> {
-    if (this.isRefreshing) {
-      console.log(`[CACHE] Refresh already in progress, skipping`);
-      return;
-    }
-
-    if (!this.authContext) {
-      console.log(`[CACHE] Auth context not available, skipping refresh`);
-      return;
-    }
-
-    if (!this.fetchMainGamesUncached || !this.fetchLibraryGamesUncached || !this.fetchPublicGamesUncached) {
-      console.error(`[CACHE] Fetch functions not available`);
-      return;
-    }
-
-    const { token, userId, providerStreamingBaseUrl, proxyUrl } = this.authContext;
-    if (sessionProxyHasCredentials(proxyUrl)) {
-      console.log("[CACHE] Credentialed proxy configured, skipping background game cache refresh");
-      return;
-    }
-
-    const cacheKeys = getAccountGamesCacheKeys(userId, providerStreamingBaseUrl, proxyUrl);
-    const force = options.force === true;
-
-    const [mainNeedsRefresh, libraryNeedsRefresh, publicNeedsRefresh] = force
-      ? [true, true, true]
-      : await Promise.all([
-        cacheManager.isStaleOrMissing(cacheKeys.main),
-        cacheManager.isStaleOrMissing(cacheKeys.library),
-        cacheManager.isStaleOrMissing(cacheKeys.public),
-      ]);
-
-    if (!mainNeedsRefresh && !libraryNeedsRefresh && !publicNeedsRefresh) {
-      console.log("[CACHE] All game caches are fresh, skipping background refresh");
-      return;
-    }
-
-    this.isRefreshing = true;
-    const startTime = Date.now();
-    console.log("[CACHE] Refresh cycle started", {
-      main: mainNeedsRefresh,
-      library: libraryNeedsRefresh,
-      public: publicNeedsRefresh,
-      force,
-    });
-
-    try {
-      cacheEventBus.emit("cache:refresh-start");
-
-      const refreshTasks: Promise<void>[] = [];
-
-      if (mainNeedsRefresh) {
-        refreshTasks.push(
-          this.fetchMainGamesUncached(token, providerStreamingBaseUrl, proxyUrl)
-            .then(async (games) => {
-              await cacheManager.saveToCache(cacheKeys.main, games);
-            }),
-        );
-      }
-
-      if (libraryNeedsRefresh) {
-        refreshTasks.push(
-          this.fetchLibraryGamesUncached(token, providerStreamingBaseUrl, proxyUrl)
-            .then(async (games) => {
-              await cacheManager.saveToCache(cacheKeys.library, games);
-            }),
-        );
-      }
-
-      if (publicNeedsRefresh) {
-        refreshTasks.push(
-          this.fetchPublicGamesUncached(proxyUrl)
-            .then(async (games) => {
-              await cacheManager.saveToCache(cacheKeys.public, games);
-            }),
-        );
-      }
-
-      const results = await Promise.allSettled(refreshTasks);
-
-      let hasErrors = false;
-      const taskNames: string[] = [];
-      if (mainNeedsRefresh) taskNames.push("main");
-      if (libraryNeedsRefresh) taskNames.push("library");
-      if (publicNeedsRefresh) taskNames.push("public");
-
-      for (let i = 0; i < results.length; i += 1) {
-        const result = results[i];
-        if (result.status === "rejected") {
-          hasErrors = true;
-          const name = taskNames[i] ?? "unknown";
-          console.error(`[CACHE] Refresh failed for ${name} games:`, result.reason);
-          cacheEventBus.emit("cache:refresh-error", {
-            key: `games:${name}`,
-            error: result.reason instanceof Error ? result.reason.message : String(result.reason),
-          });
-        }
-      }
-
-      const duration = Date.now() - startTime;
-      console.log(`[CACHE] Refresh cycle completed in ${duration}ms`);
-
-      if (!hasErrors) {
-        cacheEventBus.emit("cache:refresh-success");
-      }
-    } catch (error) {
-      console.error(`[CACHE] Refresh cycle error:`, error);
-      cacheEventBus.emit("cache:refresh-error", {
-        key: "refresh-cycle",
-        error: error instanceof Error ? error.message : "Unknown error",
-      });
-    } finally {
-      this.isRefreshing = false;
-    }
-  }
-
-  async manualRefresh(): Promise<void> {
-    console.log(`[CACHE] Manual refresh requested`);
-    await this.performRefresh({ force: true });
-  }
-
-  setRefreshInterval(intervalMs: number): void {
-    console.log(`[CACHE] Refresh interval updated: ${this.refreshIntervalMs}ms -> ${intervalMs}ms`);
-    this.refreshIntervalMs = intervalMs;
-
-    if (this.refreshTimer) {
-      clearInterval(this.refreshTimer);
-      this.refreshTimer = setInterval(() => {
-        void this.performRefresh();
-      }, this.refreshIntervalMs);
-      this.refreshTimer.unref?.();
-    }
-  }
-}
-
-export const refreshScheduler = new RefreshScheduler();
+import type { GameInfo } from "@shared/gfn";
+import { getAccountGamesCacheKeys } from "../gfn/games";
+import { sessionProxyHasCredentials } from "../gfn/proxyUrl";
+import { cacheEventBus } from "./cacheEventBus";
+import { cacheManager } from "./cacheManager";
+
+export interface RefreshAuthContext {
+  token: string;
+  userId: string;
+  providerStreamingBaseUrl?: string;
+  proxyUrl?: string;
+}
+
+/**
+ * Priority lanes for refresh work. Interactive requests (user pressed the
+ * refresh button) always run; prefetch (startup warm-up) and maintenance
+ * (periodic timer, backoff retries) are background lanes that defer while a
+ * session launch is on the critical path.
+ */
+export type RefreshLane = "interactive" | "prefetch" | "maintenance";
+
+const LANE_PRIORITY: Record<RefreshLane, number> = {
+  interactive: 2,
+  prefetch: 1,
+  maintenance: 0,
+};
+
+const RETRY_BASE_DELAY_MS = 30 * 1000;
+const RETRY_MAX_DELAY_MS = 15 * 60 * 1000;
+const RETRY_JITTER_FRACTION = 0.25;
+
+/**
+ * Exponential backoff delay for the given retry attempt (1-based), with
+ * ±jitter so repeated failures across many clients do not re-fire in sync.
+ */
+export function jitteredBackoffDelayMs(attempt: number, random: () => number = Math.random): number {
+  const exponential = Math.min(
+    RETRY_MAX_DELAY_MS,
+    RETRY_BASE_DELAY_MS * 2 ** Math.max(0, attempt - 1),
+  );
+  const jitter = exponential * RETRY_JITTER_FRACTION * (random() * 2 - 1);
+  return Math.round(exponential + jitter);
+}
+
+type FetchFunction<T> = (
+  token: string,
+  providerStreamingBaseUrl?: string,
+  proxyUrl?: string,
+) => Promise<T>;
+type PublicFetchFunction = (proxyUrl?: string) => Promise<GameInfo[]>;
+
+interface PendingRefresh {
+  lane: RefreshLane;
+  force: boolean;
+}
+
+class RefreshScheduler {
+  private refreshTimer: ReturnType<typeof setInterval> | null = null;
+  private retryTimer: ReturnType<typeof setTimeout> | null = null;
+  private isRefreshing: boolean = false;
+  private authContext: RefreshAuthContext | null = null;
+  private fetchMainGamesUncached: FetchFunction<GameInfo[]> | null = null;
+  private fetchLibraryGamesUncached: FetchFunction<GameInfo[]> | null = null;
+  private fetchPublicGamesUncached: PublicFetchFunction | null = null;
+  private refreshIntervalMs: number = 12 * 60 * 60 * 1000;
+  private criticalPathDepth = 0;
+  private consecutiveFailures = 0;
+  /**
+   * Coalesced refresh waiting to run (deferred behind the critical path or an
+   * in-flight cycle). Duplicate requests merge into this single slot, keeping
+   * the highest-priority lane and OR-ing the force flags.
+   */
+  private pendingRefresh: PendingRefresh | null = null;
+
+  initialize(
+    fetchMainGamesUncached: FetchFunction<GameInfo[]>,
+    fetchLibraryGamesUncached: FetchFunction<GameInfo[]>,
+    fetchPublicGamesUncached: PublicFetchFunction,
+  ): void {
+    this.fetchMainGamesUncached = fetchMainGamesUncached;
+    this.fetchLibraryGamesUncached = fetchLibraryGamesUncached;
+    this.fetchPublicGamesUncached = fetchPublicGamesUncached;
+    console.log(`[CACHE] RefreshScheduler initialized (interval: ${this.refreshIntervalMs / 60000} minutes)`);
+  }
+
+  updateAuthContext(token: string, userId: string, providerStreamingBaseUrl?: string, proxyUrl?: string): void {
+    this.authContext = { token, userId, providerStreamingBaseUrl, proxyUrl };
+    console.log(`[CACHE] Auth context updated for refresh scheduler`);
+  }
+
+  start(): void {
+    if (this.refreshTimer) {
+      console.warn(`[CACHE] RefreshScheduler already started`);
+      return;
+    }
+
+    if (!this.fetchMainGamesUncached || !this.fetchLibraryGamesUncached || !this.fetchPublicGamesUncached) {
+      console.error(`[CACHE] Cannot start RefreshScheduler: fetch functions not initialized`);
+      return;
+    }
+
+    console.log(`[CACHE] Starting RefreshScheduler`);
+    void this.requestRefresh("prefetch");
+    this.refreshTimer = setInterval(() => {
+      void this.requestRefresh("maintenance");
+    }, this.refreshIntervalMs);
+    this.refreshTimer.unref?.();
+  }
+
+  stop(): void {
+    if (!this.refreshTimer) {
+      console.log(`[CACHE] RefreshScheduler already stopped`);
+      return;
+    }
+
+    clearInterval(this.refreshTimer);
+    this.refreshTimer = null;
+    this.clearRetryTimer();
+    console.log(`[CACHE] RefreshScheduler stopped`);
+  }
+
+  /**
+   * Marks the start of a session launch. Background lanes (prefetch and
+   * maintenance) are held back until the matching endSessionCriticalPath so
+   * refresh network traffic and main-process work never contend with session
+   * negotiation. Re-entrant: nested begins require matching ends.
+   */
+  beginSessionCriticalPath(reason: string): void {
+    this.criticalPathDepth += 1;
+    if (this.criticalPathDepth === 1) {
+      console.log(`[CACHE] Background refreshes deferred (${reason})`);
+    }
+  }
+
+  endSessionCriticalPath(reason: string): void {
+    if (this.criticalPathDepth === 0) {
+      return;
+    }
+    this.criticalPathDepth -= 1;
+    if (this.criticalPathDepth === 0) {
+      console.log(`[CACHE] Background refreshes resumed (${reason})`);
+      this.runPendingRefresh();
+    }
+  }
+
+  /**
+   * Requests a refresh on the given lane. Interactive requests run right away
+   * (awaitable); background lanes coalesce into at most one pending cycle and
+   * wait out both an in-flight cycle and the session critical path.
+   */
+  async requestRefresh(lane: RefreshLane, options: { force?: boolean } = {}): Promise<void> {
+    const force = options.force === true;
+
+    if (lane !== "interactive" && this.criticalPathDepth > 0) {
+      this.coalescePending(lane, force);
+      console.log(`[CACHE] ${lane} refresh deferred: session critical path active`);
+      return;
+    }
+
+    if (this.isRefreshing) {
+      if (lane === "interactive") {
+        // The in-flight cycle may predate this request; queue a forced pass.
+        this.coalescePending(lane, force);
+        console.log(`[CACHE] Interactive refresh queued behind in-flight cycle`);
+      } else {
+        this.coalescePending(lane, force);
+        console.log(`[CACHE] ${lane} refresh coalesced into in-flight cycle`);
+      }
+      return;
+    }
+
+    await this.performRefresh({ force });
+  }
+
+  async performRefresh(options: { force?: boolean } = {}): Promise<void> {
+    if (this.isRefreshing) {
+      console.log(`[CACHE] Refresh already in progress, skipping`);
+      return;
+    }
+
+    if (!this.authContext) {
+      console.log(`[CACHE] Auth context not available, skipping refresh`);
+      return;
+    }
+
+    if (!this.fetchMainGamesUncached || !this.fetchLibraryGamesUncached || !this.fetchPublicGamesUncached) {
+      console.error(`[CACHE] Fetch functions not available`);
+      return;
+    }
+
+    const { token, userId, providerStreamingBaseUrl, proxyUrl } = this.authContext;
+    if (sessionProxyHasCredentials(proxyUrl)) {
+      console.log("[CACHE] Credentialed proxy configured, skipping background game cache refresh");
+      return;
+    }
+
+    const cacheKeys = getAccountGamesCacheKeys(userId, providerStreamingBaseUrl, proxyUrl);
+    const force = options.force === true;
+
+    const [mainNeedsRefresh, libraryNeedsRefresh, publicNeedsRefresh] = force
+      ? [true, true, true]
+      : await Promise.all([
+        cacheManager.isStaleOrMissing(cacheKeys.main),
+        cacheManager.isStaleOrMissing(cacheKeys.library),
+        cacheManager.isStaleOrMissing(cacheKeys.public),
+      ]);
+
+    if (!mainNeedsRefresh && !libraryNeedsRefresh && !publicNeedsRefresh) {
+      console.log("[CACHE] All game caches are fresh, skipping background refresh");
+      return;
+    }
+
+    this.isRefreshing = true;
+    const startTime = Date.now();
+    console.log("[CACHE] Refresh cycle started", {
+      main: mainNeedsRefresh,
+      library: libraryNeedsRefresh,
+      public: publicNeedsRefresh,
+      force,
+    });
+
+    try {
+      cacheEventBus.emit("cache:refresh-start");
+
+      const refreshTasks: Promise<void>[] = [];
+
+      if (mainNeedsRefresh) {
+        refreshTasks.push(
+          this.fetchMainGamesUncached(token, providerStreamingBaseUrl, proxyUrl)
+            .then(async (games) => {
+              await cacheManager.saveToCache(cacheKeys.main, games);
+            }),
+        );
+      }
+
+      if (libraryNeedsRefresh) {
+        refreshTasks.push(
+          this.fetchLibraryGamesUncached(token, providerStreamingBaseUrl, proxyUrl)
+            .then(async (games) => {
+              await cacheManager.saveToCache(cacheKeys.library, games);
+            }),
+        );
+      }
+
+      if (publicNeedsRefresh) {
+        refreshTasks.push(
+          this.fetchPublicGamesUncached(proxyUrl)
+            .then(async (games) => {
+              await cacheManager.saveToCache(cacheKeys.public, games);
+            }),
+        );
+      }
+
+      const results = await Promise.allSettled(refreshTasks);
+
+      let hasErrors = false;
+      const taskNames: string[] = [];
+      if (mainNeedsRefresh) taskNames.push("main");
+      if (libraryNeedsRefresh) taskNames.push("library");
+      if (publicNeedsRefresh) taskNames.push("public");
+
+      for (let i = 0; i < results.length; i += 1) {
+        const result = results[i];
+        if (result.status === "rejected") {
+          hasErrors = true;
+          const name = taskNames[i] ?? "unknown";
+          console.error(`[CACHE] Refresh failed for ${name} games:`, result.reason);
+          cacheEventBus.emit("cache:refresh-error", {
+            key: `games:${name}`,
+            error: result.reason instanceof Error ? result.reason.message : String(result.reason),
+          });
+        }
+      }
+
+      const duration = Date.now() - startTime;
+      console.log(`[CACHE] Refresh cycle completed in ${duration}ms`);
+
+      if (!hasErrors) {
+        this.consecutiveFailures = 0;
+        this.clearRetryTimer();
+        cacheEventBus.emit("cache:refresh-success");
+      } else {
+        this.scheduleRetry();
+      }
+    } catch (error) {
+      console.error(`[CACHE] Refresh cycle error:`, error);
+      cacheEventBus.emit("cache:refresh-error", {
+        key: "refresh-cycle",
+        error: error instanceof Error ? error.message : "Unknown error",
+      });
+      this.scheduleRetry();
+    } finally {
+      this.isRefreshing = false;
+      this.runPendingRefresh();
+    }
+  }
+
+  async manualRefresh(): Promise<void> {
+    console.log(`[CACHE] Manual refresh requested`);
+    await this.requestRefresh("interactive", { force: true });
+  }
+
+  setRefreshInterval(intervalMs: number): void {
+    console.log(`[CACHE] Refresh interval updated: ${this.refreshIntervalMs}ms -> ${intervalMs}ms`);
+    this.refreshIntervalMs = intervalMs;
+
+    if (this.refreshTimer) {
+      clearInterval(this.refreshTimer);
+      this.refreshTimer = setInterval(() => {
+        void this.requestRefresh("maintenance");
+      }, this.refreshIntervalMs);
+      this.refreshTimer.unref?.();
+    }
+  }
+
+  private coalescePending(lane: RefreshLane, force: boolean): void {
+    if (!this.pendingRefresh) {
+      this.pendingRefresh = { lane, force };
+      return;
+    }
+    if (LANE_PRIORITY[lane] > LANE_PRIORITY[this.pendingRefresh.lane]) {
+      this.pendingRefresh.lane = lane;
+    }
+    this.pendingRefresh.force = this.pendingRefresh.force || force;
+  }
+
+  private runPendingRefresh(): void {
+    if (!this.pendingRefresh || this.isRefreshing) {
+      return;
+    }
+    if (this.pendingRefresh.lane !== "interactive" && this.criticalPathDepth > 0) {
+      return;
+    }
+    const pending = this.pendingRefresh;
+    this.pendingRefresh = null;
+    void this.requestRefresh(pending.lane, { force: pending.force });
+  }
+
+  private scheduleRetry(): void {
+    this.consecutiveFailures += 1;
+    this.clearRetryTimer();
+    const delayMs = jitteredBackoffDelayMs(this.consecutiveFailures);
+    console.log(`[CACHE] Scheduling refresh retry ${this.consecutiveFailures} in ${Math.round(delayMs / 1000)}s`);
+    this.retryTimer = setTimeout(() => {
+      this.retryTimer = null;
+      void this.requestRefresh("maintenance");
+    }, delayMs);
+    this.retryTimer.unref?.();
+  }
+
+  private clearRetryTimer(): void {
+    if (this.retryTimer) {
+      clearTimeout(this.retryTimer);
+      this.retryTimer = null;
+    }
+  }
+}
+
+export const refreshScheduler = new RefreshScheduler();
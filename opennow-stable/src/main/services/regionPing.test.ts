@@ -0,0 +1,39 @@
+/// <reference types="node" />
+
+import test from "node:test";
+import assert from "node:assert/strict";
+
+import { percentileMs, summarizeProbeSamples } from "./regionPing";
+
+test("percentileMs uses nearest-rank over the sorted samples", () => {
+  const sorted = [10, 20, 30, 40, 50];
+  assert.equal(percentileMs(sorted, 0.5), 30);
+  assert.equal(percentileMs(sorted, 0.95), 50);
+  assert.equal(percentileMs(sorted, 0), 10);
+  assert.equal(percentileMs([], 0.5), 0);
+});
+
+test("summarizeProbeSamples reports p50, p95 and jitter", () => {
+  const stats = summarizeProbeSamples([30, 20, 200, 25, 28]);
+  assert.ok(stats);
+  assert.equal(stats.p50Ms, 28);
+  assert.equal(stats.p95Ms, 200);
+  // |20-30| + |200-20| + |25-200| + |28-25| over 4 gaps.
+  assert.equal(stats.jitterMs, Math.round((10 + 180 + 175 + 3) / 4));
+});
+
+test("one outlier handshake no longer dominates the headline number", () => {
+  const stats = summarizeProbeSamples([22, 21, 950, 23, 24]);
+  assert.ok(stats);
+  assert.equal(stats.p50Ms, 23);
+  assert.ok(stats.p95Ms >= 950);
+});
+
+test("summarizeProbeSamples handles empty and single-sample input", () => {
+  assert.equal(summarizeProbeSamples([]), null);
+  const single = summarizeProbeSamples([42]);
+  assert.ok(single);
+  assert.equal(single.p50Ms, 42);
+  assert.equal(single.p95Ms, 42);
+  assert.equal(single.jitterMs, 0);
+});
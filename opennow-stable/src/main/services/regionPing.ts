@@ -1,6 +1,28 @@
 import * as net from "node:net";
 import type { PingResult, StreamRegion } from "@shared/gfn";
 
+// Probing parameters. Regions fan out concurrently (bounded so a long region
+// list cannot open dozens of sockets at once), each region takes several
+// connect samples, and any individual sample that is slow to answer gets a
+// hedge probe — the faster of the pair counts. One lucky or unlucky handshake
+// no longer dominates the ranking: the headline number is the median, with
+// p95 and jitter reported alongside for the server-select UI.
+const MAX_CONCURRENT_REGIONS = 6;
+const SAMPLES_PER_REGION = 5;
+const PROBE_TIMEOUT_MS = 1500;
+const HEDGE_DELAY_MS = 300;
+const INTER_SAMPLE_DELAY_MS = 50;
+
+export interface ProbeStatistics {
+  p50Ms: number;
+  p95Ms: number;
+  jitterMs: number;
+}
+
+function delay(ms: number): Promise<void> {
+  return new Promise((resolve) => setTimeout(resolve, ms));
+}
+
 export async function tcpPing(
   hostname: string,
   port: number,
@@ -32,53 +54,121 @@ export async function tcpPing(
   });
 }
 
-export async function pingRegions(regions: StreamRegion[]): Promise<PingResult[]> {
-  const pingPromises = regions.map(async (region) => {
-    try {
-      const url = new URL(region.url);
-      const hostname = url.hostname;
-      const port = url.protocol === "https:" ? 443 : 80;
-
-      const validPings: number[] = [];
-
-      // Warm-up ping (result discarded) to prime the TCP path before measuring.
-      // The first cold-start connect includes DNS resolution and TCP SYN overhead
-      // which inflates subsequent measurements if not accounted for.
-      await tcpPing(hostname, port, 3000);
-
-      // Run 3 measured ping tests with a brief delay between each to allow
-      // the previous socket to fully close before opening the next connection.
-      for (let i = 0; i < 3; i++) {
-        if (i > 0) {
-          await new Promise<void>((resolve) => setTimeout(resolve, 100));
-        }
-        const pingMs = await tcpPing(hostname, port, 3000);
-        if (pingMs !== null) {
-          validPings.push(pingMs);
-        }
+/** Nearest-rank percentile over an ascending-sorted sample array. */
+export function percentileMs(sortedSamples: number[], fraction: number): number {
+  if (sortedSamples.length === 0) return 0;
+  const rank = Math.min(
+    sortedSamples.length - 1,
+    Math.max(0, Math.ceil(fraction * sortedSamples.length) - 1),
+  );
+  return sortedSamples[rank];
+}
+
+/**
+ * p50/p95 and jitter (mean absolute successive difference, RFC 3550 style)
+ * over the samples in collection order. Null when no sample succeeded.
+ */
+export function summarizeProbeSamples(samples: number[]): ProbeStatistics | null {
+  if (samples.length === 0) return null;
+
+  const sorted = [...samples].sort((a, b) => a - b);
+  let jitterTotal = 0;
+  for (let i = 1; i < samples.length; i++) {
+    jitterTotal += Math.abs(samples[i] - samples[i - 1]);
+  }
+
+  return {
+    p50Ms: Math.round(percentileMs(sorted, 0.5)),
+    p95Ms: Math.round(percentileMs(sorted, 0.95)),
+    jitterMs: samples.length > 1 ? Math.round(jitterTotal / (samples.length - 1)) : 0,
+  };
+}
+
+/**
+ * One connect sample with hedging: if the first probe has not answered within
+ * HEDGE_DELAY_MS, a second probe races it and the faster connect wins. A
+ * transient SYN loss then costs ~HEDGE_DELAY_MS instead of a full timeout.
+ */
+async function hedgedConnectSample(hostname: string, port: number): Promise<number | null> {
+  const first = tcpPing(hostname, port, PROBE_TIMEOUT_MS);
+  const quick = await Promise.race([
+    first,
+    delay(HEDGE_DELAY_MS).then(() => "hedge" as const),
+  ]);
+  if (quick !== "hedge") {
+    return quick;
+  }
+
+  const second = tcpPing(hostname, port, PROBE_TIMEOUT_MS);
+  return new Promise((resolve) => {
+    let pendingProbes = 2;
+    const settle = (value: number | null): void => {
+      pendingProbes -= 1;
+      if (value !== null || pendingProbes === 0) {
+        resolve(value);
       }
+    };
+    void first.then(settle);
+    void second.then(settle);
+  });
+}
+
+async function probeRegion(region: StreamRegion): Promise<PingResult> {
+  try {
+    const url = new URL(region.url);
+    const hostname = url.hostname;
+    const port = url.protocol === "https:" ? 443 : 80;
+
+    // Warm-up ping (result discarded) to prime the TCP path before measuring.
+    // The first cold-start connect includes DNS resolution and TCP SYN overhead
+    // which inflates subsequent measurements if not accounted for.
+    await tcpPing(hostname, port, PROBE_TIMEOUT_MS);
 
-      // Calculate average of successful pings
-      if (validPings.length > 0) {
-        const avgPing = Math.round(
-          validPings.reduce((a, b) => a + b, 0) / validPings.length,
-        );
-        return { url: region.url, pingMs: avgPing };
-      } else {
-        return {
-          url: region.url,
-          pingMs: null,
-          error: "All ping tests failed",
-        };
+    const samples: number[] = [];
+    for (let i = 0; i < SAMPLES_PER_REGION; i++) {
+      if (i > 0) {
+        await delay(INTER_SAMPLE_DELAY_MS);
+      }
+      const sample = await hedgedConnectSample(hostname, port);
+      if (sample !== null) {
+        samples.push(sample);
       }
-    } catch {
-      return {
-        url: region.url,
-        pingMs: null,
-        error: "Invalid URL",
-      };
     }
-  });
 
-  return Promise.all(pingPromises);
+    const stats = summarizeProbeSamples(samples);
+    if (!stats) {
+      return { url: region.url, pingMs: null, error: "All ping tests failed" };
+    }
+    return {
+      url: region.url,
+      pingMs: stats.p50Ms,
+      p95Ms: stats.p95Ms,
+      jitterMs: stats.jitterMs,
+      samples: samples.length,
+    };
+  } catch {
+    return {
+      url: region.url,
+      pingMs: null,
+      error: "Invalid URL",
+    };
+  }
+}
+
+export async function pingRegions(regions: StreamRegion[]): Promise<PingResult[]> {
+  const results: PingResult[] = new Array(regions.length);
+  let nextIndex = 0;
+
+  const workers = Array.from(
+    { length: Math.min(MAX_CONCURRENT_REGIONS, regions.length) },
+    async () => {
+      while (nextIndex < regions.length) {
+        const index = nextIndex++;
+        results[index] = await probeRegion(regions[index]);
+      }
+    },
+  );
+  await Promise.all(workers);
+
+  return results;
 }
@@ -174,6 +174,18 @@ export class SignalingCoordinator {
     this.nativeStreamerFallbackSessionId = null;
   }
 
+  /**
+   * Warms a standby native streamer process when native streaming is the
+   * selected client, so the first Play after app start skips process spawn
+   * and GStreamer init.
+   */
+  prewarmNativeStreamer(): void {
+    if (!this.isNativeStreamerSelected()) {
+      return;
+    }
+    this.getNativeStreamerManager().prewarm("app start");
+  }
+
   stopNativeStreamer(reason: string): void {
     void this.nativeStreamerManager?.stop(reason);
   }
@@ -233,6 +245,9 @@ export class SignalingCoordinator {
       );
       this.resetNativeStreamerContext();
     }
+    if (key === "streamClientMode" && value === "native") {
+      this.getNativeStreamerManager().prewarm("native streamer selected");
+    }
     if (key === "nativeVideoBackend") {
       if (this.nativeStreamerHasActiveSession()) {
         console.log(
@@ -330,6 +345,7 @@ export class SignalingCoordinator {
       getD3dFullscreenMode: () =>
         this.deps.settingsManager?.get("nativeD3dFullscreenMode") ?? "auto",
       getExternalRendererEnabled: () => true,
+      getWarmPoolEnabled: () => this.isNativeStreamerSelected(),
       emit: (event) => this.emitToRenderer(event),
       sendAnswer: async (payload) => {
         if (!this.signalingClient) {
@@ -475,6 +491,7 @@ export function registerSignalingIpcHandlers(
 ): SignalingCoordinator {
   const coordinator = new SignalingCoordinator(deps);
   coordinator.registerIpcHandlers();
+  coordinator.prewarmNativeStreamer();
   return coordinator;
 }
 
@@ -243,6 +243,12 @@ const api: OpenNowApi = {
     ipcRenderer.invoke(IPC_CHANNELS.MEDIA_REGEN_THUMBNAIL, input),
   deleteCache: (): Promise<void> =>
     ipcRenderer.invoke(IPC_CHANNELS.CACHE_DELETE_ALL),
+  loadCatalogSnapshotSection: (input: { part: "summary" | "full" }): Promise<string | null> =>
+    ipcRenderer.invoke(IPC_CHANNELS.CATALOG_SNAPSHOT_LOAD, input),
+  saveCatalogSnapshotFile: (input: { summaryJson: string; fullJson: string }): Promise<void> =>
+    ipcRenderer.invoke(IPC_CHANNELS.CATALOG_SNAPSHOT_SAVE, input),
+  clearCatalogSnapshotFile: (): Promise<void> =>
+    ipcRenderer.invoke(IPC_CHANNELS.CATALOG_SNAPSHOT_CLEAR),
   fetchPrintedWasteQueue: (): Promise<PrintedWasteQueueData> =>
     ipcRenderer.invoke(IPC_CHANNELS.PRINTEDWASTE_QUEUE_FETCH),
   fetchPrintedWasteServerMapping: (): Promise<PrintedWasteServerMapping> =>
@@ -16,6 +16,7 @@ import type {
   GamePanelResult,
   LoginProvider,
   MainToRendererSignalingEvent,
+  NativeStreamStats,
   NativeStreamerShortcutAction,
   SessionInfo,
   SessionStopRequest,
@@ -36,6 +37,8 @@ import {
   resolveEntitledStreamProfile,
   SAFE_FALLBACK_STREAM_PROFILE,
 } from "@shared/gfn";
+import { decodeNativeStatsFrame } from "@shared/nativeStatsFrame";
+import { FramePacingEngine, type FramePacingContext } from "@shared/framePacing";
 import { GfnWebRtcClient } from "./gfn/webrtcClient";
 import { formatShortcutForDisplay, isShortcutMatch, normalizeShortcut } from "./shortcuts";
 import { dispatchStreamShortcutAction } from "./streamShortcutActions";
@@ -54,7 +57,8 @@ import { loadCatalogPreferences, saveCatalogPreferences, VARIANT_SELECTION_LOCAL
 import {
   buildCatalogQueryKey,
   clearCatalogSnapshot,
-  loadCatalogSnapshot,
+  loadCatalogSnapshotFull,
+  loadCatalogSnapshotSummary,
   saveCatalogSnapshot,
 } from "./lib/catalogSnapshot";
 import { loadStoredCodecResults, saveStoredCodecResults, testCodecSupport, type CodecTestResult } from "./lib/codecDiagnostics";
@@ -69,6 +73,7 @@ import {
   parseNumericId,
   sortLibraryGames,
 } from "./lib/gameCatalog";
+import { buildGameSearchIndex } from "./lib/gameSearchIndex";
 import { chooseAccountLinked, getEpicOwnershipLaunchError } from "./lib/launchOwnership";
 import { hasAnyEligiblePrintedWasteZone, isAllianceStreamingBaseUrl } from "./lib/printedWaste";
 import {
@@ -452,6 +457,12 @@ export function App(): JSX.Element {
   const diagnosticsStoreRef = useRef<ReturnType<typeof createStreamDiagnosticsStore> | null>(null);
   const diagnosticsStore =
     diagnosticsStoreRef.current ?? (diagnosticsStoreRef.current = createStreamDiagnosticsStore(defaultDiagnostics()));
+  const framePacingEngineRef = useRef<FramePacingEngine | null>(null);
+  const framePacingContextRef = useRef<FramePacingContext>({ displayRefreshHz: 0, vrrActive: false });
+  const framePacingLastLogRef = useRef("");
+  // Survives stream teardown on purpose: the hint from the measured stream
+  // feeds the negotiated profile of the next session.
+  const pacingFpsHintRef = useRef<number | undefined>(undefined);
 
   // Stream State
   const [session, setSession] = useState<SessionInfo | null>(null);
@@ -600,6 +611,9 @@ export function App(): JSX.Element {
   const runtimeDataLoadIdRef = useRef(0);
   const lastCatalogQueryRef = useRef<string | null>(null);
   const lastCatalogProxyUrlRef = useRef<string | undefined>(undefined);
+  // Bumped whenever catalog/library data arrives from the network, so a
+  // deferred full-snapshot hydration knows not to overwrite fresher data.
+  const catalogNetworkVersionRef = useRef(0);
   const signalingRecoveryRef = useRef<SignalingRecoveryState>({
     attemptCount: 0,
     inFlight: null,
@@ -1200,10 +1214,52 @@ export function App(): JSX.Element {
       sessionId: activeSession.sessionId,
       signalingServer: activeSession.signalingServer,
       signalingUrl: activeSession.signalingUrl,
-      nativeStreamer: buildNativeStreamerSessionContext(activeSession, streamSettings, nativeStreamerShortcuts),
+      nativeStreamer: buildNativeStreamerSessionContext(
+        activeSession,
+        streamSettings,
+        nativeStreamerShortcuts,
+        pacingFpsHintRef.current,
+      ),
     };
   }, [buildCurrentStreamSettings, nativeStreamerShortcuts]);
 
+  /**
+   * Feeds one native stats sample to the frame-pacing engine and surfaces its
+   * decision in the diagnostics snapshot. The server fps hint it derives is
+   * kept for the next session context (see buildSignalingConnectRequest).
+   */
+  const recordFramePacingSample = useCallback((stats: NativeStreamStats): void => {
+    const engine =
+      framePacingEngineRef.current ?? (framePacingEngineRef.current = new FramePacingEngine());
+    engine.push(performance.now(), stats.sinkRendered ?? stats.framesRendered);
+    const decision = engine.decide(framePacingContextRef.current);
+    if (decision.mode === "measuring") {
+      return;
+    }
+    if (decision.serverFpsHint !== null) {
+      pacingFpsHintRef.current = decision.serverFpsHint;
+    }
+    const snapshot = diagnosticsStore.getSnapshot();
+    if (
+      snapshot.framePacingMode !== decision.mode ||
+      snapshot.framePacingMeasuredFps !== decision.measuredFps ||
+      snapshot.framePacingServerFpsHint !== (decision.serverFpsHint ?? undefined)
+    ) {
+      diagnosticsStore.set({
+        ...snapshot,
+        framePacingMode: decision.mode,
+        framePacingMeasuredFps: decision.measuredFps,
+        framePacingCadenceFps: decision.cadenceFps ?? undefined,
+        framePacingServerFpsHint: decision.serverFpsHint ?? undefined,
+      });
+    }
+    const logKey = `${decision.mode}:${decision.serverFpsHint ?? "none"}`;
+    if (framePacingLastLogRef.current !== logKey) {
+      framePacingLastLogRef.current = logKey;
+      console.log(`[FramePacing] ${decision.detail}`);
+    }
+  }, [diagnosticsStore]);
+
   // Propagate shortcut binding changes to native process during active session
   useEffect(() => {
     if (streamStatus !== "streaming" || !session || !nativeStreamingRef.current) {
@@ -1581,6 +1637,7 @@ export function App(): JSX.Element {
   }, [updateSetting]);
 
   const applyCatalogBrowseResult = useCallback((catalogResult: CatalogBrowseResult): void => {
+    catalogNetworkVersionRef.current += 1;
     setGames(catalogResult.games);
     setCatalogFilterGroups(catalogResult.filterGroups);
     setCatalogSortOptions(catalogResult.sortOptions);
@@ -1605,7 +1662,7 @@ export function App(): JSX.Element {
     }
 
     saveCatalogSnapshot({
-      version: 1,
+      version: 2,
       userId: session.user.userId,
       streamingBaseUrl: session.provider.streamingServiceUrl,
       queryKey,
@@ -1619,34 +1676,48 @@ export function App(): JSX.Element {
     });
   }, []);
 
-  const hydrateCatalogSnapshot = useCallback((session: AuthSession, proxyUrl: string | undefined = activeSessionProxyUrl): string | null => {
+  const hydrateCatalogSnapshot = useCallback(async (session: AuthSession, proxyUrl: string | undefined = activeSessionProxyUrl): Promise<string | null> => {
     if (hasSessionProxyCredentials(proxyUrl)) {
       clearCatalogSnapshot();
       return null;
     }
 
     const queryKey = buildProxyAwareCatalogQueryKey("", catalogSelectedFilterIds, catalogSelectedSortId, proxyUrl);
-    const snapshot = loadCatalogSnapshot(
+    const summary = await loadCatalogSnapshotSummary(
       session.user.userId,
       session.provider.streamingServiceUrl,
       queryKey,
     );
-    if (!snapshot) {
+    if (!summary) {
       return null;
     }
 
-    setGames(snapshot.games);
-    setLibraryGames(snapshot.libraryGames);
-    setCatalogFilterGroups(snapshot.filterGroups);
-    setCatalogSortOptions(snapshot.sortOptions);
-    setCatalogTotalCount(snapshot.totalCount);
-    setCatalogSupportedCount(snapshot.supportedCount);
+    // Paint the home screen from the lightweight summary right away; the full
+    // section (variants, descriptions, store metadata) hydrates just below.
+    setGames(summary.games);
+    setLibraryGames(summary.libraryGames);
+    setCatalogFilterGroups(summary.filterGroups);
+    setCatalogSortOptions(summary.sortOptions);
+    setCatalogTotalCount(summary.totalCount);
+    setCatalogSupportedCount(summary.supportedCount);
     setSelectedGameId((previous) => (
-      snapshot.games.some((game) => game.id === previous) ? previous : (snapshot.games[0]?.id ?? "")
+      summary.games.some((game) => game.id === previous) ? previous : (summary.games[0]?.id ?? "")
     ));
-    applyVariantSelections([...snapshot.games, ...snapshot.libraryGames]);
     lastCatalogQueryRef.current = queryKey;
     lastCatalogProxyUrlRef.current = proxyUrl;
+
+    const networkVersion = catalogNetworkVersionRef.current;
+    void loadCatalogSnapshotFull(
+      session.user.userId,
+      session.provider.streamingServiceUrl,
+      queryKey,
+    ).then((snapshot) => {
+      // Skip the swap if a network result already landed — it is fresher.
+      if (!snapshot || catalogNetworkVersionRef.current !== networkVersion) return;
+      setGames(snapshot.games);
+      setLibraryGames(snapshot.libraryGames);
+      applyVariantSelections([...snapshot.games, ...snapshot.libraryGames]);
+    });
     return queryKey;
   }, [activeSessionProxyUrl, applyVariantSelections, catalogSelectedFilterIds, catalogSelectedSortId]);
 
@@ -1727,6 +1798,7 @@ export function App(): JSX.Element {
       proxyUrl,
     }).then((libGames) => {
       if (!isCurrentLoad()) return;
+      catalogNetworkVersionRef.current += 1;
       latestLibraryGames = libGames;
       setLibraryGames(libGames);
       applyVariantSelections(libGames);
@@ -1831,7 +1903,7 @@ export function App(): JSX.Element {
         setProviderIdpId(activeProviderId);
 
         if (persistedSession) {
-          const hydrated = hydrateCatalogSnapshot(persistedSession, loadedSessionProxyUrl);
+          const hydrated = await hydrateCatalogSnapshot(persistedSession, loadedSessionProxyUrl);
           void loadSessionRuntimeData(persistedSession, { background: hydrated !== null, proxyUrl: loadedSessionProxyUrl });
         } else {
           runtimeDataLoadIdRef.current += 1;
@@ -2811,6 +2883,19 @@ export function App(): JSX.Element {
         } else if (event.type === "native-stream-started") {
           console.log("[App] Native streamer started:", event.message ?? "");
           activateNativeInputForCurrentSession(nativeInputProtocolVersionRef.current ?? undefined);
+          framePacingEngineRef.current?.reset();
+          framePacingLastLogRef.current = "";
+          void window.openNow.getNativeCloudGsyncCapabilities()
+            .then((capabilities) => {
+              framePacingContextRef.current = {
+                displayRefreshHz: capabilities.displayRefreshHz ?? 0,
+                vrrActive:
+                  capabilities.platformSupportsCloudGsync && capabilities.isVrrCapableDisplay,
+              };
+            })
+            .catch(() => {
+              framePacingContextRef.current = { displayRefreshHz: 0, vrrActive: false };
+            });
         } else if (event.type === "native-input-ready") {
           console.log("[App] Native input protocol ready:", event.protocolVersion);
           nativeInputProtocolVersionRef.current = event.protocolVersion;
@@ -2821,10 +2906,37 @@ export function App(): JSX.Element {
         } else if (event.type === "native-shortcut") {
           handleStreamShortcutActionRef.current?.(event.action);
         } else if (event.type === "native-stream-stats") {
+          diagnosticsStore.series.push(
+            event.stats.bitrateKbps,
+            event.stats.decodedFps,
+            event.stats.renderFps,
+            event.stats.sinkDropped ?? 0,
+          );
           diagnosticsStore.set(mergeNativeStreamStats(
             diagnosticsStore.getSnapshot(),
             event.stats,
           ));
+          recordFramePacingSample(event.stats);
+        } else if (event.type === "native-stream-stats-frame") {
+          const frameStats = decodeNativeStatsFrame(event.frame);
+          if (frameStats) {
+            diagnosticsStore.series.push(
+              frameStats.bitrateKbps,
+              frameStats.decodedFps,
+              frameStats.renderFps,
+              frameStats.sinkDropped ?? 0,
+            );
+            diagnosticsStore.set(mergeNativeStreamStats(
+              diagnosticsStore.getSnapshot(),
+              frameStats,
+            ));
+            recordFramePacingSample(frameStats);
+          }
+        } else if (event.type === "native-frame-latency") {
+          diagnosticsStore.set({
+            ...diagnosticsStore.getSnapshot(),
+            nativeFrameLatency: event.latency,
+          });
         } else if (event.type === "native-stream-transition") {
           diagnosticsStore.set({
             ...diagnosticsStore.getSnapshot(),
@@ -2843,6 +2955,9 @@ export function App(): JSX.Element {
           clientRef.current?.dispose();
           clientRef.current = null;
           launchInFlightRef.current = false;
+          diagnosticsStore.series.reset();
+          framePacingEngineRef.current?.reset();
+          framePacingLastLogRef.current = "";
 
           if (appUnloadingRef.current) {
             console.log("[Recovery] Ignoring native streamer stop during app shutdown");
@@ -2999,7 +3114,7 @@ export function App(): JSX.Element {
     });
 
     return () => unsubscribe();
-  }, [attemptSessionRecovery, diagnosticsStore, handleExpectedNativeSessionClose, refreshNavbarActiveSession, resetLaunchRuntime, scheduleStableRecoveryReset, settings, streamMicLevel, streamVolume, t]);
+  }, [attemptSessionRecovery, diagnosticsStore, handleExpectedNativeSessionClose, recordFramePacingSample, refreshNavbarActiveSession, resetLaunchRuntime, scheduleStableRecoveryReset, settings, streamMicLevel, streamVolume, t]);
 
   // Play game handler
   const handlePlayGame = useCallback(async (game: GameInfo, options?: { bypassGuards?: boolean; streamingBaseUrl?: string; variantId?: string }) => {
@@ -4029,15 +4144,23 @@ export function App(): JSX.Element {
 
   const filteredGames = games;
 
+  // Rebuilt only when the catalog itself changes; per-keystroke lookups are
+  // index probes instead of scanning every field of every game.
+  const libraryGamesSearchIndex = useMemo(() => buildGameSearchIndex(libraryGames), [libraryGames]);
+
   const filteredLibraryGames = useMemo(() => {
     const query = searchQuery.trim();
-    const searched = query ? libraryGames.filter((game) => matchesGameSearch(game, query)) : libraryGames;
+    const searched = query ? libraryGamesSearchIndex.query(query) : libraryGames;
+    if (query && catalogSelectedSortId === "relevance") {
+      // The index already ranks title matches above other-field matches.
+      return searched;
+    }
     return sortLibraryGames(
       searched,
       catalogSelectedSortId === "relevance" ? "last_played" : catalogSelectedSortId,
       playtime,
     );
-  }, [libraryGames, searchQuery, catalogSelectedSortId, playtime]);
+  }, [libraryGames, libraryGamesSearchIndex, searchQuery, catalogSelectedSortId, playtime]);
 
   const activeSessionAppIds = useMemo(
     () => (navbarActiveSession ? [navbarActiveSession.appId] : []),
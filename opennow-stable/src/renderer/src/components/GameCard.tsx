@@ -3,6 +3,8 @@ import { memo, useCallback, useMemo, useState } from "react";
 import type { JSX } from "react";
 import { normalizeGameStore } from "@shared/gfn";
 import type { GameInfo } from "@shared/gfn";
+import { cachedArtworkUrl } from "../lib/artwork";
+import { useArtworkBitmap } from "../lib/artworkBitmaps";
 import { getStoreOptions as getGameCardStoreOptions } from "../lib/gameCardStores";
 import { useTranslation } from "../i18n";
 
@@ -182,17 +184,32 @@ export const GameCard = memo(function GameCard({
   );
   const activeStoreOption = storeOptions.find((option) => option.isActive) ?? storeOptions[0];
 
-  const [aspectPct, setAspectPct] = useState<number | undefined>(undefined);
+  const artwork = useArtworkBitmap(game.imageUrl);
+
+  const [imageAspectPct, setImageAspectPct] = useState<number | undefined>(undefined);
+  const aspectPct = artwork.bitmap && artwork.bitmap.width > 0
+    ? (artwork.bitmap.height / artwork.bitmap.width) * 100
+    : imageAspectPct;
 
   const handleImageLoad = useCallback((event: React.SyntheticEvent<HTMLImageElement>) => {
     const img = event.currentTarget;
     const w = img.naturalWidth;
     const h = img.naturalHeight;
     if (w && h) {
-      setAspectPct((h / w) * 100);
+      setImageAspectPct((h / w) * 100);
     }
   }, []);
 
+  // Paints the worker-decoded bitmap; the canvas keeps its pixels even if
+  // the bitmap is later evicted from the shared cache.
+  const handleArtworkCanvas = useCallback((canvas: HTMLCanvasElement | null) => {
+    const bitmap = artwork.bitmap;
+    if (!canvas || !bitmap || bitmap.width === 0) return;
+    canvas.width = bitmap.width;
+    canvas.height = bitmap.height;
+    canvas.getContext("2d")?.drawImage(bitmap, 0, 0);
+  }, [artwork.bitmap]);
+
   const handlePlayClick = (event: React.MouseEvent): void => {
     event.stopPropagation();
     onPlay();
@@ -229,13 +246,22 @@ export const GameCard = memo(function GameCard({
         }
       >
         {game.imageUrl ? (
-          <img
-            src={game.imageUrl}
-            alt={game.title}
-            className="game-card-image"
-            loading="lazy"
-            onLoad={handleImageLoad}
-          />
+          artwork.status === "image-fallback" ? (
+            <img
+              src={cachedArtworkUrl(game.imageUrl)}
+              alt={game.title}
+              className="game-card-image"
+              loading="lazy"
+              onLoad={handleImageLoad}
+            />
+          ) : (
+            <canvas
+              ref={handleArtworkCanvas}
+              className="game-card-image"
+              role="img"
+              aria-label={game.title}
+            />
+          )
         ) : (
           <div className="game-card-image-placeholder">
             <Monitor size={40} />
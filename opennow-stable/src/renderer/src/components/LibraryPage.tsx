@@ -5,6 +5,8 @@ import { AnimatePresence, m } from "motion/react";
 import type { CatalogSortOption, GameInfo } from "@shared/gfn";
 import { getStoreDisplayName, getStoreIconComponent } from "./GameCard";
 import { GameCardListItem, useCatalogCardActionsRef } from "./GameCardListItem";
+import { useVirtualizedLibraryGrid } from "../hooks/useVirtualizedLibraryGrid";
+import { prefetchArtworkBitmaps } from "../lib/artworkBitmaps";
 import { useTranslation } from "../i18n";
 import { formatCatalogLastPlayed } from "../utils/lastPlayedFormat";
 import { controllerButton, readControllerGamepadButtons } from "../utils/controllerGamepad";
@@ -538,8 +540,11 @@ export const LibraryPage = memo(function LibraryPage({
     };
   }, [controllerMode, controllerSearchOpen, onNextControllerPage, onPreviousControllerPage]);
 
+  const virtualGrid = useVirtualizedLibraryGrid(games.length, !controllerMode);
+  const { startIndex, endIndex, topPadding, bottomPadding } = virtualGrid.window;
+
   const libraryGridItems = useMemo(
-    () => games.map((game) => (
+    () => games.slice(startIndex, endIndex).map((game) => (
       <div key={game.id} className="library-game-wrapper">
         <GameCardListItem
           game={game}
@@ -555,9 +560,18 @@ export const LibraryPage = memo(function LibraryPage({
         )}
       </div>
     )),
-    [catalogActionsRef, games, selectedGameId, selectedVariantByGameId, t],
+    [catalogActionsRef, endIndex, games, selectedGameId, selectedVariantByGameId, startIndex, t],
   );
 
+  // Warm the decode worker with the next screenful of artwork in the scroll
+  // direction, so cards entering the window paint on their first frame.
+  useEffect(() => {
+    if (controllerMode) return;
+    const { startIndex: prefetchStart, endIndex: prefetchEnd } = virtualGrid.prefetchRange;
+    if (prefetchStart >= prefetchEnd) return;
+    prefetchArtworkBitmaps(games.slice(prefetchStart, prefetchEnd).map((game) => game.imageUrl));
+  }, [controllerMode, games, virtualGrid.prefetchRange]);
+
   if (controllerMode) {
     const featuredGame = controllerFeaturedGames[controllerHeroIndex] ?? selectedControllerGame;
     const heroImageUrl = featuredGame ? getControllerHeroBackgroundCandidates(featuredGame)[0] : undefined;
@@ -843,7 +857,7 @@ export const LibraryPage = memo(function LibraryPage({
         <span className="library-count">{t("library.gameCount", { count: libraryCount })}</span>
       </header>
 
-      <div className="library-grid-area">
+      <div className="library-grid-area" ref={virtualGrid.containerRef} onScroll={virtualGrid.handleScroll}>
         {isLoading ? (
           <div className="library-empty-state">
             <Loader2 className="library-spinner" size={36} />
@@ -862,7 +876,16 @@ export const LibraryPage = memo(function LibraryPage({
             <p>{t("library.empty.noGamesMatch", { query: searchQuery })}</p>
           </div>
         ) : (
-          <div className="game-grid">
+          <div
+            className="game-grid"
+            ref={virtualGrid.gridRef}
+            style={{
+              paddingTop: topPadding > 0 ? `${topPadding}px` : undefined,
+              // The stylesheet's own bottom padding applies once the real
+              // end of the list is mounted.
+              paddingBottom: bottomPadding > 0 ? `${bottomPadding}px` : undefined,
+            }}
+          >
             {libraryGridItems}
           </div>
         )}
@@ -73,6 +73,7 @@ interface ZoneInfo {
   etaMs?: number;
   routingUrl: string; // always set for standard zones
   pingMs: number | null;
+  jitterMs: number | null;
 }
 
 // ── Component ─────────────────────────────────────────────────────────────────
@@ -92,6 +93,7 @@ export function QueueServerSelectModal({ game, initialQueueData = null, onConfir
 
   // Ping state — populated after queue data loads
   const [zonePings,  setZonePings]  = useState<Map<string, number | null> | null>(null);
+  const [zoneJitter, setZoneJitter] = useState<Map<string, number> | null>(null);
   const [isPinging,  setIsPinging]  = useState(false);
 
   const [selected, setSelected] = useState<"auto" | "closest" | string>("auto");
@@ -240,8 +242,13 @@ export function QueueServerSelectModal({ game, initialQueueData = null, onConfir
         const results = await window.openNow.pingRegions(regionsToTest);
         if (cancelled) return;
         const map = new Map(seedMap);
-        for (const r of results) map.set(r.url, r.pingMs);
+        const jitterMap = new Map<string, number>();
+        for (const r of results) {
+          map.set(r.url, r.pingMs);
+          if (r.jitterMs !== undefined) jitterMap.set(r.url, r.jitterMs);
+        }
         setZonePings(map);
+        setZoneJitter(jitterMap);
         saveStoredPrintedWastePingResults(map);
       } catch {
         // Ping failures are non-fatal
@@ -267,9 +274,10 @@ export function QueueServerSelectModal({ game, initialQueueData = null, onConfir
           etaMs: zone.eta,
           routingUrl,
           pingMs,
+          jitterMs: zoneJitter?.get(routingUrl) ?? null,
         };
       });
-  }, [queueData, zonePings, nukedZoneIds]);
+  }, [queueData, zonePings, zoneJitter, nukedZoneIds]);
 
   // If queue refresh removes a previously selected manual zone, fall back to auto.
   useEffect(() => {
@@ -283,17 +291,21 @@ export function QueueServerSelectModal({ game, initialQueueData = null, onConfir
   // ── Recommendations ───────────────────────────────────────────────────────
 
   // Auto: weighted lowest score with strict ping preference (75% ping + 25% queue).
-  // Falls back to queue-only
+  // Latency is judged as median + jitter so a zone with a good p50 but an
+  // unstable path does not outrank a steady one. Falls back to queue-only
   // when ping data isn't in yet.
   const autoZone = useMemo<ZoneInfo | null>(() => {
     if (zones.length === 0) return null;
-    const withPing = zones.filter((z) => z.pingMs !== null);
+    const latencyOf = (z: ZoneInfo): number | null => (
+      z.pingMs === null ? null : z.pingMs + (z.jitterMs ?? 0)
+    );
+    const withPing = zones.filter((z) => latencyOf(z) !== null);
     const pool     = withPing.length > 0 ? withPing : zones;
-    const maxPing  = Math.max(...pool.map((z) => z.pingMs ?? 999), 1);
+    const maxPing  = Math.max(...pool.map((z) => latencyOf(z) ?? 999), 1);
     const maxQueue = Math.max(...pool.map((z) => z.queuePosition), 1);
     return pool.reduce((best, z) => {
-      const score = ((z.pingMs ?? maxPing) / maxPing) * AUTO_PING_WEIGHT + (z.queuePosition / maxQueue) * AUTO_QUEUE_WEIGHT;
-      const bScore = ((best.pingMs ?? maxPing) / maxPing) * AUTO_PING_WEIGHT + (best.queuePosition / maxQueue) * AUTO_QUEUE_WEIGHT;
+      const score = ((latencyOf(z) ?? maxPing) / maxPing) * AUTO_PING_WEIGHT + (z.queuePosition / maxQueue) * AUTO_QUEUE_WEIGHT;
+      const bScore = ((latencyOf(best) ?? maxPing) / maxPing) * AUTO_PING_WEIGHT + (best.queuePosition / maxQueue) * AUTO_QUEUE_WEIGHT;
       if (score === bScore && z.pingMs !== null && best.pingMs !== null) {
         return z.pingMs < best.pingMs ? z : best;
       }
@@ -301,11 +313,13 @@ export function QueueServerSelectModal({ game, initialQueueData = null, onConfir
     }, pool[0]!);
   }, [zones]);
 
-  // Closest: lowest latency. Only available after pings complete.
+  // Closest: lowest median + jitter. Only available after pings complete.
   const closestZone = useMemo<ZoneInfo | null>(() => {
     const withPing = zones.filter((z) => z.pingMs !== null);
     if (withPing.length === 0) return null;
-    return withPing.reduce((best, z) => (z.pingMs! < best.pingMs! ? z : best));
+    return withPing.reduce((best, z) => (
+      (z.pingMs! + (z.jitterMs ?? 0)) < (best.pingMs! + (best.jitterMs ?? 0)) ? z : best
+    ));
   }, [zones]);
 
   // ── Grouped list ──────────────────────────────────────────────────────────
@@ -617,7 +631,11 @@ function RecommendCard({ label, sublabel, zone, selected, accent, pinging, disab
             {regionMeta?.flag} {zone.zoneId}
           </div>
           <div style={{ display: "flex", gap: 6, flexWrap: "wrap" }}>
-            {zone.pingMs !== null && <Chip color={getPingColor(zone.pingMs)}>{zone.pingMs}ms</Chip>}
+            {zone.pingMs !== null && (
+              <Chip color={getPingColor(zone.pingMs)}>
+                {zone.pingMs}ms{zone.jitterMs !== null && zone.jitterMs > 0 ? ` ±${zone.jitterMs}` : ""}
+              </Chip>
+            )}
             <Chip color={getQueueColor(zone.queuePosition)}>Queue: {zone.queuePosition}</Chip>
             {zone.etaMs !== undefined && <Chip color="#6b7280">{formatWait(zone.etaMs)} wait</Chip>}
           </div>
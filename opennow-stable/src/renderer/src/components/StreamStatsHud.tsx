@@ -128,6 +128,9 @@ export function StreamStatsHud({
         `Decoder recovery ${stats.decoderPressureActive ? "active" : "idle"} · attempts ${stats.decoderRecoveryAttempts} · action ${stats.decoderRecoveryAction}`,
       );
     }
+    if (stats.decoderPressureOutlook !== "learning" && stats.decoderPressureOutlook !== "steady") {
+      lines.push(`Decoder outlook ${stats.decoderPressureOutlook} · action ${stats.decoderRecoveryAction}`);
+    }
     if (stats.nativeTransitionSummary || stats.nativeQueueMode || stats.nativeCapsFramerate) {
       lines.push(
         `Native transition ${stats.nativeTransitionSummary ?? "none"} · queue ${stats.nativeQueueMode ?? "unknown"} · caps ${stats.nativeCapsFramerate ?? "unknown"}${typeof stats.nativeRequestedFps === "number" ? ` · requested ${stats.nativeRequestedFps}fps` : ""}${typeof stats.nativeFramesPendingToPresent === "number" ? ` · pending ${stats.nativeFramesPendingToPresent}` : ""}${typeof stats.nativePartialFlushCount === "number" || typeof stats.nativeCompleteFlushCount === "number" ? ` · flush ${stats.nativePartialFlushCount ?? 0}/${stats.nativeCompleteFlushCount ?? 0}` : ""}`,
@@ -138,6 +141,18 @@ export function StreamStatsHud({
         `Stream features requested ${stats.nativeRequestedStreamingFeaturesSummary ?? "none"} · finalized ${stats.nativeFinalizedStreamingFeaturesSummary ?? "none"}`,
       );
     }
+    const latency = stats.nativeFrameLatency;
+    if (latency) {
+      lines.push(
+        `Frame latency p50/p99 · queue ${latency.queueWait.p50Ms.toFixed(0)}/${latency.queueWait.p99Ms.toFixed(0)}ms · decode ${latency.decode.p50Ms.toFixed(0)}/${latency.decode.p99Ms.toFixed(0)}ms · present ${latency.present.p50Ms.toFixed(0)}/${latency.present.p99Ms.toFixed(0)}ms`,
+      );
+    }
+    const series = diagnosticsStore.series;
+    if (stats.nativeRendererActive && series.sampleCount() > 1) {
+      lines.push(
+        `Trend ${series.sampleCount()}s · bitrate avg ${(series.average("bitrateKbps") / 1000).toFixed(1)} peak ${(series.max("bitrateKbps") / 1000).toFixed(1)}Mbps · decode avg ${series.average("decodedFps").toFixed(0)}fps · drops ${series.latest("sinkDropped").toFixed(0)}`,
+      );
+    }
     const gpuRegion = [stats.gpuType, regionLabel].filter(Boolean).join(" · ");
     if (gpuRegion) lines.push(gpuRegion);
     if (hasLagIssue) {
@@ -145,6 +160,7 @@ export function StreamStatsHud({
     }
     return lines;
   }, [
+    diagnosticsStore,
     gstreamerEnabled,
     hasLagIssue,
     mouseResidualText,
@@ -16,7 +16,7 @@ import { formatShortcutForDisplay, isShortcutMatch, normalizeShortcut, shortcutF
 import { addStreamShortcutActionListener } from "../streamShortcutActions";
 import { useMicMeter } from "../hooks/useMicMeter";
 import { formatElapsed } from "../utils/timeFormat";
-import { useTranslation } from "../i18n";
+import { preloadTranslationNamespaces, STREAM_TRANSLATION_NAMESPACES, useTranslation } from "../i18n";
 
 const ANTI_AFK_TOGGLE_ACK_MS = 5000;
 
@@ -440,6 +440,13 @@ export function StreamView({
   className,
 }: StreamViewProps): JSX.Element {
   const { t } = useTranslation();
+
+  // Stream HUD namespaces stay out of the startup bundles; warm them as soon
+  // as the stream view mounts so the overlay never flashes English.
+  useEffect(() => {
+    void preloadTranslationNamespaces(STREAM_TRANSLATION_NAMESPACES);
+  }, []);
+
   const [showHints, setShowHints] = useState(true);
   const [showSessionClock, setShowSessionClock] = useState(false);
   const [antiAfkToggleAck, setAntiAfkToggleAck] = useState<"on" | "off" | null>(null);
@@ -0,0 +1,64 @@
+// Gamepad tick worker: runs the poll cadence on a worker-owned timer so
+// gamepad sampling no longer depends on renderer main-thread timers, which
+// get rAF-aligned and clamped during render stalls or occlusion. The Gamepad
+// API is window-only, so navigator.getGamepads() itself still runs on the
+// main thread — this worker only emits the ticks that drive it.
+
+export interface GamepadTickStartMessage {
+  type: "start";
+  intervalMs: number;
+}
+
+export interface GamepadTickIntervalMessage {
+  type: "interval";
+  intervalMs: number;
+}
+
+export interface GamepadTickStopMessage {
+  type: "stop";
+}
+
+export type GamepadTickInboundMessage =
+  | GamepadTickStartMessage
+  | GamepadTickIntervalMessage
+  | GamepadTickStopMessage;
+
+export interface GamepadTickMessage {
+  type: "tick";
+}
+
+const workerScope = self as unknown as {
+  postMessage(message: GamepadTickMessage): void;
+  onmessage: ((event: MessageEvent<GamepadTickInboundMessage>) => void) | null;
+  close(): void;
+};
+
+let tickTimer: ReturnType<typeof setInterval> | null = null;
+
+function startTicking(intervalMs: number): void {
+  if (tickTimer !== null) {
+    clearInterval(tickTimer);
+  }
+  tickTimer = setInterval(() => {
+    workerScope.postMessage({ type: "tick" });
+  }, Math.max(1, intervalMs));
+}
+
+workerScope.onmessage = (event: MessageEvent<GamepadTickInboundMessage>) => {
+  const message = event.data;
+  switch (message.type) {
+    case "start":
+    case "interval": {
+      startTicking(message.intervalMs);
+      break;
+    }
+    case "stop": {
+      if (tickTimer !== null) {
+        clearInterval(tickTimer);
+        tickTimer = null;
+      }
+      workerScope.close();
+      break;
+    }
+  }
+};
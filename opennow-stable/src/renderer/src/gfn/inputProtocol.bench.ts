@@ -0,0 +1,54 @@
+/// <reference types="node" />
+import { bench } from "@shared/bench";
+
+import { InputEncoder, type GamepadInput } from "./inputProtocol";
+
+// The input encode path runs per device event at up to 1kHz mouse polling
+// plus four 120Hz gamepads, so regressions here turn directly into input
+// latency. These cases mirror the Criterion group `input_encoder` in
+// native/opennow-streamer/benches/hot_paths.rs.
+
+function gamepadInput(controllerId: number, timestampUs: bigint): GamepadInput {
+  return {
+    controllerId,
+    buttons: 0x0084,
+    leftTrigger: 40,
+    rightTrigger: 0,
+    leftStickX: -1200,
+    leftStickY: 9800,
+    rightStickX: 300,
+    rightStickY: -4500,
+    connected: true,
+    timestampUs,
+  };
+}
+
+let timestampUs = 0n;
+
+{
+  const encoder = new InputEncoder();
+  encoder.setProtocolVersion(3);
+  bench("inputProtocol/encodeMouseMove", () => {
+    timestampUs += 1000n;
+    encoder.encodeMouseMove({ dx: 3, dy: -2, timestampUs });
+  });
+}
+
+{
+  const encoder = new InputEncoder();
+  encoder.setProtocolVersion(3);
+  bench("inputProtocol/encodeGamepadState_partiallyReliable", () => {
+    timestampUs += 1000n;
+    encoder.encodeGamepadState(gamepadInput(0, timestampUs), 0b1, true);
+  });
+}
+
+{
+  const encoder = new InputEncoder();
+  encoder.setProtocolVersion(3);
+  encoder.setInputRedundancy(3);
+  bench("inputProtocol/encodeGamepadState_redundancy3", () => {
+    timestampUs += 1000n;
+    encoder.encodeGamepadState(gamepadInput(0, timestampUs), 0b1, true);
+  });
+}
@@ -363,6 +363,65 @@ test("encodes gamepad state with reliable and partially reliable v3 wrappers", (
   }
 });
 
+test("repeats previous partially reliable gamepad states when redundancy is negotiated", () => {
+  const encoder = new InputEncoder();
+  encoder.setProtocolVersion(3);
+  encoder.setInputRedundancy(2);
+  const state = (controllerId: number, buttons: number) => ({
+    controllerId,
+    buttons,
+    leftTrigger: 0,
+    rightTrigger: 0,
+    leftStickX: 0,
+    leftStickY: 0,
+    rightStickX: 0,
+    rightStickY: 0,
+    connected: true,
+    timestampUs: 1n,
+  });
+  const SEGMENT_SIZE = 7 + GAMEPAD_PACKET_SIZE;
+  const readSegment = (bytes: Uint8Array, index: number) => {
+    const offset = 9 + index * SEGMENT_SIZE;
+    assert.equal(bytes[offset], 0x26);
+    const data = view(bytes);
+    return {
+      controllerId: bytes[offset + 1],
+      sequence: data.getUint16(offset + 2, false),
+      buttons: data.getUint16(offset + 7 + 12, true),
+    };
+  };
+
+  // First packet has no history; the next two carry the previous states.
+  const first = encoder.encodeGamepadState(state(1, GAMEPAD_A), 0x0102, true);
+  assert.equal(first.length, 9 + SEGMENT_SIZE);
+
+  const second = encoder.encodeGamepadState(state(1, GAMEPAD_B), 0x0102, true);
+  assert.equal(second.length, 9 + 2 * SEGMENT_SIZE);
+
+  const third = encoder.encodeGamepadState(state(1, GAMEPAD_X), 0x0102, true);
+  assert.equal(third.length, 9 + 3 * SEGMENT_SIZE);
+  assert.deepEqual(readSegment(third, 0), { controllerId: 1, sequence: 3, buttons: GAMEPAD_X });
+  assert.deepEqual(readSegment(third, 1), { controllerId: 1, sequence: 2, buttons: GAMEPAD_B });
+  assert.deepEqual(readSegment(third, 2), { controllerId: 1, sequence: 1, buttons: GAMEPAD_A });
+
+  // History is capped at the redundancy level and kept per controller.
+  const fourth = encoder.encodeGamepadState(state(1, GAMEPAD_Y), 0x0102, true);
+  assert.equal(fourth.length, 9 + 3 * SEGMENT_SIZE);
+  assert.deepEqual(readSegment(fourth, 2), { controllerId: 1, sequence: 2, buttons: GAMEPAD_B });
+  const otherPad = encoder.encodeGamepadState(state(2, GAMEPAD_A), 0x0102, true);
+  assert.equal(otherPad.length, 9 + SEGMENT_SIZE);
+
+  // Disabling redundancy and resetting sequences drop the history.
+  encoder.setInputRedundancy(0);
+  const plain = encoder.encodeGamepadState(state(1, GAMEPAD_A), 0x0102, true);
+  assert.equal(plain.length, 9 + SEGMENT_SIZE);
+  encoder.setInputRedundancy(2);
+  encoder.resetGamepadSequences();
+  const afterReset = encoder.encodeGamepadState(state(1, GAMEPAD_A), 0x0102, true);
+  assert.equal(afterReset.length, 9 + SEGMENT_SIZE);
+  assert.equal(readSegment(afterReset, 0).sequence, 1);
+});
+
 test("partially reliable HID helpers only mark mouse-relative input eligible", () => {
   assert.equal(partiallyReliableHidMaskForInputType(INPUT_MOUSE_REL), 1 << INPUT_MOUSE_REL);
   assert.equal(partiallyReliableHidMaskForInputType(-1), 0);
@@ -55,6 +55,8 @@ export const GAMEPAD_PACKET_SIZE = 38;
 export const GAMEPAD_DEADZONE = 0.15; // 15% radial deadzone
 export const PARTIALLY_RELIABLE_GAMEPAD_MASK_ALL = (1 << GAMEPAD_MAX_CONTROLLERS) - 1;
 export const PARTIALLY_RELIABLE_HID_DEVICE_MASK_ALL = 0xFFFFFFFF;
+/** Most previous gamepad states a PR packet may repeat (~45B per copy). */
+export const MAX_INPUT_REDUNDANCY = 3;
 
 export interface KeyboardPayload {
   keycode: number;
@@ -670,36 +672,50 @@ function wrapGamepadReliable(payload: Uint8Array, protocolVersion: number): Uint
 }
 
 /**
- * Protocol v3+ wrapper for GAMEPAD events on the PARTIALLY RELIABLE channel.
- * Format: [0x23][8B timestamp][0x26][1B gamepadIdx][2B seqNum BE][0x21][2B size BE][payload]
+ * Protocol v3+ segment for GAMEPAD events on the PARTIALLY RELIABLE channel:
+ * [0x26][1B gamepadIdx][2B seqNum BE][0x21][2B size BE][payload]
  *
  * Official GFN client's ul() adds [0x26][idx][seq] header when gamepad index is specified
  * (partially reliable path), then [0x21][2B size], then yc() prepends [0x23][8B ts].
  *
  * 0x26 = 38 decimal, PR sequence header byte (written by Va(38) in ul())
- *
- * For protocol v1-v2, returns the raw payload unchanged.
  */
-function wrapGamepadPartiallyReliable(
+function gamepadPartiallyReliableSegment(
   payload: Uint8Array,
-  protocolVersion: number,
   gamepadIndex: number,
   sequenceNumber: number,
 ): Uint8Array {
-  if (protocolVersion <= 2) {
-    return payload;
+  const segment = new Uint8Array(1 + 1 + 2 + 1 + 2 + payload.length);
+  const view = new DataView(segment.buffer);
+  segment[0] = 0x26;  // PR sequence header (decimal 38, written by Va(38))
+  segment[1] = gamepadIndex & 0xFF;  // gamepad index byte
+  view.setUint16(2, sequenceNumber, false);  // sequence number (BE, Wa() with no endian param)
+  segment[4] = 0x21;  // batched event marker
+  view.setUint16(5, payload.length, false);  // size (BE)
+  segment.set(payload, 7);
+  return segment;
+}
+
+/**
+ * Prepends the v3 packet header to one or more PR segments:
+ * [0x23][8B timestamp] followed by each segment verbatim. The batch framing
+ * allows several [0x26]-wrapped segments per packet, which the redundancy
+ * mode uses to repeat previous gamepad states.
+ */
+function wrapPartiallyReliableSegments(segments: Uint8Array[]): Uint8Array {
+  let length = 9;
+  for (const segment of segments) {
+    length += segment.length;
   }
-  // [0x23][8B ts][0x26][1B idx][2B seq][0x21][2B size][payload]
-  const wrapped = new Uint8Array(9 + 1 + 1 + 2 + 1 + 2 + payload.length);
+  const wrapped = new Uint8Array(length);
   const view = new DataView(wrapped.buffer);
   wrapped[0] = 0x23;
   writeTimestamp(view, 1);
-  wrapped[9] = 0x26;  // PR sequence header (decimal 38, written by Va(38))
-  wrapped[10] = gamepadIndex & 0xFF;  // gamepad index byte
-  view.setUint16(11, sequenceNumber, false);  // sequence number (BE, Wa() with no endian param)
-  wrapped[13] = 0x21;  // batched event marker
-  view.setUint16(14, payload.length, false);  // size (BE)
-  wrapped.set(payload, 16);
+  let offset = 9;
+  for (const segment of segments) {
+    wrapped.set(segment, offset);
+    offset += segment.length;
+  }
   return wrapped;
 }
 
@@ -708,11 +724,30 @@ export class InputEncoder {
   // Per-gamepad sequence numbers for partially reliable channel framing.
   // Official GFN client tracks this per-gamepad-index via this.tc Map.
   private gamepadSequence: Map<number, number> = new Map();
+  private inputRedundancy = 0;
+  // Previous PR segments per controller, newest first, repeated into
+  // outgoing packets when redundancy is negotiated.
+  private gamepadRedundancyHistory: Map<number, Uint8Array[]> = new Map();
 
   setProtocolVersion(version: number): void {
     this.protocolVersion = version;
   }
 
+  /**
+   * Enables plain-repetition redundancy on the partially reliable gamepad
+   * path: each packet additionally carries the previous `level` states for
+   * the same controller under their original sequence numbers. A single
+   * lost datagram is then repaired by the next packet instead of waiting
+   * out a retransmit, while the server's PR sequence tracking discards
+   * copies that already arrived. 0 (the default) restores 1:1 packets.
+   */
+  setInputRedundancy(level: number): void {
+    this.inputRedundancy = Math.max(0, Math.min(MAX_INPUT_REDUNDANCY, Math.floor(level)));
+    if (this.inputRedundancy === 0) {
+      this.gamepadRedundancyHistory.clear();
+    }
+  }
+
   /** Get and increment the sequence number for a gamepad on the PR channel.
    *  Wraps at 65536 (uint16 range), matching official client's cl() function. */
   getNextGamepadSequence(gamepadIndex: number): number {
@@ -723,6 +758,7 @@ export class InputEncoder {
 
   resetGamepadSequences(): void {
     this.gamepadSequence.clear();
+    this.gamepadRedundancyHistory.clear();
   }
 
   encodeLockKeysSync(state: number): Uint8Array {
@@ -877,7 +913,19 @@ export class InputEncoder {
     if (usePartiallyReliable) {
       // PR channel: [0x23][8B ts][0x26][1B idx][2B seq][0x21][2B size][38B payload]
       const seq = this.getNextGamepadSequence(payload.controllerId);
-      return wrapGamepadPartiallyReliable(bytes, this.protocolVersion, payload.controllerId, seq);
+      if (this.protocolVersion <= 2) {
+        return bytes;
+      }
+      const segment = gamepadPartiallyReliableSegment(bytes, payload.controllerId, seq);
+      if (this.inputRedundancy === 0) {
+        return wrapPartiallyReliableSegments([segment]);
+      }
+      const history = this.gamepadRedundancyHistory.get(payload.controllerId) ?? [];
+      const packet = wrapPartiallyReliableSegments([segment, ...history]);
+      history.unshift(segment);
+      history.length = Math.min(history.length, this.inputRedundancy);
+      this.gamepadRedundancyHistory.set(payload.controllerId, history);
+      return packet;
     }
     // Reliable channel: [0x23][8B ts][0x21][2B size][38B payload]
     return wrapGamepadReliable(bytes, this.protocolVersion);
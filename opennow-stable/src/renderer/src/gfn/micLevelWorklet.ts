@@ -0,0 +1,77 @@
+/**
+ * AudioWorklet-based microphone level metering. The processor computes a
+ * smoothed RMS level on the audio rendering thread and publishes it into a
+ * SharedArrayBuffer slot; meter readers sample that slot on their own paint
+ * schedule with a plain memory read. No per-frame messages cross to the main
+ * thread and no audio analysis runs there.
+ */
+
+export const MIC_LEVEL_PROCESSOR_NAME = "opennow-mic-level";
+
+/** Float32 slots published by the processor. */
+export const MIC_LEVEL_BUFFER_LENGTH = 1;
+
+// Registered from a Blob URL: worklet modules cannot import from the renderer
+// bundle, so the processor is self-contained source text. The decay constant
+// matches the 0.65 smoothing the AnalyserNode meter used.
+const MIC_LEVEL_PROCESSOR_SOURCE = `
+class MicLevelProcessor extends AudioWorkletProcessor {
+  constructor(options) {
+    super();
+    const levels = options && options.processorOptions ? options.processorOptions.levels : null;
+    this.levels = levels ? new Float32Array(levels) : null;
+    this.smoothed = 0;
+  }
+
+  process(inputs) {
+    const channel = inputs[0] && inputs[0][0];
+    if (this.levels && channel && channel.length > 0) {
+      let sum = 0;
+      for (let i = 0; i < channel.length; i++) {
+        sum += channel[i] * channel[i];
+      }
+      const rms = Math.sqrt(sum / channel.length);
+      this.smoothed = rms > this.smoothed ? rms : this.smoothed * 0.65 + rms * 0.35;
+      this.levels[0] = this.smoothed;
+    }
+    return true;
+  }
+}
+
+registerProcessor("${MIC_LEVEL_PROCESSOR_NAME}", MicLevelProcessor);
+`;
+
+export function createMicLevelBuffer(): SharedArrayBuffer | null {
+  if (typeof SharedArrayBuffer === "undefined") {
+    return null;
+  }
+  return new SharedArrayBuffer(MIC_LEVEL_BUFFER_LENGTH * Float32Array.BYTES_PER_ELEMENT);
+}
+
+/**
+ * Loads the processor into `audioCtx` and wires `source` into a worklet node
+ * that publishes levels into `buffer`. The caller keeps ownership of the
+ * context and node and must disconnect them on teardown.
+ */
+export async function attachMicLevelWorklet(
+  audioCtx: AudioContext,
+  source: MediaStreamAudioSourceNode,
+  buffer: SharedArrayBuffer,
+): Promise<AudioWorkletNode> {
+  const moduleUrl = URL.createObjectURL(
+    new Blob([MIC_LEVEL_PROCESSOR_SOURCE], { type: "application/javascript" }),
+  );
+  try {
+    await audioCtx.audioWorklet.addModule(moduleUrl);
+  } finally {
+    URL.revokeObjectURL(moduleUrl);
+  }
+
+  const node = new AudioWorkletNode(audioCtx, MIC_LEVEL_PROCESSOR_NAME, {
+    numberOfInputs: 1,
+    numberOfOutputs: 0,
+    processorOptions: { levels: buffer },
+  });
+  source.connect(node);
+  return node;
+}
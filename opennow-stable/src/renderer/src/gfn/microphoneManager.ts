@@ -37,6 +37,10 @@ export class MicrophoneManager {
 
   // Track if we should auto-retry with different devices on failure
   private attemptedDevices: Set<string> = new Set();
+
+  // Coalesced setEnabled state (see setEnabled).
+  private pendingEnabled: boolean | null = null;
+  private enabledFlushQueued = false;
   private readonly handleMicStreamInactive = (): void => {
     console.log("[Microphone] Stream inactive");
     this.tearDownMicProcessing();
@@ -508,9 +512,27 @@ export class MicrophoneManager {
   }
 
   /**
-   * Enable/disable microphone track (mute/unmute)
+   * Enable/disable microphone track (mute/unmute). Rapid toggles (push-to-talk
+   * key repeat, settings thrash) are coalesced to one microtask so only the
+   * final state touches the track and fires state-change callbacks.
    */
   setEnabled(enabled: boolean): void {
+    this.pendingEnabled = enabled;
+    if (this.enabledFlushQueued) {
+      return;
+    }
+    this.enabledFlushQueued = true;
+    queueMicrotask(() => {
+      this.enabledFlushQueued = false;
+      const target = this.pendingEnabled;
+      this.pendingEnabled = null;
+      if (target !== null) {
+        this.applyEnabled(target);
+      }
+    });
+  }
+
+  private applyEnabled(enabled: boolean): void {
     if (!this.micStream) {
       if (enabled && this.currentState !== "started") {
         this.initialize();
@@ -551,6 +573,9 @@ export class MicrophoneManager {
    * Check if microphone is currently enabled (unmuted)
    */
   isEnabled(): boolean {
+    if (this.pendingEnabled !== null) {
+      return this.pendingEnabled;
+    }
     if (!this.micStream) return false;
     const track = this.micStream.getAudioTracks()[0];
     return track?.enabled ?? false;
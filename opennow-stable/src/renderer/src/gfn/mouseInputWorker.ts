@@ -0,0 +1,406 @@
+// Dedicated mouse input worker: drains raw pointer deltas from the shared
+// ring (mouseRing.ts), runs the filter -> sensitivity -> quantize -> encode
+// pipeline and pushes packets onto the partially reliable data channel when
+// the channel was transferred here. The flush cadence lives entirely on the
+// worker's timer, so main-thread React renders or GC pauses no longer add
+// jitter to mouse sends.
+
+import { InputEncoder } from "./inputProtocol";
+import {
+  applyMouseResponseCurve,
+  chooseAdaptiveMouseFlushInterval,
+  MouseDeltaFilter,
+  quantizeMouseDeltaWithResidual,
+} from "./mousePipeline";
+import { MouseRingReader } from "./mouseRing";
+
+export interface MouseWorkerInitMessage {
+  type: "init";
+  ring: SharedArrayBuffer;
+  protocolVersion: number;
+  sensitivity: number;
+  accelerationPercent: number;
+  relaxedForRawInput: boolean;
+  scaleX: number;
+  scaleY: number;
+  baseIntervalMs: number;
+  minIntervalMs: number;
+  maxIntervalMs: number;
+  backpressureThresholdBytes: number;
+  statsIntervalMs: number;
+}
+
+export interface MouseWorkerChannelMessage {
+  type: "channel";
+  channel: RTCDataChannel;
+}
+
+export interface MouseWorkerConfigMessage {
+  type: "config";
+  protocolVersion?: number;
+  sensitivity?: number;
+  accelerationPercent?: number;
+  relaxedForRawInput?: boolean;
+  scaleX?: number;
+  scaleY?: number;
+  mousePartiallyReliable?: boolean;
+  inputReady?: boolean;
+}
+
+/** Pass-through send (gamepad etc.) when the channel lives on this worker. */
+export interface MouseWorkerSendMessage {
+  type: "send";
+  payload: ArrayBuffer;
+}
+
+export interface MouseWorkerResetMessage {
+  type: "reset";
+}
+
+export interface MouseWorkerCloseMessage {
+  type: "close";
+}
+
+export type MouseWorkerInboundMessage =
+  | MouseWorkerInitMessage
+  | MouseWorkerChannelMessage
+  | MouseWorkerConfigMessage
+  | MouseWorkerSendMessage
+  | MouseWorkerResetMessage
+  | MouseWorkerCloseMessage;
+
+/** Packet the main thread must forward (no channel here, or channel closed). */
+export interface MouseWorkerPacketMessage {
+  type: "packet";
+  payload: ArrayBuffer;
+  partiallyReliable: boolean;
+}
+
+export interface MouseWorkerChannelStateMessage {
+  type: "channel-state";
+  open: boolean;
+}
+
+export interface MouseWorkerStatsMessage {
+  type: "stats";
+  packetsPerSecond: number;
+  flushIntervalMs: number;
+  adaptiveFlushActive: boolean;
+  residualMagnitude: number;
+  maxSchedulingDelayMs: number;
+  droppedSamples: number;
+  /** Server-pixel deltas sent since the previous stats message. */
+  sentDx: number;
+  sentDy: number;
+}
+
+export type MouseWorkerOutboundMessage =
+  | MouseWorkerPacketMessage
+  | MouseWorkerChannelStateMessage
+  | MouseWorkerStatsMessage;
+
+interface WorkerState {
+  reader: MouseRingReader;
+  encoder: InputEncoder;
+  filter: MouseDeltaFilter;
+  channel: RTCDataChannel | null;
+  sensitivity: number;
+  accelerationPercent: number;
+  scaleX: number;
+  scaleY: number;
+  mousePartiallyReliable: boolean;
+  inputReady: boolean;
+  pendingDxFloat: number;
+  pendingDyFloat: number;
+  pendingTimestampUs: bigint | null;
+  baseIntervalMs: number;
+  minIntervalMs: number;
+  maxIntervalMs: number;
+  flushIntervalMs: number;
+  adaptiveFlushActive: boolean;
+  backpressureThresholdBytes: number;
+  lastTickMs: number;
+  maxSchedulingDelayMs: number;
+  packetsSentInWindow: number;
+  sentDxSinceStats: number;
+  sentDySinceStats: number;
+  statsIntervalMs: number;
+  statsWindowStartedAtMs: number;
+  flushTimer: ReturnType<typeof setTimeout> | null;
+}
+
+let state: WorkerState | null = null;
+
+const workerScope = self as unknown as {
+  postMessage(message: MouseWorkerOutboundMessage, transfer?: Transferable[]): void;
+  onmessage: ((event: MessageEvent<MouseWorkerInboundMessage>) => void) | null;
+  close(): void;
+};
+
+function postPacket(payload: Uint8Array, partiallyReliable: boolean): void {
+  // The encoder allocates per packet, so the buffer can be transferred.
+  const buffer = payload.buffer as ArrayBuffer;
+  workerScope.postMessage({ type: "packet", payload: buffer, partiallyReliable }, [buffer]);
+}
+
+function sendPacket(current: WorkerState, payload: Uint8Array, partiallyReliable: boolean): void {
+  if (partiallyReliable && current.channel?.readyState === "open") {
+    current.channel.send(payload as unknown as ArrayBufferView<ArrayBuffer>);
+    return;
+  }
+  // When the channel lives here but is unusable, mark the relayed packet as
+  // reliable so the main thread never routes it back to this worker.
+  postPacket(payload, partiallyReliable && current.channel === null);
+}
+
+function flushMouse(current: WorkerState): void {
+  const tickNow = performance.now();
+  if (current.lastTickMs > 0) {
+    const expected = current.lastTickMs + current.flushIntervalMs;
+    current.maxSchedulingDelayMs = Math.max(current.maxSchedulingDelayMs, Math.max(0, tickNow - expected));
+  }
+  current.lastTickMs = tickNow;
+
+  current.reader.drain((dx, dy, tsMs) => {
+    if (!current.filter.update(dx, dy, tsMs)) {
+      return;
+    }
+    const adjusted = applyMouseResponseCurve(
+      current.filter.getX(),
+      current.filter.getY(),
+      current.sensitivity,
+      current.accelerationPercent,
+    );
+    current.pendingDxFloat += adjusted.dx;
+    current.pendingDyFloat += adjusted.dy;
+    current.pendingTimestampUs = BigInt(Math.floor(tsMs * 1000));
+  });
+
+  if (!current.inputReady) {
+    return;
+  }
+
+  const hasPendingMovement =
+    Math.abs(current.pendingDxFloat) >= 0.5 || Math.abs(current.pendingDyFloat) >= 0.5;
+  if (!hasPendingMovement) {
+    return;
+  }
+
+  const dxQuantized = quantizeMouseDeltaWithResidual(current.pendingDxFloat);
+  const dyQuantized = quantizeMouseDeltaWithResidual(current.pendingDyFloat);
+  const dxServer = Math.max(-32768, Math.min(32767, Math.round(dxQuantized.send * current.scaleX)));
+  const dyServer = Math.max(-32768, Math.min(32767, Math.round(dyQuantized.send * current.scaleY)));
+  if (dxServer === 0 && dyServer === 0) {
+    // Keep pending movement intact until a non-zero packet is sent.
+    // Otherwise quantized integer deltas can be dropped when server scaling rounds to zero.
+    return;
+  }
+  current.pendingDxFloat = dxQuantized.residual;
+  current.pendingDyFloat = dyQuantized.residual;
+
+  const payload = current.encoder.encodeMouseMove({
+    dx: dxServer,
+    dy: dyServer,
+    timestampUs: current.pendingTimestampUs ?? BigInt(Math.floor(performance.now() * 1000)),
+  });
+  current.pendingTimestampUs = null;
+
+  sendPacket(current, payload, current.mousePartiallyReliable);
+  current.packetsSentInWindow += 1;
+  current.sentDxSinceStats += dxServer;
+  current.sentDySinceStats += dyServer;
+}
+
+function maybePostStats(current: WorkerState): void {
+  const now = performance.now();
+  if (current.statsWindowStartedAtMs <= 0) {
+    current.statsWindowStartedAtMs = now;
+    return;
+  }
+  const elapsed = now - current.statsWindowStartedAtMs;
+  if (elapsed < current.statsIntervalMs) {
+    return;
+  }
+  workerScope.postMessage({
+    type: "stats",
+    packetsPerSecond: Math.round((current.packetsSentInWindow * 1000) / elapsed),
+    flushIntervalMs: current.flushIntervalMs,
+    adaptiveFlushActive: current.adaptiveFlushActive,
+    residualMagnitude: Math.hypot(current.pendingDxFloat, current.pendingDyFloat),
+    maxSchedulingDelayMs: current.maxSchedulingDelayMs,
+    droppedSamples: current.reader.droppedSamples(),
+    sentDx: current.sentDxSinceStats,
+    sentDy: current.sentDySinceStats,
+  });
+  current.packetsSentInWindow = 0;
+  current.maxSchedulingDelayMs = 0;
+  current.sentDxSinceStats = 0;
+  current.sentDySinceStats = 0;
+  current.statsWindowStartedAtMs = now;
+}
+
+function scheduleNextFlush(current: WorkerState): void {
+  if (current.flushTimer !== null) {
+    clearTimeout(current.flushTimer);
+  }
+  current.flushTimer = setTimeout(() => {
+    try {
+      flushMouse(current);
+      current.flushIntervalMs = chooseAdaptiveMouseFlushInterval({
+        baseIntervalMs: current.baseIntervalMs,
+        currentIntervalMs: current.flushIntervalMs,
+        reliableBufferedAmount: current.channel?.bufferedAmount ?? 0,
+        schedulingDelayMs: current.maxSchedulingDelayMs,
+        canUsePartiallyReliableMouse: current.mousePartiallyReliable,
+        backpressureThresholdBytes: current.backpressureThresholdBytes,
+        minIntervalMs: current.minIntervalMs,
+        maxIntervalMs: current.maxIntervalMs,
+      });
+      current.adaptiveFlushActive = current.flushIntervalMs !== current.baseIntervalMs;
+      maybePostStats(current);
+    } finally {
+      if (current.flushTimer !== null) {
+        scheduleNextFlush(current);
+      }
+    }
+  }, current.flushIntervalMs);
+}
+
+function attachChannel(current: WorkerState, channel: RTCDataChannel): void {
+  current.channel = channel;
+  channel.binaryType = "arraybuffer";
+  if (channel.readyState === "open") {
+    workerScope.postMessage({ type: "channel-state", open: true });
+  }
+  channel.onopen = () => {
+    workerScope.postMessage({ type: "channel-state", open: true });
+  };
+  channel.onclose = () => {
+    workerScope.postMessage({ type: "channel-state", open: false });
+  };
+}
+
+function resetState(current: WorkerState): void {
+  current.filter.reset();
+  current.encoder.resetGamepadSequences();
+  current.pendingDxFloat = 0;
+  current.pendingDyFloat = 0;
+  current.pendingTimestampUs = null;
+  current.flushIntervalMs = current.baseIntervalMs;
+  current.adaptiveFlushActive = false;
+  current.lastTickMs = 0;
+  current.maxSchedulingDelayMs = 0;
+  current.packetsSentInWindow = 0;
+  current.sentDxSinceStats = 0;
+  current.sentDySinceStats = 0;
+  current.statsWindowStartedAtMs = 0;
+}
+
+workerScope.onmessage = (event: MessageEvent<MouseWorkerInboundMessage>) => {
+  const message = event.data;
+  switch (message.type) {
+    case "init": {
+      const encoder = new InputEncoder();
+      encoder.setProtocolVersion(message.protocolVersion);
+      state = {
+        reader: new MouseRingReader(message.ring),
+        encoder,
+        filter: new MouseDeltaFilter(),
+        channel: null,
+        sensitivity: message.sensitivity,
+        accelerationPercent: message.accelerationPercent,
+        scaleX: message.scaleX,
+        scaleY: message.scaleY,
+        mousePartiallyReliable: false,
+        inputReady: false,
+        pendingDxFloat: 0,
+        pendingDyFloat: 0,
+        pendingTimestampUs: null,
+        baseIntervalMs: message.baseIntervalMs,
+        minIntervalMs: message.minIntervalMs,
+        maxIntervalMs: message.maxIntervalMs,
+        flushIntervalMs: message.baseIntervalMs,
+        adaptiveFlushActive: false,
+        backpressureThresholdBytes: message.backpressureThresholdBytes,
+        lastTickMs: 0,
+        maxSchedulingDelayMs: 0,
+        packetsSentInWindow: 0,
+        sentDxSinceStats: 0,
+        sentDySinceStats: 0,
+        statsIntervalMs: message.statsIntervalMs,
+        statsWindowStartedAtMs: 0,
+        flushTimer: null,
+      };
+      state.filter.setRelaxedForRawInput(message.relaxedForRawInput);
+      scheduleNextFlush(state);
+      break;
+    }
+    case "channel": {
+      if (state) {
+        attachChannel(state, message.channel);
+      }
+      break;
+    }
+    case "config": {
+      if (!state) {
+        break;
+      }
+      if (message.protocolVersion !== undefined) {
+        state.encoder.setProtocolVersion(message.protocolVersion);
+      }
+      if (message.sensitivity !== undefined) {
+        state.sensitivity = message.sensitivity;
+      }
+      if (message.accelerationPercent !== undefined) {
+        state.accelerationPercent = message.accelerationPercent;
+      }
+      if (message.relaxedForRawInput !== undefined) {
+        state.filter.setRelaxedForRawInput(message.relaxedForRawInput);
+      }
+      if (message.scaleX !== undefined) {
+        state.scaleX = message.scaleX;
+      }
+      if (message.scaleY !== undefined) {
+        state.scaleY = message.scaleY;
+      }
+      if (message.mousePartiallyReliable !== undefined) {
+        state.mousePartiallyReliable = message.mousePartiallyReliable;
+      }
+      if (message.inputReady !== undefined) {
+        state.inputReady = message.inputReady;
+      }
+      break;
+    }
+    case "send": {
+      if (state?.channel?.readyState === "open") {
+        state.channel.send(message.payload);
+      } else {
+        // Channel gone: hand the packet back for the reliable fallback.
+        workerScope.postMessage({ type: "packet", payload: message.payload, partiallyReliable: false }, [
+          message.payload,
+        ]);
+      }
+      break;
+    }
+    case "reset": {
+      if (state) {
+        resetState(state);
+      }
+      break;
+    }
+    case "close": {
+      if (state?.flushTimer !== null && state !== null) {
+        clearTimeout(state.flushTimer);
+        state.flushTimer = null;
+      }
+      if (state?.channel) {
+        try {
+          state.channel.close();
+        } catch {}
+      }
+      state = null;
+      workerScope.close();
+      break;
+    }
+  }
+};
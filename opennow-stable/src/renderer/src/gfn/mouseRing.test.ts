@@ -0,0 +1,63 @@
+/// <reference types="node" />
+
+import test from "node:test";
+import assert from "node:assert/strict";
+
+import { createMouseRingBuffer, MouseRingReader, MouseRingWriter } from "./mouseRing";
+
+test("mouse ring delivers samples in write order", () => {
+  const buffer = createMouseRingBuffer(8);
+  const writer = new MouseRingWriter(buffer);
+  const reader = new MouseRingReader(buffer);
+
+  assert.ok(writer.push(1, -2, 100));
+  assert.ok(writer.push(3.5, 4.25, 101));
+  assert.ok(writer.push(-0.5, 0, 102));
+
+  const drained: Array<[number, number, number]> = [];
+  const count = reader.drain((dx, dy, tsMs) => drained.push([dx, dy, tsMs]));
+
+  assert.equal(count, 3);
+  assert.deepEqual(drained, [
+    [1, -2, 100],
+    [3.5, 4.25, 101],
+    [-0.5, 0, 102],
+  ]);
+  assert.equal(reader.drain(() => assert.fail("ring should be empty")), 0);
+});
+
+test("mouse ring survives index wraparound", () => {
+  const buffer = createMouseRingBuffer(4);
+  const writer = new MouseRingWriter(buffer);
+  const reader = new MouseRingReader(buffer);
+
+  for (let round = 0; round < 10; round++) {
+    assert.ok(writer.push(round, round * 2, 1000 + round));
+    assert.ok(writer.push(round + 0.5, round * 2 + 0.5, 1000.5 + round));
+    const drained: number[] = [];
+    reader.drain((dx) => drained.push(dx));
+    assert.deepEqual(drained, [round, round + 0.5]);
+  }
+});
+
+test("mouse ring drops and counts samples when full", () => {
+  const buffer = createMouseRingBuffer(2);
+  const writer = new MouseRingWriter(buffer);
+  const reader = new MouseRingReader(buffer);
+
+  assert.ok(writer.push(1, 1, 1));
+  assert.ok(writer.push(2, 2, 2));
+  assert.equal(writer.push(3, 3, 3), false);
+  assert.equal(writer.droppedSamples(), 1);
+
+  const drained: number[] = [];
+  reader.drain((dx) => drained.push(dx));
+  assert.deepEqual(drained, [1, 2]);
+  assert.ok(writer.push(4, 4, 4));
+  assert.equal(reader.droppedSamples(), 1);
+});
+
+test("mouse ring rejects invalid capacities", () => {
+  assert.throws(() => createMouseRingBuffer(0));
+  assert.throws(() => createMouseRingBuffer(1.5));
+});
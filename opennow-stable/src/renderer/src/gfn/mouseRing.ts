@@ -0,0 +1,100 @@
+// Lock-free single-producer/single-consumer ring over a SharedArrayBuffer.
+// The renderer main thread writes raw pointer deltas from its event handlers
+// (a few stores, no allocation) and the mouse input worker drains them on its
+// own flush cadence, so a React re-render or GC pause on the main thread never
+// delays mouse processing.
+
+export const MOUSE_RING_DEFAULT_CAPACITY = 1024;
+
+// Header is a full 32-byte slot so the sample region stays 8-byte aligned.
+const HEADER_INT32_COUNT = 8;
+const HEADER_BYTES = HEADER_INT32_COUNT * Int32Array.BYTES_PER_ELEMENT;
+const INDEX_WRITE = 0;
+const INDEX_READ = 1;
+const INDEX_DROPPED = 2;
+
+const FLOATS_PER_SAMPLE = 3; // dx, dy, event timestamp (ms)
+
+export function createMouseRingBuffer(capacity: number = MOUSE_RING_DEFAULT_CAPACITY): SharedArrayBuffer {
+  if (!Number.isInteger(capacity) || capacity <= 0) {
+    throw new Error(`Invalid mouse ring capacity: ${capacity}`);
+  }
+  return new SharedArrayBuffer(
+    HEADER_BYTES + capacity * FLOATS_PER_SAMPLE * Float64Array.BYTES_PER_ELEMENT,
+  );
+}
+
+function ringCapacity(buffer: SharedArrayBuffer): number {
+  return (buffer.byteLength - HEADER_BYTES) / (FLOATS_PER_SAMPLE * Float64Array.BYTES_PER_ELEMENT);
+}
+
+export class MouseRingWriter {
+  private readonly header: Int32Array;
+  private readonly samples: Float64Array;
+  private readonly capacity: number;
+
+  constructor(buffer: SharedArrayBuffer) {
+    this.header = new Int32Array(buffer, 0, HEADER_INT32_COUNT);
+    this.samples = new Float64Array(buffer, HEADER_BYTES);
+    this.capacity = ringCapacity(buffer);
+  }
+
+  /**
+   * Appends one sample. Indices grow monotonically (mod 2^32); the sample
+   * store happens before the Atomics release of the write index, which is
+   * what makes the data visible to the reader without a lock. When the ring
+   * is full the sample is dropped and counted — the reader drains every few
+   * milliseconds, so a full ring means the worker is gone, not slow.
+   */
+  public push(dx: number, dy: number, tsMs: number): boolean {
+    const writeIndex = Atomics.load(this.header, INDEX_WRITE);
+    const readIndex = Atomics.load(this.header, INDEX_READ);
+    if (((writeIndex - readIndex) | 0) >= this.capacity) {
+      Atomics.add(this.header, INDEX_DROPPED, 1);
+      return false;
+    }
+    const slot = ((writeIndex >>> 0) % this.capacity) * FLOATS_PER_SAMPLE;
+    this.samples[slot] = dx;
+    this.samples[slot + 1] = dy;
+    this.samples[slot + 2] = tsMs;
+    Atomics.store(this.header, INDEX_WRITE, (writeIndex + 1) | 0);
+    return true;
+  }
+
+  public droppedSamples(): number {
+    return Atomics.load(this.header, INDEX_DROPPED) >>> 0;
+  }
+}
+
+export class MouseRingReader {
+  private readonly header: Int32Array;
+  private readonly samples: Float64Array;
+  private readonly capacity: number;
+
+  constructor(buffer: SharedArrayBuffer) {
+    this.header = new Int32Array(buffer, 0, HEADER_INT32_COUNT);
+    this.samples = new Float64Array(buffer, HEADER_BYTES);
+    this.capacity = ringCapacity(buffer);
+  }
+
+  /** Drains all pending samples in write order. Returns the count drained. */
+  public drain(visit: (dx: number, dy: number, tsMs: number) => void): number {
+    let readIndex = Atomics.load(this.header, INDEX_READ);
+    const writeIndex = Atomics.load(this.header, INDEX_WRITE);
+    let drained = 0;
+    while (((writeIndex - readIndex) | 0) > 0) {
+      const slot = ((readIndex >>> 0) % this.capacity) * FLOATS_PER_SAMPLE;
+      visit(this.samples[slot], this.samples[slot + 1], this.samples[slot + 2]);
+      readIndex = (readIndex + 1) | 0;
+      drained += 1;
+    }
+    if (drained > 0) {
+      Atomics.store(this.header, INDEX_READ, readIndex);
+    }
+    return drained;
+  }
+
+  public droppedSamples(): number {
+    return Atomics.load(this.header, INDEX_DROPPED) >>> 0;
+  }
+}
@@ -0,0 +1,81 @@
+/// <reference types="node" />
+import { formatBenchResult, runBench, type BenchResult } from "@shared/bench";
+
+import { buildNvstSdp, extractIceCredentials, fixServerIp, mungeAnswerSdp, preferCodec } from "./sdp";
+
+// The SDP transforms run once per negotiation, but an accidental extra pass
+// over the offer multiplies directly into session start time. These cases
+// mirror the Criterion group `sdp` in
+// native/opennow-streamer/benches/hot_paths.rs.
+
+const offerSdp = [
+  "v=0",
+  "o=- 4611731400430051336 2 IN IP4 127.0.0.1",
+  "s=-",
+  "t=0 0",
+  "a=group:BUNDLE 0 1",
+  "c=IN IP4 0.0.0.0",
+  "a=ice-ufrag:2efecf37",
+  "a=ice-pwd:26b335b8-6cb2-4c18-96d0-963e5e586c9a",
+  "a=fingerprint:sha-256 AA:BB:CC:DD:EE:FF:00:11:22:33:44:55:66:77:88:99:AA:BB:CC:DD:EE:FF:00:11:22:33:44:55:66:77:88:99",
+  "m=audio 9 UDP/TLS/RTP/SAVPF 111",
+  "a=mid:0",
+  "a=rtpmap:111 OPUS/48000/2",
+  "a=fmtp:111 minptime=10;useinbandfec=1",
+  "m=video 9 UDP/TLS/RTP/SAVPF 96 97 98 99 100 101",
+  "a=mid:1",
+  "a=rtpmap:96 H264/90000",
+  "a=fmtp:96 profile-level-id=42e01f;packetization-mode=1",
+  "a=rtpmap:97 rtx/90000",
+  "a=fmtp:97 apt=96",
+  "a=rtpmap:98 H265/90000",
+  "a=fmtp:98 profile-id=1",
+  "a=rtpmap:99 H265/90000",
+  "a=fmtp:99 profile-id=2",
+  "a=rtpmap:100 AV1/90000",
+  "a=rtpmap:101 rtx/90000",
+  "a=fmtp:101 apt=100",
+  "a=framerate:60",
+  "a=candidate:1 1 udp 2130706431 10.0.0.7 49003 typ host",
+].join("\r\n");
+
+// preferCodec logs its decisions; measuring terminal I/O would drown the
+// transform itself, so the console is muted while measuring and the result
+// lines are printed afterwards.
+const consoleLog = console.log;
+console.log = () => {};
+
+const results: BenchResult[] = [];
+try {
+  results.push(runBench("sdp/preferCodec_hevc10bit", () => {
+    preferCodec(offerSdp, "H265", { preferHevcProfileId: 2 });
+  }));
+
+  results.push(runBench("sdp/fixServerIp", () => {
+    fixServerIp(offerSdp, "80-250-97-40.cloudmatchbeta.nvidiagrid.net");
+  }));
+
+  results.push(runBench("sdp/mungeAnswerSdp", () => {
+    mungeAnswerSdp(offerSdp, 75000);
+  }));
+
+  const credentials = extractIceCredentials(offerSdp);
+  results.push(runBench("sdp/buildNvstSdp", () => {
+    buildNvstSdp({
+      width: 2560,
+      height: 1440,
+      fps: 120,
+      maxBitrateKbps: 75000,
+      partialReliableThresholdMs: 16,
+      codec: "H265",
+      colorQuality: "10bit_420",
+      credentials,
+    });
+  }));
+} finally {
+  console.log = consoleLog;
+}
+
+for (const result of results) {
+  console.log(formatBenchResult(result));
+}
@@ -6,6 +6,7 @@ import type {
   VideoCodec,
   MicrophoneMode,
   NativeTransitionDiagnostics,
+  NativeFrameLatencyStats,
   NativeQueueMode,
   KeyboardLayout,
 } from "@shared/gfn";
@@ -13,6 +14,7 @@ import type {
 import {
   InputEncoder,
   INPUT_MOUSE_REL,
+  MAX_INPUT_REDUNDANCY,
   PARTIALLY_RELIABLE_GAMEPAD_MASK_ALL,
   PARTIALLY_RELIABLE_HID_DEVICE_MASK_ALL,
   partiallyReliableHidMaskForInputType,
@@ -29,6 +31,11 @@ import {
   type GamepadInput,
   codeMap,
 } from "./inputProtocol";
+import { getHotPathLogger } from "@shared/hotPathLog";
+import {
+  DecoderPressurePredictor,
+  type DecoderPressureForecast,
+} from "@shared/decoderPressure";
 import { FULLSCREEN_KEYBOARD_LOCK_CODES } from "./keyboardLock";
 import {
   buildNvstSdp,
@@ -40,6 +47,18 @@ import {
   rewriteH265TierFlag,
 } from "./sdp";
 import { MicrophoneManager, type MicState, type MicStateChange } from "./microphoneManager";
+import {
+  chooseAdaptiveMouseFlushInterval,
+  MouseDeltaFilter,
+  quantizeMouseDeltaWithResidual,
+} from "./mousePipeline";
+import { createMouseRingBuffer, MouseRingWriter } from "./mouseRing";
+import type {
+  GamepadTickIntervalMessage,
+  GamepadTickStartMessage,
+  GamepadTickStopMessage,
+} from "./gamepadTickWorker";
+import type { MouseWorkerInitMessage, MouseWorkerOutboundMessage } from "./mouseInputWorker";
 
 interface OfferSettings {
   codec: VideoCodec;
@@ -55,6 +74,8 @@ interface RiInputCapabilities {
   hidDeviceMask: number;
   enablePartiallyReliableTransferGamepad: number;
   enablePartiallyReliableTransferHid: number;
+  /** Previous gamepad states repeated per PR packet (0 = no redundancy). */
+  inputRedundancy: number;
 }
 
 interface DualRumbleEffectOptions {
@@ -180,6 +201,8 @@ export interface StreamDiagnostics {
   decoderPressureActive: boolean;
   decoderRecoveryAttempts: number;
   decoderRecoveryAction: string;
+  /** Predictive engine outlook: learning | steady | rising | headroom. */
+  decoderPressureOutlook: string;
   nativeRequestedFps?: number;
   nativeCapsFramerate?: string;
   nativeQueueMode?: NativeQueueMode;
@@ -189,6 +212,13 @@ export interface StreamDiagnostics {
   nativeTransitionSummary?: string;
   nativeRequestedStreamingFeaturesSummary?: string;
   nativeFinalizedStreamingFeaturesSummary?: string;
+  nativeFrameLatency?: NativeFrameLatencyStats;
+
+  // Frame pacing (native path; fed by the shared FramePacingEngine)
+  framePacingMode?: string;
+  framePacingMeasuredFps?: number;
+  framePacingCadenceFps?: number;
+  framePacingServerFpsHint?: number;
 
   // Microphone state
   micState: MicState;
@@ -281,6 +311,10 @@ function parseRiInputCapabilities(sdp: string): RiInputCapabilities {
       "ri.enablePartiallyReliableTransferHid",
       PARTIALLY_RELIABLE_HID_DEVICE_MASK_ALL,
     ),
+    inputRedundancy: Math.max(
+      0,
+      Math.min(MAX_INPUT_REDUNDANCY, parseRiIntegerAttribute(sdp, "ri.inputRedundancy", 0)),
+    ),
   };
 }
 
@@ -310,168 +344,13 @@ function getGamepadRumbleApi(gamepad: Gamepad): GamepadRumbleApi | null {
   return api.playEffectActuator || api.pulseActuator ? api : null;
 }
 
-export interface AdaptiveMouseFlushDecisionParams {
-  baseIntervalMs: number;
-  currentIntervalMs: number;
-  reliableBufferedAmount: number;
-  schedulingDelayMs: number;
-  canUsePartiallyReliableMouse: boolean;
-  backpressureThresholdBytes: number;
-  minIntervalMs: number;
-  maxIntervalMs: number;
-}
-
-export function chooseAdaptiveMouseFlushInterval(params: AdaptiveMouseFlushDecisionParams): number {
-  const boundedBase = Math.max(params.minIntervalMs, Math.min(params.maxIntervalMs, params.baseIntervalMs));
-  const boundedCurrent = Math.max(params.minIntervalMs, Math.min(params.maxIntervalMs, params.currentIntervalMs));
-  if (!params.canUsePartiallyReliableMouse) {
-    return boundedBase;
-  }
-
-  const highPressure =
-    params.reliableBufferedAmount >= params.backpressureThresholdBytes / 2
-    || params.schedulingDelayMs >= 4;
-  if (highPressure) {
-    return Math.max(boundedBase, Math.min(params.maxIntervalMs, boundedCurrent + 2));
-  }
-
-  const lowPressure = params.reliableBufferedAmount <= 4096 && params.schedulingDelayMs <= 1;
-  if (lowPressure) {
-    return Math.max(params.minIntervalMs, boundedCurrent - 1);
-  }
-
-  if (boundedCurrent > boundedBase) {
-    return Math.max(boundedBase, boundedCurrent - 1);
-  }
-  if (boundedCurrent < boundedBase) {
-    return Math.min(boundedBase, boundedCurrent + 1);
-  }
-  return boundedCurrent;
-}
-
-export function quantizeMouseDeltaWithResidual(accumulatedDelta: number): { send: number; residual: number } {
-  const send = Math.round(accumulatedDelta);
-  return {
-    send,
-    residual: accumulatedDelta - send,
-  };
-}
-
-class MouseDeltaFilter {
-  private x = 0;
-  private y = 0;
-  private lastTsMs = 0;
-  private velocityX = 0;
-  private velocityY = 0;
-  private rejectedX = 0;
-  private rejectedY = 0;
-  private pendingX = 0;
-  private pendingY = 0;
-  private sawZero = false;
-  private relaxedForRawInput = false;
-
-  public setRelaxedForRawInput(value: boolean): void {
-    this.relaxedForRawInput = value;
-  }
-
-  public getX(): number {
-    return this.x;
-  }
-
-  public getY(): number {
-    return this.y;
-  }
-
-  public reset(): void {
-    this.x = 0;
-    this.y = 0;
-    this.lastTsMs = 0;
-    this.velocityX = 0;
-    this.velocityY = 0;
-    this.rejectedX = 0;
-    this.rejectedY = 0;
-    this.pendingX = 0;
-    this.pendingY = 0;
-    this.sawZero = false;
-  }
-
-  public update(dx: number, dy: number, tsMs: number): boolean {
-    if (dx === 0 && dy === 0) {
-      if (this.sawZero) {
-        this.pendingX = 0;
-        this.pendingY = 0;
-      } else {
-        this.sawZero = true;
-      }
-      return false;
-    }
-
-    this.sawZero = false;
-    if (this.pendingX === 0 && this.pendingY === 0) {
-      if (tsMs < this.lastTsMs) {
-        this.pendingX = dx;
-        this.pendingY = dy;
-        return false;
-      }
-    } else {
-      dx += this.pendingX;
-      dy += this.pendingY;
-      this.pendingX = 0;
-      this.pendingY = 0;
-    }
-
-    const dot = dx * this.x + dy * this.y;
-    const magIncoming = dx * dx + dy * dy;
-    const magPrev = this.x * this.x + this.y * this.y;
-    let accept = true;
-
-    const dtMs = tsMs - this.lastTsMs;
-    const directionReversalCosineThreshold = this.relaxedForRawInput ? 0.89 : 0.81;
-    if (dtMs < 0.95 && dot < 0 && magPrev !== 0 && dot * dot > directionReversalCosineThreshold * magIncoming * magPrev) {
-      const ratio = Math.sqrt(magIncoming) / Math.sqrt(magPrev);
-      let distToInt = Math.abs(ratio - Math.trunc(ratio));
-      if (distToInt > 0.5) {
-        distToInt = 1 - distToInt;
-      }
-      const intRatioRejectThreshold = this.relaxedForRawInput ? 0.07 : 0.1;
-      if (distToInt < intRatioRejectThreshold) {
-        accept = false;
-      }
-    }
-
-    const diffX = dx - this.x;
-    const diffY = dy - this.y;
-    const diffMag = diffX * diffX + diffY * diffY;
-
-    if (accept) {
-      const scale = 1 + 0.1 * Math.max(1, Math.min(16, dtMs));
-      const vx2 = 2 * scale * Math.abs(this.velocityX);
-      const vy2 = 2 * scale * Math.abs(this.velocityY);
-      const threshold = Math.max(this.relaxedForRawInput ? 9800 : 8100, vx2 * vx2 + vy2 * vy2);
-      accept = diffMag < threshold;
-      if (!accept && (this.rejectedX !== 0 || this.rejectedY !== 0)) {
-        const rx = dx - this.rejectedX;
-        const ry = dy - this.rejectedY;
-        accept = rx * rx + ry * ry < threshold;
-      }
-    }
-
-    if (accept) {
-      this.velocityX = 0.4 * this.velocityX + 0.6 * diffX;
-      this.velocityY = 0.4 * this.velocityY + 0.6 * diffY;
-      this.x = dx;
-      this.y = dy;
-      this.lastTsMs = tsMs;
-      this.rejectedX = 0;
-      this.rejectedY = 0;
-      return true;
-    }
-
-    this.rejectedX = dx;
-    this.rejectedY = dy;
-    return false;
-  }
-}
+// Mouse filtering/flush logic lives in mousePipeline.ts so the dedicated
+// input worker can share it; re-exported here for existing importers.
+export {
+  chooseAdaptiveMouseFlushInterval,
+  quantizeMouseDeltaWithResidual,
+  type AdaptiveMouseFlushDecisionParams,
+} from "./mousePipeline";
 
 function parseResolution(resolution: string): { width: number; height: number } {
   const [rawWidth, rawHeight] = resolution.split("x");
@@ -601,10 +480,16 @@ export class GfnWebRtcClient {
   private statsTimer: number | null = null;
   private statsPollInFlight = false;
   private gamepadPollTimer: number | null = null;
+  private gamepadTickWorker: Worker | null = null;
+  private gamepadTickIntervalMs = 0;
   private pendingMouseDxFloat = 0;
   private pendingMouseDyFloat = 0;
   private inputCleanup: Array<() => void> = [];
   private queuedCandidates: RTCIceCandidateInit[] = [];
+  // Wall-clock anchor for fast-start milestone logging, set when the offer
+  // arrives; milestones already reached this negotiation are recorded once.
+  private fastStartOfferAtMs = 0;
+  private fastStartMilestones = new Set<string>();
 
   // Input mode: all input types (mouse, keyboard, gamepad) work simultaneously
   // Removed exclusive mode switching to allow concurrent input
@@ -621,6 +506,8 @@ export class GfnWebRtcClient {
   private static readonly DEFAULT_PARTIAL_RELIABLE_THRESHOLD_MS = 300;
   private static readonly RELIABLE_MOUSE_BACKPRESSURE_BYTES = 64 * 1024;
   private static readonly BACKPRESSURE_LOG_INTERVAL_MS = 2000;
+  private static readonly MOUSE_WORKER_STATS_INTERVAL_MS = 1000;
+  private static readonly MOUSE_WORKER_SCALE_SYNC_MS = 500;
   private static readonly VIDEO_BASE_JITTER_TARGET_MS = 12;
   private static readonly AUDIO_BASE_JITTER_TARGET_MS = 20;
   private static readonly VIDEO_PRESSURE_JITTER_TARGET_MS = 30;
@@ -631,6 +518,11 @@ export class GfnWebRtcClient {
   private static readonly DECODER_KEYFRAME_COOLDOWN_MS = 1200;
   private static readonly DECODER_BITRATE_STEP_FACTOR = 0.85;
   private static readonly DECODER_MIN_RECOVERY_BITRATE_KBPS = 4000;
+  // Predictive steps are gentler than reactive recovery: the point is to trim
+  // before frames are late, not to dig out of an established stall.
+  private static readonly DECODER_PREDICTIVE_SHAVE_FACTOR = 0.9;
+  private static readonly DECODER_PREDICTIVE_COOLDOWN_MS = 3000;
+  private static readonly DECODER_RESTORE_COOLDOWN_MS = 5000;
   private static readonly RUMBLE_EFFECT_MS = 500;
   private static readonly RUMBLE_THROTTLE_MS = 500;
   private static readonly HAPTICS_LOG_INTERVAL_MS = 5000;
@@ -657,6 +549,10 @@ export class GfnWebRtcClient {
     packetsLost: number;
     atMs: number;
   } | null = null;
+  private videoStatsReceiver: RTCRtpReceiver | null = null;
+  private inboundVideoStatsId: string | null = null;
+  private candidatePairStatsId: string | null = null;
+  private lastProcessedCodecStatsId: string | null = null;
   private renderFpsCounter = { frames: 0, lastUpdate: 0, fps: 0 };
   private connectedGamepads: Set<number> = new Set();
   private gamepadMetaPressed: Map<number, boolean> = new Map();
@@ -695,6 +591,16 @@ export class GfnWebRtcClient {
   private mouseFlushLastTickMs = 0;
   private pendingMouseTimestampUs: bigint | null = null;
   private mouseDeltaFilter = new MouseDeltaFilter();
+  private mouseWorker: Worker | null = null;
+  private mouseRingWriter: MouseRingWriter | null = null;
+  private mouseWorkerChannelTransferred = false;
+  private mouseWorkerChannelOpen = false;
+  private mouseWorkerScaleTimer: number | null = null;
+  private mouseWorkerResidualMagnitude = 0;
+  /** Set by the input capture closure so worker-sent deltas keep the simulated absolute pointer in sync. */
+  private onMouseWorkerSentDelta: ((dx: number, dy: number) => void) | null = null;
+  /** Set by the input capture closure so a mouse-worker crash can re-arm the main-thread flush loop. */
+  private restartMouseFlushLoop: (() => void) | null = null;
   private mouseSensitivity = 1;
   private mouseAccelerationPercent = 1;
   private keyboardLayout?: KeyboardLayout;
@@ -706,6 +612,7 @@ export class GfnWebRtcClient {
     hidDeviceMask: PARTIALLY_RELIABLE_HID_DEVICE_MASK_ALL,
     enablePartiallyReliableTransferGamepad: PARTIALLY_RELIABLE_GAMEPAD_MASK_ALL,
     enablePartiallyReliableTransferHid: PARTIALLY_RELIABLE_HID_DEVICE_MASK_ALL,
+    inputRedundancy: 0,
   };
   private inputQueuePeakBufferedBytesWindow = 0;
   private partiallyReliableInputQueuePeakBufferedBytesWindow = 0;
@@ -714,6 +621,8 @@ export class GfnWebRtcClient {
   private inputQueueDropCount = 0;
 
   // Decoder pressure detection + recovery state.
+  private decoderPressurePredictor = new DecoderPressurePredictor();
+  private lastPredictiveActionAtMs = 0;
   private decoderPressureActive = false;
   private decoderPressureConsecutivePolls = 0;
   private decoderStableConsecutivePolls = 0;
@@ -784,6 +693,7 @@ export class GfnWebRtcClient {
     decoderPressureActive: false,
     decoderRecoveryAttempts: 0,
     decoderRecoveryAction: "none",
+    decoderPressureOutlook: "learning",
     nativeRequestedFps: undefined,
     nativeCapsFramerate: undefined,
     nativeQueueMode: undefined,
@@ -864,6 +774,7 @@ export class GfnWebRtcClient {
     const v = Number.isFinite(value) ? value : 1;
     this.mouseSensitivity = Math.max(0.01, v);
     this.log(`Mouse sensitivity set to ${this.mouseSensitivity}`);
+    this.syncMouseWorkerConfig();
   }
 
   /** Update software mouse acceleration strength at runtime (1-150%). */
@@ -871,6 +782,7 @@ export class GfnWebRtcClient {
     const v = Number.isFinite(value) ? value : 1;
     this.mouseAccelerationPercent = Math.max(1, Math.min(150, Math.round(v)));
     this.log(`Mouse acceleration set to ${this.mouseAccelerationPercent}%`);
+    this.syncMouseWorkerConfig();
   }
 
   /** Update fullscreen preference used by auto pointer-lock flows at runtime. */
@@ -1054,6 +966,8 @@ export class GfnWebRtcClient {
   }
 
   private resetDecoderRecoveryState(): void {
+    this.decoderPressurePredictor.reset();
+    this.lastPredictiveActionAtMs = 0;
     this.decoderPressureActive = false;
     this.decoderPressureConsecutivePolls = 0;
     this.decoderStableConsecutivePolls = 0;
@@ -1068,6 +982,7 @@ export class GfnWebRtcClient {
     this.diagnostics.decoderPressureActive = false;
     this.diagnostics.decoderRecoveryAttempts = 0;
     this.diagnostics.decoderRecoveryAction = "none";
+    this.diagnostics.decoderPressureOutlook = "learning";
     this.diagnostics.nativeRequestedFps = undefined;
     this.diagnostics.nativeCapsFramerate = undefined;
     this.diagnostics.nativeQueueMode = undefined;
@@ -1081,6 +996,10 @@ export class GfnWebRtcClient {
 
   private resetDiagnostics(): void {
     this.lastStatsSample = null;
+    this.videoStatsReceiver = null;
+    this.inboundVideoStatsId = null;
+    this.candidatePairStatsId = null;
+    this.lastProcessedCodecStatsId = null;
     this.lastEmittedDiagnostics = null;
     this.currentCodec = "";
     this.currentResolution = "";
@@ -1131,6 +1050,7 @@ export class GfnWebRtcClient {
       decoderPressureActive: false,
       decoderRecoveryAttempts: 0,
       decoderRecoveryAction: "none",
+      decoderPressureOutlook: "learning",
       nativeRequestedFps: undefined,
       nativeCapsFramerate: undefined,
       nativeQueueMode: undefined,
@@ -1192,6 +1112,7 @@ export class GfnWebRtcClient {
       this.controlChannel.onclose = null;
       this.controlChannel.onerror = null;
     }
+    this.teardownMouseWorker();
     this.reliableInputChannel?.close();
     this.partiallyReliableInputChannel?.close();
     this.controlChannel?.close();
@@ -1209,6 +1130,10 @@ export class GfnWebRtcClient {
       window.clearTimeout(this.mouseFlushTimer);
       this.mouseFlushTimer = null;
     }
+    if (this.mouseWorkerScaleTimer !== null) {
+      window.clearInterval(this.mouseWorkerScaleTimer);
+      this.mouseWorkerScaleTimer = null;
+    }
     if (this.statsTimer !== null) {
       window.clearInterval(this.statsTimer);
       this.statsTimer = null;
@@ -1217,6 +1142,7 @@ export class GfnWebRtcClient {
       window.clearTimeout(this.gamepadPollTimer);
       this.gamepadPollTimer = null;
     }
+    this.teardownGamepadTickWorker();
     this.clearSyntheticEscapeSuppression();
   }
 
@@ -1537,37 +1463,155 @@ export class GfnWebRtcClient {
     }
   }
 
-  private async collectStats(): Promise<void> {
-    if (!this.pc) {
+  /**
+   * Acts on the predictive engine's forecast while the reactive path above is
+   * idle. A rising decode-time trend gets a gentle bitrate shave and a rising
+   * backlog gets a keyframe — both before any frame is actually late — and
+   * sustained headroom walks a shaved ceiling back up toward the negotiated
+   * maximum, which the reactive path never does on its own. Once reactive
+   * pressure trips, this path stands down until the episode clears.
+   */
+  private async maybeActOnDecoderForecast(
+    forecast: DecoderPressureForecast,
+    backlogFrames: number,
+  ): Promise<void> {
+    if (forecast.action === "none") {
       return;
     }
 
-    const report = await this.pc.getStats();
+    const now = performance.now();
+    if (now - this.lastPredictiveActionAtMs < GfnWebRtcClient.DECODER_PREDICTIVE_COOLDOWN_MS) {
+      return;
+    }
+
+    if (forecast.action === "shave_bitrate") {
+      const current = this.currentBitrateCeilingKbps > 0
+        ? this.currentBitrateCeilingKbps
+        : this.negotiatedMaxBitrateKbps;
+      const next = Math.max(
+        GfnWebRtcClient.DECODER_MIN_RECOVERY_BITRATE_KBPS,
+        Math.floor(current * GfnWebRtcClient.DECODER_PREDICTIVE_SHAVE_FACTOR),
+      );
+      if (next >= current) {
+        return;
+      }
+      await this.setMaxBitrateKbps(next);
+      this.currentBitrateCeilingKbps = next;
+      this.lastPredictiveActionAtMs = now;
+      this.diagnostics.decoderRecoveryAction = "predictive_bitrate_shave";
+      this.log(`Decoder forecast: ${forecast.detail}; bitrate ceiling shaved ${current} -> ${next} kbps`);
+      return;
+    }
+
+    if (forecast.action === "request_keyframe") {
+      const requested = await this.requestDecoderKeyframe(backlogFrames, "predicted_backlog_ramp");
+      if (requested) {
+        this.lastPredictiveActionAtMs = now;
+        this.log(`Decoder forecast: ${forecast.detail}`);
+      }
+      return;
+    }
+
+    // restore_bitrate
+    if (
+      this.currentBitrateCeilingKbps <= 0
+      || this.currentBitrateCeilingKbps >= this.negotiatedMaxBitrateKbps
+      || now - this.lastPredictiveActionAtMs < GfnWebRtcClient.DECODER_RESTORE_COOLDOWN_MS
+    ) {
+      return;
+    }
+    const current = this.currentBitrateCeilingKbps;
+    const next = Math.min(
+      this.negotiatedMaxBitrateKbps,
+      Math.ceil(current / GfnWebRtcClient.DECODER_BITRATE_STEP_FACTOR),
+    );
+    await this.setMaxBitrateKbps(next);
+    this.currentBitrateCeilingKbps = next;
+    this.lastPredictiveActionAtMs = now;
+    this.diagnostics.decoderRecoveryAction =
+      next >= this.negotiatedMaxBitrateKbps ? "none" : "predictive_bitrate_restore";
+    this.log(`Decoder forecast: sustained headroom; bitrate ceiling restored ${current} -> ${next} kbps`);
+  }
+
+  /**
+   * Returns the narrowest stats report that still contains everything the
+   * diagnostics read. A receiver-scoped report carries the inbound-rtp entry
+   * plus its codec/transport/candidate-pair chain and is a fraction of the
+   * size of a full peer-connection sweep, which matters at a 500ms cadence.
+   */
+  private async fetchStatsReport(): Promise<RTCStatsReport | null> {
+    if (!this.pc) {
+      return null;
+    }
+    if (!this.videoStatsReceiver || this.videoStatsReceiver.track?.readyState === "ended") {
+      this.videoStatsReceiver =
+        this.pc.getReceivers().find((receiver) => receiver.track?.kind === "video") ?? null;
+      this.inboundVideoStatsId = null;
+      this.candidatePairStatsId = null;
+    }
+    if (this.videoStatsReceiver) {
+      try {
+        return await this.videoStatsReceiver.getStats();
+      } catch {
+        this.videoStatsReceiver = null;
+      }
+    }
+    return this.pc.getStats();
+  }
+
+  private async collectStats(): Promise<void> {
+    const report = await this.fetchStatsReport();
+    if (!report) {
+      return;
+    }
     const now = performance.now();
     let inboundVideo: Record<string, unknown> | null = null;
     let activePair: Record<string, unknown> | null = null;
-    const codecs = new Map<string, Record<string, unknown>>();
     let framesReceived = 0;
     let framesDecoded = 0;
     let framesDropped = 0;
 
-    for (const entry of report.values()) {
-      const stats = entry as unknown as Record<string, unknown>;
-
-      if (entry.type === "inbound-rtp" && stats.kind === "video") {
-        inboundVideo = stats;
+    // Fast path: stat ids are stable for the lifetime of the underlying
+    // objects, so look up last sweep's entries directly and only walk the
+    // report when an id misses (first sweep, renegotiation, ICE restart).
+    if (this.inboundVideoStatsId) {
+      const cached = report.get(this.inboundVideoStatsId) as Record<string, unknown> | undefined;
+      if (cached && cached.type === "inbound-rtp" && cached.kind === "video") {
+        inboundVideo = cached;
+      } else {
+        this.inboundVideoStatsId = null;
+      }
+    }
+    if (this.candidatePairStatsId) {
+      const cached = report.get(this.candidatePairStatsId) as Record<string, unknown> | undefined;
+      if (cached && cached.type === "candidate-pair" && cached.state === "succeeded" && cached.nominated === true) {
+        activePair = cached;
+      } else {
+        this.candidatePairStatsId = null;
       }
+    }
+    if (!inboundVideo || !activePair) {
+      for (const entry of report.values()) {
+        const stats = entry as unknown as Record<string, unknown>;
 
-      if (entry.type === "candidate-pair") {
-        if (stats.state === "succeeded" && stats.nominated === true) {
+        if (!inboundVideo && entry.type === "inbound-rtp" && stats.kind === "video") {
+          inboundVideo = stats;
+          this.inboundVideoStatsId = typeof stats.id === "string" ? stats.id : null;
+        }
+
+        if (
+          !activePair
+          && entry.type === "candidate-pair"
+          && stats.state === "succeeded"
+          && stats.nominated === true
+        ) {
           activePair = stats;
+          this.candidatePairStatsId = typeof stats.id === "string" ? stats.id : null;
         }
-      }
 
-      // Collect codec information
-      if (entry.type === "codec") {
-        const codecId = stats.id as string;
-        codecs.set(codecId, stats);
+        if (inboundVideo && activePair) {
+          break;
+        }
       }
     }
 
@@ -1645,10 +1689,15 @@ export class GfnWebRtcClient {
         this.diagnostics.jitterBufferDelayMs = Math.round((jbDelay / jbEmitted) * 1000 * 10) / 10;
       }
 
-      // Get codec information
+      // Codec information only changes with the codec id, so the string
+      // matching below runs once per negotiated codec rather than every sweep.
       const codecId = inboundVideo.codecId as string;
-      if (codecId && codecs.has(codecId)) {
-        const codecStats = codecs.get(codecId)!;
+      const codecStats =
+        codecId && codecId !== this.lastProcessedCodecStatsId
+          ? (report.get(codecId) as Record<string, unknown> | undefined)
+          : undefined;
+      if (codecStats) {
+        this.lastProcessedCodecStatsId = codecId;
         const mimeType = (codecStats.mimeType as string) || "";
         const sdpFmtpLine = (codecStats.sdpFmtpLine as string) || "";
 
@@ -1710,7 +1759,20 @@ export class GfnWebRtcClient {
         decodeFps: this.diagnostics.decodeFps,
         prevSample,
       });
+      this.decoderPressurePredictor.push({
+        atMs: now,
+        decodeTimeMs: this.diagnostics.decodeTimeMs,
+        backlogFrames: pressureSignal.backlogFrames,
+        frameBudgetMs: this.diagnostics.decodeFps > 0
+          ? 1000 / this.diagnostics.decodeFps
+          : 1000 / 60,
+      });
+      const forecast = this.decoderPressurePredictor.decide();
+      this.diagnostics.decoderPressureOutlook = forecast.outlook;
       await this.maybeRecoverFromDecoderPressure(pressureSignal);
+      if (!pressureSignal.active && !this.decoderPressureActive) {
+        await this.maybeActOnDecoderForecast(forecast, pressureSignal.backlogFrames);
+      }
     }
 
     // RTT from active candidate pair
@@ -1742,7 +1804,9 @@ export class GfnWebRtcClient {
       : "reliable";
     this.diagnostics.mouseFlushIntervalMs = this.mouseFlushIntervalMs;
     this.diagnostics.mousePacketsPerSecond = this.mousePacketsPerSecond;
-    this.diagnostics.mouseResidualMagnitude = Math.hypot(this.pendingMouseDxFloat, this.pendingMouseDyFloat);
+    this.diagnostics.mouseResidualMagnitude = this.mouseWorker
+      ? this.mouseWorkerResidualMagnitude
+      : Math.hypot(this.pendingMouseDxFloat, this.pendingMouseDyFloat);
     this.diagnostics.mouseAdaptiveFlushActive = this.mouseAdaptiveFlushActive;
 
     const lagClassification = this.classifyLagReason({
@@ -1881,6 +1945,7 @@ export class GfnWebRtcClient {
     this.pendingMouseDyFloat = 0;
     this.pendingMouseTimestampUs = null;
     this.mouseDeltaFilter.reset();
+    this.mouseWorker?.postMessage({ type: "reset" });
     this.mouseFlushLastTickMs = 0;
     this.mouseFlushBaseIntervalMs = GfnWebRtcClient.MOUSE_FLUSH_NORMAL_MS;
     this.mouseFlushIntervalMs = GfnWebRtcClient.MOUSE_FLUSH_NORMAL_MS;
@@ -1955,6 +2020,7 @@ export class GfnWebRtcClient {
       // Set up render FPS tracking using video element
       const video = this.options.videoElement;
       const frameCallback = () => {
+        this.markFastStartMilestone("first video frame presented");
         this.updateRenderFps();
         if (this.videoStream.active) {
           video.requestVideoFrameCallback(frameCallback);
@@ -2053,36 +2119,20 @@ export class GfnWebRtcClient {
     }
   }
 
-  private async waitForIceGathering(pc: RTCPeerConnection, timeoutMs: number): Promise<string> {
-    if (pc.iceGatheringState === "complete" && pc.localDescription?.sdp) {
-      return pc.localDescription.sdp;
-    }
-
-    await new Promise<void>((resolve) => {
-      let settled = false;
-      const done = () => {
-        if (!settled) {
-          settled = true;
-          pc.removeEventListener("icegatheringstatechange", onStateChange);
-          resolve();
-        }
-      };
-
-      const onStateChange = () => {
-        if (pc.iceGatheringState === "complete") {
-          done();
-        }
-      };
-
-      pc.addEventListener("icegatheringstatechange", onStateChange);
-      window.setTimeout(done, timeoutMs);
-    });
-
-    const sdp = pc.localDescription?.sdp;
-    if (!sdp) {
-      throw new Error("Missing local SDP after ICE gathering");
+  /**
+   * Logs how long after the offer each connection milestone was first reached.
+   * The answer is sent before ICE gathering completes and candidates trickle
+   * in both directions, so these deltas — not gathering time — are what bound
+   * time-to-first-frame. On multi-homed machines with virtual interfaces the
+   * gap between "answer sent" and "ICE connected" is the number to watch.
+   */
+  private markFastStartMilestone(name: string): void {
+    if (this.fastStartOfferAtMs === 0 || this.fastStartMilestones.has(name)) {
+      return;
     }
-    return sdp;
+    this.fastStartMilestones.add(name);
+    const elapsed = Math.round(performance.now() - this.fastStartOfferAtMs);
+    this.log(`Fast start: ${name} +${elapsed}ms after offer`);
   }
 
   private setupInputHeartbeat(): void {
@@ -2102,12 +2152,83 @@ export class GfnWebRtcClient {
   private setupGamepadPolling(): void {
     if (this.gamepadPollTimer !== null) {
       window.clearTimeout(this.gamepadPollTimer);
+      this.gamepadPollTimer = null;
+    }
+
+    if (this.gamepadTickWorker !== null || this.setupGamepadTickWorker()) {
+      this.log("Gamepad polling started (worker timer)");
+      return;
     }
 
     this.log("Gamepad polling started (adaptive)");
     this.scheduleGamepadPolling();
   }
 
+  // The worker owns only the cadence: main-thread setTimeout ticks get
+  // rAF-aligned and stretched while the renderer is busy compositing, which
+  // shows up as sampling jitter on fighting-game inputs. Sampling itself must
+  // stay here because the Gamepad API is not exposed to workers.
+  private setupGamepadTickWorker(): boolean {
+    if (typeof Worker === "undefined") {
+      return false;
+    }
+    try {
+      const worker = new Worker(new URL("./gamepadTickWorker.ts", import.meta.url), {
+        type: "module",
+      });
+      this.gamepadTickIntervalMs = this.getGamepadPollIntervalMs();
+      const start: GamepadTickStartMessage = {
+        type: "start",
+        intervalMs: this.gamepadTickIntervalMs,
+      };
+      worker.postMessage(start);
+      worker.onmessage = () => {
+        this.onGamepadTick();
+      };
+      worker.onerror = (event) => {
+        this.log(`Gamepad tick worker error, falling back to main-thread polling: ${event.message}`);
+        this.teardownGamepadTickWorker();
+        this.scheduleGamepadPolling();
+      };
+      this.gamepadTickWorker = worker;
+      return true;
+    } catch (err) {
+      this.log(`Gamepad tick worker unavailable, using main-thread polling: ${String(err)}`);
+      this.teardownGamepadTickWorker();
+      return false;
+    }
+  }
+
+  private onGamepadTick(): void {
+    if (this.inputReady) {
+      this.pollGamepads();
+    }
+
+    // Re-arm the worker timer only when the adaptive interval actually moved
+    // (stream vs. paused vs. no controllers) to keep tick traffic one-way.
+    const intervalMs = this.getGamepadPollIntervalMs();
+    if (intervalMs !== this.gamepadTickIntervalMs && this.gamepadTickWorker !== null) {
+      this.gamepadTickIntervalMs = intervalMs;
+      const message: GamepadTickIntervalMessage = { type: "interval", intervalMs };
+      this.gamepadTickWorker.postMessage(message);
+    }
+  }
+
+  private teardownGamepadTickWorker(): void {
+    if (this.gamepadTickWorker === null) {
+      return;
+    }
+    try {
+      const stop: GamepadTickStopMessage = { type: "stop" };
+      this.gamepadTickWorker.postMessage(stop);
+    } catch {
+      // Worker may already be gone; terminate below regardless.
+    }
+    this.gamepadTickWorker.terminate();
+    this.gamepadTickWorker = null;
+    this.gamepadTickIntervalMs = 0;
+  }
+
   private scheduleGamepadPolling(): void {
     if (this.gamepadPollTimer !== null) {
       window.clearTimeout(this.gamepadPollTimer);
@@ -2601,6 +2722,9 @@ export class GfnWebRtcClient {
     if (this.nativeInputActive) {
       return true;
     }
+    if (this.mouseWorkerChannelTransferred) {
+      return this.mouseWorkerChannelOpen;
+    }
     return this.partiallyReliableInputChannel?.readyState === "open";
   }
 
@@ -2624,12 +2748,150 @@ export class GfnWebRtcClient {
     return (this.riInputCapabilities.enablePartiallyReliableTransferHid & hidMask) !== 0;
   }
 
+  private setupMouseWorker(partiallyReliableChannel: RTCDataChannel): boolean {
+    if (typeof SharedArrayBuffer === "undefined" || typeof Worker === "undefined") {
+      return false;
+    }
+    try {
+      const ring = createMouseRingBuffer();
+      const worker = new Worker(new URL("./mouseInputWorker.ts", import.meta.url), {
+        type: "module",
+      });
+      const init: MouseWorkerInitMessage = {
+        type: "init",
+        ring,
+        protocolVersion: this.inputProtocolVersion,
+        sensitivity: this.mouseSensitivity,
+        accelerationPercent: this.mouseAccelerationPercent,
+        relaxedForRawInput: false,
+        scaleX: 1,
+        scaleY: 1,
+        baseIntervalMs: this.mouseFlushBaseIntervalMs,
+        minIntervalMs: GfnWebRtcClient.MOUSE_FLUSH_MIN_MS,
+        maxIntervalMs: GfnWebRtcClient.MOUSE_FLUSH_MAX_MS,
+        backpressureThresholdBytes: GfnWebRtcClient.RELIABLE_MOUSE_BACKPRESSURE_BYTES,
+        statsIntervalMs: GfnWebRtcClient.MOUSE_WORKER_STATS_INTERVAL_MS,
+      };
+      worker.postMessage(init);
+      worker.onmessage = (event: MessageEvent<MouseWorkerOutboundMessage>) => {
+        this.onMouseWorkerMessage(event.data);
+      };
+      worker.onerror = (event) => {
+        this.log(`Mouse worker error, falling back to main-thread input: ${event.message}`);
+        this.teardownMouseWorker();
+        // Teardown alone leaves captured deltas queueing forever: the legacy
+        // flush loop is only armed during input-capture setup while the worker
+        // is absent. Re-arm it so mouse moves keep flowing over the reliable
+        // channel (a transferred PR channel dies with the worker).
+        this.restartMouseFlushLoop?.();
+      };
+      this.mouseWorker = worker;
+      this.mouseRingWriter = new MouseRingWriter(ring);
+      // Transferring the channel moves the actual send() off the main thread
+      // too. If this Chromium build does not support transferable
+      // RTCDataChannel, the worker still owns the pipeline and relays encoded
+      // packets back here instead.
+      try {
+        worker.postMessage({ type: "channel", channel: partiallyReliableChannel }, [
+          partiallyReliableChannel as unknown as Transferable,
+        ]);
+        this.mouseWorkerChannelTransferred = true;
+      } catch {
+        this.mouseWorkerChannelTransferred = false;
+      }
+      this.log(
+        `Mouse input worker started (channelTransferred=${this.mouseWorkerChannelTransferred})`,
+      );
+      return this.mouseWorkerChannelTransferred;
+    } catch (err) {
+      this.log(`Mouse worker unavailable, using main-thread input: ${String(err)}`);
+      this.teardownMouseWorker();
+      return false;
+    }
+  }
+
+  private onMouseWorkerMessage(message: MouseWorkerOutboundMessage): void {
+    switch (message.type) {
+      case "packet": {
+        const payload = new Uint8Array(message.payload);
+        if (message.partiallyReliable && !this.mouseWorkerChannelTransferred) {
+          this.sendPartiallyReliable(payload);
+        } else {
+          this.sendReliable(payload);
+        }
+        break;
+      }
+      case "channel-state": {
+        this.mouseWorkerChannelOpen = message.open;
+        this.diagnostics.partiallyReliableInputOpen = message.open;
+        this.diagnostics.mouseMoveTransport = this.canSendInputTypePartiallyReliable(INPUT_MOUSE_REL)
+          ? "partially_reliable"
+          : "reliable";
+        this.emitStats();
+        this.log(`Partially reliable input channel ${message.open ? "open" : "closed"} (worker)`);
+        this.syncMouseWorkerConfig();
+        break;
+      }
+      case "stats": {
+        this.mousePacketsPerSecond = message.packetsPerSecond;
+        this.mouseFlushIntervalMs = message.flushIntervalMs;
+        this.mouseAdaptiveFlushActive = message.adaptiveFlushActive;
+        this.mouseWorkerResidualMagnitude = message.residualMagnitude;
+        this.inputQueueMaxSchedulingDelayMsWindow = Math.max(
+          this.inputQueueMaxSchedulingDelayMsWindow,
+          message.maxSchedulingDelayMs,
+        );
+        if (message.sentDx !== 0 || message.sentDy !== 0) {
+          this.onMouseWorkerSentDelta?.(message.sentDx, message.sentDy);
+        }
+        break;
+      }
+    }
+  }
+
+  private syncMouseWorkerConfig(): void {
+    this.mouseWorker?.postMessage({
+      type: "config",
+      protocolVersion: this.inputProtocolVersion,
+      sensitivity: this.mouseSensitivity,
+      accelerationPercent: this.mouseAccelerationPercent,
+      mousePartiallyReliable: this.canSendInputTypePartiallyReliable(INPUT_MOUSE_REL),
+      inputReady: this.inputReady,
+    });
+  }
+
+  private teardownMouseWorker(): void {
+    if (this.mouseWorkerScaleTimer !== null) {
+      window.clearInterval(this.mouseWorkerScaleTimer);
+      this.mouseWorkerScaleTimer = null;
+    }
+    if (this.mouseWorker) {
+      try {
+        this.mouseWorker.postMessage({ type: "close" });
+      } catch {}
+      this.mouseWorker.terminate();
+    }
+    this.mouseWorker = null;
+    this.mouseRingWriter = null;
+    this.mouseWorkerChannelTransferred = false;
+    this.mouseWorkerChannelOpen = false;
+    this.mouseWorkerResidualMagnitude = 0;
+    this.onMouseWorkerSentDelta = null;
+  }
+
   private sendPartiallyReliable(payload: Uint8Array): void {
+    getHotPathLogger().log("WebRTC", "pr-input send bytes", payload.byteLength);
     if (this.nativeInputActive) {
       this.sendNativeInput(payload, true);
       return;
     }
 
+    if (this.mouseWorkerChannelTransferred && this.mouseWorker) {
+      const copy = Uint8Array.from(payload);
+      this.mouseWorker.postMessage({ type: "send", payload: copy.buffer }, [copy.buffer]);
+      return;
+    }
+
     if (this.partiallyReliableInputChannel?.readyState === "open") {
       const view = payload.byteOffset === 0 && payload.byteLength === payload.buffer.byteLength
         ? payload
@@ -2690,6 +2952,7 @@ export class GfnWebRtcClient {
       this.inputReady = true;
       this.inputProtocolVersion = version;
       this.inputEncoder.setProtocolVersion(version);
+      this.syncMouseWorkerConfig();
       this.diagnostics.inputReady = true;
       this.emitStats();
       this.log(`Input handshake complete (protocol v${version}) — starting heartbeat + gamepad polling`);
@@ -2720,6 +2983,14 @@ export class GfnWebRtcClient {
       maxPacketLifeTime: this.partialReliableThresholdMs,
     });
 
+    // Hand the mouse pipeline (and, when transferable, the channel itself) to
+    // the dedicated worker. The transfer must happen before the channel opens,
+    // which is why this lives here rather than in the input capture setup.
+    if (this.setupMouseWorker(this.partiallyReliableInputChannel)) {
+      this.partiallyReliableInputChannel = null;
+      return;
+    }
+
     this.partiallyReliableInputChannel.onopen = () => {
       this.diagnostics.partiallyReliableInputOpen = true;
       this.diagnostics.mouseMoveTransport = this.canSendInputTypePartiallyReliable(INPUT_MOUSE_REL)
@@ -3125,8 +3396,9 @@ export class GfnWebRtcClient {
     this.mousePacketRateWindowStartedAtMs = this.mouseFlushLastTickMs;
     this.mouseDeltaFilter.reset();
     this.mouseDeltaFilter.setRelaxedForRawInput(hasPointerRawUpdate);
+    this.mouseWorker?.postMessage({ type: "config", relaxedForRawInput: hasPointerRawUpdate });
     this.log(
-      `Mouse input mode: ${pointerMoveEventName ?? "mousemove"}, coalesced=${hasCoalescedEvents ? "yes" : "no"}, flush=${this.mouseFlushIntervalMs}ms`,
+      `Mouse input mode: ${pointerMoveEventName ?? "mousemove"}, coalesced=${hasCoalescedEvents ? "yes" : "no"}, flush=${this.mouseFlushIntervalMs}ms${this.mouseWorker ? " (worker)" : ""}`,
     );
 
     const pointerScaleCache = {
@@ -3167,6 +3439,29 @@ export class GfnWebRtcClient {
       return pointerScaleCache;
     };
 
+    if (this.mouseWorker) {
+      this.onMouseWorkerSentDelta = (dx, dy) => {
+        if (simulatedAbsX !== null && simulatedAbsY !== null) {
+          simulatedAbsX += dx;
+          simulatedAbsY += dy;
+        }
+      };
+      const syncScale = (): void => {
+        const { scaleX, scaleY } = getPointerScale();
+        this.mouseWorker?.postMessage({ type: "config", scaleX, scaleY });
+      };
+      syncScale();
+      if (this.mouseWorkerScaleTimer !== null) {
+        window.clearInterval(this.mouseWorkerScaleTimer);
+      }
+      // Rect/resolution changes are rare; a slow poll keeps the worker's
+      // pointer scale fresh without reading layout from the event handlers.
+      this.mouseWorkerScaleTimer = window.setInterval(
+        syncScale,
+        GfnWebRtcClient.MOUSE_WORKER_SCALE_SYNC_MS,
+      );
+    }
+
     const flushMouse = () => {
       const tickNow = performance.now();
       if (this.mouseFlushLastTickMs > 0) {
@@ -3276,7 +3571,16 @@ export class GfnWebRtcClient {
         }
       }, this.mouseFlushIntervalMs);
     };
-    scheduleNextFlush();
+    // Keep a handle to the flush loop so the worker's onerror path can re-arm
+    // it; this is the only place the loop can be started.
+    this.restartMouseFlushLoop = scheduleNextFlush;
+    this.inputCleanup.push(() => {
+      this.restartMouseFlushLoop = null;
+    });
+    if (!this.mouseWorker) {
+      // Worker inactive: run the legacy main-thread flush loop.
+      scheduleNextFlush();
+    }
 
     const tryAutoLock = (): void => {
       try {
@@ -3356,6 +3660,13 @@ export class GfnWebRtcClient {
         return;
       }
 
+      // Worker active: hand the raw delta over and let the worker run the
+      // filter -> sensitivity -> quantize -> encode pipeline on its own clock.
+      if (this.mouseRingWriter && this.mouseWorker) {
+        this.mouseRingWriter.push(dx, dy, eventTimestampMs);
+        return;
+      }
+
       if (!this.mouseDeltaFilter.update(dx, dy, eventTimestampMs)) {
         return;
       }
@@ -4132,6 +4443,8 @@ export class GfnWebRtcClient {
 
   async handleOffer(offerSdp: string, session: SessionInfo, settings: OfferSettings): Promise<void> {
     this.cleanupPeerConnection();
+    this.fastStartOfferAtMs = performance.now();
+    this.fastStartMilestones.clear();
     this.log("=== handleOffer START ===");
     this.log(`Session: id=${session.sessionId}, status=${session.status}, serverIp=${session.serverIp}`);
     this.log(`Signaling: server=${session.signalingServer}, url=${session.signalingUrl}`);
@@ -4152,6 +4465,8 @@ export class GfnWebRtcClient {
     this.log(`=== FULL OFFER SDP END ===`);
 
     this.riInputCapabilities = parseRiInputCapabilities(offerSdp);
+    this.inputEncoder.setInputRedundancy(this.riInputCapabilities.inputRedundancy);
+    this.syncMouseWorkerConfig();
     const negotiatedPartialReliable = this.riInputCapabilities.partialReliableThresholdMs;
     this.partialReliableThresholdMs = negotiatedPartialReliable ?? GfnWebRtcClient.DEFAULT_PARTIAL_RELIABLE_THRESHOLD_MS;
     this.negotiatedMaxBitrateKbps = Math.max(
@@ -4160,7 +4475,7 @@ export class GfnWebRtcClient {
     );
     this.currentBitrateCeilingKbps = this.negotiatedMaxBitrateKbps;
     this.log(
-      `Input channel policy: partial reliable threshold=${this.partialReliableThresholdMs}ms${negotiatedPartialReliable === null ? " (fallback)" : ""}, hidMask=0x${this.riInputCapabilities.hidDeviceMask.toString(16)}, prGamepadMask=0x${this.riInputCapabilities.enablePartiallyReliableTransferGamepad.toString(16)}, prHidMask=0x${this.riInputCapabilities.enablePartiallyReliableTransferHid.toString(16)}`,
+      `Input channel policy: partial reliable threshold=${this.partialReliableThresholdMs}ms${negotiatedPartialReliable === null ? " (fallback)" : ""}, hidMask=0x${this.riInputCapabilities.hidDeviceMask.toString(16)}, prGamepadMask=0x${this.riInputCapabilities.enablePartiallyReliableTransferGamepad.toString(16)}, prHidMask=0x${this.riInputCapabilities.enablePartiallyReliableTransferHid.toString(16)}, inputRedundancy=${this.riInputCapabilities.inputRedundancy}`,
     );
 
     // Extract server region from session
@@ -4212,6 +4527,7 @@ export class GfnWebRtcClient {
         return;
       }
       this.log(`Local ICE candidate: ${payload.candidate}`);
+      this.markFastStartMilestone("first local ICE candidate");
       const candidate: IceCandidatePayload = {
         candidate: payload.candidate,
         sdpMid: payload.sdpMid,
@@ -4266,6 +4582,9 @@ export class GfnWebRtcClient {
 
     pc.oniceconnectionstatechange = () => {
       this.log(`ICE connection state: ${pc.iceConnectionState}`);
+      if (pc.iceConnectionState === "connected" || pc.iceConnectionState === "completed") {
+        this.markFastStartMilestone("ICE connected");
+      }
       this.options.onIceConnectionStateChange?.(pc.iceConnectionState);
     };
 
@@ -4367,6 +4686,7 @@ export class GfnWebRtcClient {
     this.log("Setting remote description (offer)...");
     await pc.setRemoteDescription({ type: "offer", sdp: filteredOffer });
     this.log("Remote description set successfully");
+    this.markFastStartMilestone("remote description set");
     await this.flushQueuedCandidates();
 
     // Attach microphone track to the correct transceiver after remote description is set
@@ -4460,6 +4780,7 @@ export class GfnWebRtcClient {
       nvstSdp,
     });
     this.log("Sent SDP answer and nvstSdp");
+    this.markFastStartMilestone("answer sent");
     answerSent = true;
     if (queuedLocalIce.length > 0) {
       this.log(`Flushing ${queuedLocalIce.length} queued local ICE candidates after answer`);
@@ -4481,6 +4802,7 @@ export class GfnWebRtcClient {
     this.log(
       `Remote ICE candidate received: ${candidate.candidate} (sdpMid=${candidate.sdpMid}, sdpMLineIndex=${sdpMLineIndex})`,
     );
+    this.markFastStartMilestone("first remote ICE candidate");
     const init: RTCIceCandidateInit = {
       candidate: candidate.candidate,
       sdpMid: candidate.sdpMid ?? undefined,
@@ -1,9 +1,16 @@
 import type { RefObject } from "react";
 import { useEffect, useRef } from "react";
 
+import { attachMicLevelWorklet, createMicLevelBuffer } from "../gfn/micLevelWorklet";
+
 /**
  * Draws a segmented RMS level meter for a live microphone track (time-domain).
  * Shared by stream sidebar and controller in-stream mic level row.
+ *
+ * Levels come from an AudioWorklet processor publishing into a
+ * SharedArrayBuffer, so the paint loop here only reads one float per frame;
+ * when the worklet or SharedArrayBuffer is unavailable it falls back to the
+ * previous main-thread AnalyserNode path.
  */
 export function useMicMeter(
   canvasRef: RefObject<HTMLCanvasElement | null>,
@@ -31,9 +38,66 @@ export function useMicMeter(
     let audioCtx: AudioContext | null = null;
     let source: MediaStreamAudioSourceNode | null = null;
     let analyser: AnalyserNode | null = null;
+    let workletNode: AudioWorkletNode | null = null;
     let tickTimer: number | null = null;
     let dead = false;
 
+    const SEG = 20;
+    const GAP = Math.round(2 * dpr);
+    const bw = (W - GAP * (SEG - 1)) / SEG;
+    const radius = Math.min(3 * dpr, bw / 2);
+    const frameIntervalMs = 33;
+
+    const paint = (rms: number) => {
+      const level = Math.min(1, rms * 5.5);
+      const filled = Math.round(level * SEG);
+
+      ctx2d.clearRect(0, 0, W, H);
+      for (let i = 0; i < SEG; i++) {
+        const x = i * (bw + GAP);
+        if (i < filled) {
+          ctx2d.fillStyle =
+            i < SEG * 0.7 ? "#58d98a" : i < SEG * 0.9 ? "#fbbf24" : "#f87171";
+        } else {
+          ctx2d.fillStyle = "rgba(255,255,255,0.07)";
+        }
+        ctx2d.beginPath();
+        ctx2d.roundRect(x, 0, Math.max(1, bw), H, radius);
+        ctx2d.fill();
+      }
+    };
+
+    const runPaintLoop = (readRms: () => number) => {
+      const frame = () => {
+        if (dead) return;
+        tickTimer = window.setTimeout(frame, frameIntervalMs);
+        paint(readRms());
+      };
+      frame();
+    };
+
+    const startAnalyserFallback = () => {
+      if (dead || !audioCtx || !source) {
+        return;
+      }
+      analyser = audioCtx.createAnalyser();
+      analyser.fftSize = 256;
+      analyser.smoothingTimeConstant = 0.65;
+      source.connect(analyser);
+
+      const buf = new Uint8Array(analyser.frequencyBinCount);
+      runPaintLoop(() => {
+        if (!analyser) return 0;
+        analyser.getByteTimeDomainData(buf);
+        let sum = 0;
+        for (let i = 0; i < buf.length; i++) {
+          const v = ((buf[i] ?? 128) - 128) / 128;
+          sum += v * v;
+        }
+        return Math.sqrt(sum / buf.length);
+      });
+    };
+
     const start = async () => {
       if (pendingCloseRef.current) {
         try {
@@ -53,49 +117,24 @@ export function useMicMeter(
           return;
         }
 
-        analyser = audioCtx.createAnalyser();
-        analyser.fftSize = 256;
-        analyser.smoothingTimeConstant = 0.65;
         source = audioCtx.createMediaStreamSource(new MediaStream([track]));
-        source.connect(analyser);
-
-        const buf = new Uint8Array(analyser.frequencyBinCount);
-        const SEG = 20;
-        const GAP = Math.round(2 * dpr);
-        const bw = (W - GAP * (SEG - 1)) / SEG;
-        const radius = Math.min(3 * dpr, bw / 2);
-        const frameIntervalMs = 33;
-
-        const frame = () => {
-          if (dead || !analyser) return;
-          tickTimer = window.setTimeout(frame, frameIntervalMs);
-          analyser.getByteTimeDomainData(buf);
-
-          let sum = 0;
-          for (let i = 0; i < buf.length; i++) {
-            const v = ((buf[i] ?? 128) - 128) / 128;
-            sum += v * v;
-          }
-          const rms = Math.sqrt(sum / buf.length);
-          const level = Math.min(1, rms * 5.5);
-          const filled = Math.round(level * SEG);
-
-          ctx2d.clearRect(0, 0, W, H);
-          for (let i = 0; i < SEG; i++) {
-            const x = i * (bw + GAP);
-            if (i < filled) {
-              ctx2d.fillStyle =
-                i < SEG * 0.7 ? "#58d98a" : i < SEG * 0.9 ? "#fbbf24" : "#f87171";
-            } else {
-              ctx2d.fillStyle = "rgba(255,255,255,0.07)";
+
+        const levelBuffer = createMicLevelBuffer();
+        if (levelBuffer) {
+          try {
+            workletNode = await attachMicLevelWorklet(audioCtx, source, levelBuffer);
+            if (dead) {
+              return;
             }
-            ctx2d.beginPath();
-            ctx2d.roundRect(x, 0, Math.max(1, bw), H, radius);
-            ctx2d.fill();
+            const levels = new Float32Array(levelBuffer);
+            runPaintLoop(() => levels[0] ?? 0);
+            return;
+          } catch (e) {
+            console.warn("[MicMeter] Worklet unavailable, using analyser:", e);
           }
-        };
+        }
 
-        frame();
+        startAnalyserFallback();
       } catch (e) {
         console.warn("[MicMeter]", e);
       }
@@ -110,6 +149,7 @@ export function useMicMeter(
       }
       source?.disconnect();
       analyser?.disconnect();
+      workletNode?.disconnect();
       if (audioCtx && audioCtx.state !== "closed") {
         pendingCloseRef.current = audioCtx
           .close()
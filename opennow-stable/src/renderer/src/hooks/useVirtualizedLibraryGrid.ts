@@ -0,0 +1,136 @@
+import type { RefObject } from "react";
+import { useCallback, useEffect, useLayoutEffect, useRef, useState } from "react";
+
+import {
+  computePrefetchRange,
+  computeVirtualWindow,
+  type IndexRange,
+  type ScrollDirection,
+  type VirtualWindow,
+} from "../lib/libraryVirtualization";
+
+/** Rows mounted beyond the viewport edge the user is scrolling toward. */
+const OVERSCAN_ROWS = 2;
+/** Items mounted before the first measurement; a few rows at any width. */
+const INITIAL_RENDER_COUNT = 48;
+
+export interface VirtualizedLibraryGrid {
+  containerRef: RefObject<HTMLDivElement | null>;
+  gridRef: RefObject<HTMLDivElement | null>;
+  handleScroll: () => void;
+  window: VirtualWindow;
+  prefetchRange: IndexRange;
+}
+
+function windowsEqual(left: VirtualWindow, right: VirtualWindow): boolean {
+  return (
+    left.startIndex === right.startIndex
+    && left.endIndex === right.endIndex
+    && left.topPadding === right.topPadding
+    && left.bottomPadding === right.bottomPadding
+  );
+}
+
+/**
+ * Windowed rendering for the library's auto-fill card grid: only the rows
+ * near the viewport are mounted, with spacer padding standing in for the
+ * rest, so a 2,000-entry library scrolls like a 30-entry one. The layout is
+ * measured from the rendered cards themselves (column count from first-row
+ * membership, row stride from the first row break), which keeps the hook
+ * agnostic to poster scale, zoom, and container width. Scroll direction is
+ * tracked so overscan and the artwork prefetch range lead the user.
+ */
+export function useVirtualizedLibraryGrid(itemCount: number, enabled: boolean): VirtualizedLibraryGrid {
+  const containerRef = useRef<HTMLDivElement | null>(null);
+  const gridRef = useRef<HTMLDivElement | null>(null);
+  const lastScrollTopRef = useRef(0);
+  const directionRef = useRef<ScrollDirection>("forward");
+  const scrollFrameRef = useRef<number | null>(null);
+  const [window, setWindow] = useState<VirtualWindow>(() => ({
+    startIndex: 0,
+    endIndex: Math.min(itemCount, INITIAL_RENDER_COUNT),
+    topPadding: 0,
+    bottomPadding: 0,
+  }));
+  const [prefetchRange, setPrefetchRange] = useState<IndexRange>({ startIndex: 0, endIndex: 0 });
+
+  const measure = useCallback(() => {
+    const container = containerRef.current;
+    const grid = gridRef.current;
+    if (!enabled || !container || !grid || itemCount === 0) {
+      setWindow((previous) => {
+        const full = { startIndex: 0, endIndex: itemCount, topPadding: 0, bottomPadding: 0 };
+        return windowsEqual(previous, full) ? previous : full;
+      });
+      return;
+    }
+
+    const children = grid.children;
+    if (children.length === 0) return;
+
+    const first = children[0] as HTMLElement;
+    let columnCount = 1;
+    while (columnCount < children.length && (children[columnCount] as HTMLElement).offsetTop === first.offsetTop) {
+      columnCount += 1;
+    }
+    const secondRow = children[columnCount] as HTMLElement | undefined;
+    const rowGap = Number.parseFloat(getComputedStyle(grid).rowGap) || 0;
+    const rowHeight = secondRow
+      ? secondRow.offsetTop - first.offsetTop
+      : first.offsetHeight + rowGap;
+
+    const scrollTop = container.scrollTop;
+    if (scrollTop !== lastScrollTopRef.current) {
+      directionRef.current = scrollTop > lastScrollTopRef.current ? "forward" : "backward";
+      lastScrollTopRef.current = scrollTop;
+    }
+
+    const input = {
+      itemCount,
+      columnCount,
+      rowHeight,
+      scrollTop,
+      viewportHeight: container.clientHeight,
+      overscanRows: OVERSCAN_ROWS,
+      direction: directionRef.current,
+    };
+    const next = computeVirtualWindow(input);
+    setWindow((previous) => (windowsEqual(previous, next) ? previous : next));
+    const nextPrefetch = computePrefetchRange(next, input);
+    setPrefetchRange((previous) => (
+      previous.startIndex === nextPrefetch.startIndex && previous.endIndex === nextPrefetch.endIndex
+        ? previous
+        : nextPrefetch
+    ));
+  }, [enabled, itemCount]);
+
+  const handleScroll = useCallback(() => {
+    if (scrollFrameRef.current !== null) return;
+    scrollFrameRef.current = requestAnimationFrame(() => {
+      scrollFrameRef.current = null;
+      measure();
+    });
+  }, [measure]);
+
+  // Measure synchronously after mount and whenever the list or mode changes,
+  // before the browser paints the unvirtualized fallback window.
+  useLayoutEffect(() => {
+    measure();
+  }, [measure]);
+
+  useEffect(() => {
+    const container = containerRef.current;
+    if (!enabled || !container || typeof ResizeObserver === "undefined") return;
+    const observer = new ResizeObserver(() => measure());
+    observer.observe(container);
+    return () => observer.disconnect();
+  }, [enabled, measure]);
+
+  useEffect(() => () => {
+    if (scrollFrameRef.current !== null) {
+      cancelAnimationFrame(scrollFrameRef.current);
+    }
+  }, []);
+
+  return { containerRef, gridRef, handleScroll, window, prefetchRange };
+}
@@ -1,5 +1,7 @@
 import { useMemo, useSyncExternalStore } from "react";
 
+import localeBundles from "virtual:locale-bundles";
+
 import fallbackTranslations from "../../../../locales/en.json";
 
 type TranslationValue = string | number | boolean | null | undefined;
@@ -10,18 +12,24 @@ type TranslationTree = { [key: string]: TranslationLeaf | TranslationTree };
 const FALLBACK_LOCALE = "en";
 const LOCALE_STORAGE_KEY = "opennow.locale";
 
-const localeSources = import.meta.glob<string>("../../../../locales/*.json", {
-  query: "?raw",
-  import: "default",
-  eager: true,
-});
-
+/**
+ * Namespaces a stream session needs. They stay unloaded until a stream view
+ * mounts (StreamView calls preloadTranslationNamespaces), so browsing the
+ * library never pays for HUD strings.
+ */
+export const STREAM_TRANSLATION_NAMESPACES = ["stream", "streamLoading", "queue", "session"];
+
+// English ships eagerly as the synchronous fallback for first paint; every
+// other locale loads lazily through the per-namespace bundles that
+// electron.vite.config.ts precompiles, so only the active language and only
+// the namespaces actually in use become resident.
 const fallbackTree = fallbackTranslations as TranslationTree;
-const loadedLocales = new Map<string, TranslationTree>([[FALLBACK_LOCALE, fallbackTree]]);
+const loadedNamespaces = new Map<string, Map<string, TranslationTree>>();
+const pendingNamespaces = new Map<string, Promise<void>>();
+const usedNamespaces = new Set<string>();
 const listeners = new Set<() => void>();
 
 let activeLocale = FALLBACK_LOCALE;
-let activeTranslations = fallbackTree;
 let snapshotVersion = 0;
 
 function subscribe(listener: () => void): () => void {
@@ -42,22 +50,6 @@ function emitChange(): void {
   }
 }
 
-function localeFromPath(path: string): string | null {
-  const fileName = path.split("/").pop();
-  if (!fileName?.endsWith(".json")) return null;
-  return normalizeLocale(fileName.slice(0, -".json".length));
-}
-
-function getLocaleSource(locale: string): string | null {
-  const normalized = normalizeLocale(locale);
-  for (const [path, source] of Object.entries(localeSources)) {
-    if (localeFromPath(path) === normalized) {
-      return source;
-    }
-  }
-  return null;
-}
-
 function readStoredLocale(): string | null {
   try {
     const stored = window.localStorage.getItem(LOCALE_STORAGE_KEY);
@@ -93,43 +85,46 @@ function getInitialLocale(): string {
   return readStoredLocale() ?? getBrowserLocaleCandidates()[0] ?? FALLBACK_LOCALE;
 }
 
-function parseLocaleJson(locale: string, raw: string): TranslationTree | null {
-  if (raw.trim().length === 0) {
-    console.warn(`[i18n] Locale "${locale}" is empty; falling back to English.`);
-    return null;
-  }
-
-  try {
-    return JSON.parse(raw) as TranslationTree;
-  } catch (error) {
-    console.warn(`[i18n] Failed to parse locale "${locale}"; falling back to English.`, error);
-    return null;
-  }
+function namespaceOfKey(key: string): string {
+  const separator = key.indexOf(".");
+  return separator === -1 ? key : key.slice(0, separator);
 }
 
-function loadTranslations(locale: string): TranslationTree | null {
-  const normalized = normalizeLocale(locale);
-  if (normalized === FALLBACK_LOCALE) return fallbackTree;
-
-  const cached = loadedLocales.get(normalized);
-  if (cached) return cached;
-
-  const source = getLocaleSource(normalized);
-  if (source === null) return null;
+function ensureNamespaceLoaded(locale: string, namespace: string): Promise<void> {
+  if (locale === FALLBACK_LOCALE) return Promise.resolve();
 
-  const parsed = parseLocaleJson(normalized, source);
-  if (parsed) {
-    loadedLocales.set(normalized, parsed);
+  const importer = localeBundles[locale]?.[namespace];
+  if (!importer || loadedNamespaces.get(locale)?.has(namespace)) {
+    return Promise.resolve();
   }
-  return parsed;
-}
 
-function setActiveTranslations(locale: string, translations: TranslationTree | null): void {
-  const normalized = normalizeLocale(locale);
-  activeLocale = normalized;
-  activeTranslations = translations ?? fallbackTree;
-  document.documentElement.lang = activeLocale;
-  emitChange();
+  const pendingKey = `${locale}/${namespace}`;
+  const pending = pendingNamespaces.get(pendingKey);
+  if (pending) return pending;
+
+  const load = importer()
+    .then((bundle) => {
+      let namespaces = loadedNamespaces.get(locale);
+      if (!namespaces) {
+        namespaces = new Map();
+        loadedNamespaces.set(locale, namespaces);
+      }
+      namespaces.set(namespace, bundle as TranslationTree);
+      if (locale === activeLocale) {
+        emitChange();
+      }
+    })
+    .catch((error) => {
+      console.warn(
+        `[i18n] Failed to load namespace "${namespace}" for locale "${locale}"; falling back to English.`,
+        error,
+      );
+    })
+    .finally(() => {
+      pendingNamespaces.delete(pendingKey);
+    });
+  pendingNamespaces.set(pendingKey, load);
+  return load;
 }
 
 function readNestedValue(tree: TranslationTree, key: string): string | null {
@@ -141,6 +136,21 @@ function readNestedValue(tree: TranslationTree, key: string): string | null {
   return typeof current === "string" ? current : null;
 }
 
+function readActiveValue(key: string): string | null {
+  if (activeLocale === FALLBACK_LOCALE) return readNestedValue(fallbackTree, key);
+
+  const namespace = namespaceOfKey(key);
+  const tree = loadedNamespaces.get(activeLocale)?.get(namespace);
+  if (!tree) {
+    // Kick off the bundle load; the store version bump re-renders consumers
+    // once it lands, and English covers the gap meanwhile.
+    void ensureNamespaceLoaded(activeLocale, namespace);
+    return null;
+  }
+  const remainder = key.slice(namespace.length + 1);
+  return remainder ? readNestedValue(tree, remainder) : null;
+}
+
 function interpolate(template: string, values: TranslationValues): string {
   return template.replace(/\{\{\s*([\w.]+)\s*\}\}/g, (match, token: string) => {
     const value = values[token];
@@ -153,10 +163,11 @@ function resolvePluralKey(key: string, values: TranslationValues): string {
 }
 
 export function t(key: string, values: TranslationValues = {}): string {
+  usedNamespaces.add(namespaceOfKey(key));
   const resolvedKey = resolvePluralKey(key, values);
   const translation =
-    readNestedValue(activeTranslations, resolvedKey) ??
-    readNestedValue(activeTranslations, key) ??
+    readActiveValue(resolvedKey) ??
+    readActiveValue(key) ??
     readNestedValue(fallbackTree, resolvedKey) ??
     readNestedValue(fallbackTree, key);
 
@@ -175,25 +186,44 @@ export function getLocale(): string {
 }
 
 export function getAvailableLocales(): string[] {
-  const locales = new Set<string>([FALLBACK_LOCALE]);
-  for (const path of Object.keys(localeSources)) {
-    const locale = localeFromPath(path);
-    if (locale) locales.add(locale);
+  return [...new Set([FALLBACK_LOCALE, ...Object.keys(localeBundles)])].sort();
+}
+
+/**
+ * Loads the given namespaces for the active locale ahead of first use, so a
+ * view can mount without flashing English while its bundle arrives.
+ */
+export async function preloadTranslationNamespaces(namespaces: string[]): Promise<void> {
+  for (const namespace of namespaces) {
+    usedNamespaces.add(namespace);
   }
-  return [...locales].sort();
+  await Promise.all(namespaces.map((namespace) => ensureNamespaceLoaded(activeLocale, namespace)));
 }
 
-export async function setLocale(locale: string): Promise<void> {
+function startupNamespaces(locale: string): string[] {
+  return Object.keys(localeBundles[locale] ?? {}).filter(
+    (namespace) => !STREAM_TRANSLATION_NAMESPACES.includes(namespace),
+  );
+}
+
+async function activateLocale(locale: string): Promise<void> {
   const normalized = normalizeLocale(locale);
-  const translations = loadTranslations(normalized);
-  writeStoredLocale(normalized);
-  setActiveTranslations(normalized, translations);
+  // Warm everything already on screen plus the non-stream namespaces before
+  // switching, so a language change never flashes English mid-view.
+  const warm = new Set([...startupNamespaces(normalized), ...usedNamespaces]);
+  await Promise.all([...warm].map((namespace) => ensureNamespaceLoaded(normalized, namespace)));
+  activeLocale = normalized;
+  document.documentElement.lang = activeLocale;
+  emitChange();
+}
+
+export async function setLocale(locale: string): Promise<void> {
+  writeStoredLocale(normalizeLocale(locale));
+  await activateLocale(locale);
 }
 
 export async function initializeLocale(): Promise<void> {
-  const initialLocale = getInitialLocale();
-  const translations = loadTranslations(initialLocale);
-  setActiveTranslations(initialLocale, translations);
+  await activateLocale(getInitialLocale());
 }
 
 export function useTranslation(): {
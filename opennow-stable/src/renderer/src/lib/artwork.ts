@@ -0,0 +1,13 @@
+// Routes remote artwork through the main-process content-addressed asset
+// cache (opennow-asset://), so box art is fetched from the network once and
+// served from disk on every later mount and app restart. Non-https or
+// already-local URLs are passed through untouched.
+
+const ASSET_PROTOCOL_PREFIX = "opennow-asset://opennow/fetch?u=";
+
+export function cachedArtworkUrl(url: string | undefined): string | undefined {
+  if (!url || !/^https:\/\//i.test(url)) {
+    return url;
+  }
+  return `${ASSET_PROTOCOL_PREFIX}${encodeURIComponent(url)}`;
+}
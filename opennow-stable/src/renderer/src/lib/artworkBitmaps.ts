@@ -0,0 +1,179 @@
+// Off-main-thread artwork decoding for the library grid. Card images used to
+// be plain <img> elements, so every mount decoded its artwork on the main
+// thread — noticeable as dropped frames when scrolling a large library,
+// especially with a stream compositing in the background. This module owns a
+// single decode worker (artworkDecodeWorker.ts), keeps recently decoded
+// ImageBitmaps in a bounded cache so virtualized cards that remount while
+// scrolling repaint without re-decoding, and exposes a prefetch entry point
+// the grid uses to warm the next screenful in the scroll direction.
+//
+// When workers or a decode are unavailable (old renderer, fetch failure in
+// the worker), callers fall back to the previous <img> path per URL.
+
+import { useEffect, useState } from "react";
+import { cachedArtworkUrl } from "./artwork";
+import type { ArtworkDecodeRequest, ArtworkDecodeResponse } from "./artworkDecodeWorker";
+
+// Roughly ten screenfuls of cards; evicted bitmaps are closed to release
+// their backing memory. Canvases keep their pixels after drawImage, so
+// closing an evicted bitmap never blanks a card that already painted it.
+const BITMAP_CACHE_LIMIT = 384;
+
+const bitmapCache = new Map<string, ImageBitmap>();
+const pendingByUrl = new Map<string, Promise<ImageBitmap | null>>();
+const pendingById = new Map<number, (bitmap: ImageBitmap | null) => void>();
+
+let decodeWorker: Worker | null = null;
+let workerUnavailable = false;
+let nextRequestId = 1;
+
+function markWorkerUnavailable(): void {
+  workerUnavailable = true;
+  decodeWorker?.terminate();
+  decodeWorker = null;
+  for (const resolve of pendingById.values()) {
+    resolve(null);
+  }
+  pendingById.clear();
+}
+
+function obtainDecodeWorker(): Worker | null {
+  if (workerUnavailable) return null;
+  if (decodeWorker) return decodeWorker;
+  if (typeof Worker === "undefined" || typeof createImageBitmap === "undefined") {
+    workerUnavailable = true;
+    return null;
+  }
+  try {
+    const worker = new Worker(new URL("./artworkDecodeWorker.ts", import.meta.url), {
+      type: "module",
+    });
+    worker.onmessage = (event: MessageEvent<ArtworkDecodeResponse>) => {
+      const message = event.data;
+      const resolve = pendingById.get(message.id);
+      if (!resolve) return;
+      pendingById.delete(message.id);
+      resolve(message.type === "decoded" ? message.bitmap : null);
+    };
+    worker.onerror = () => {
+      markWorkerUnavailable();
+    };
+    decodeWorker = worker;
+    return worker;
+  } catch {
+    workerUnavailable = true;
+    return null;
+  }
+}
+
+function cacheBitmap(url: string, bitmap: ImageBitmap): void {
+  bitmapCache.delete(url);
+  bitmapCache.set(url, bitmap);
+  while (bitmapCache.size > BITMAP_CACHE_LIMIT) {
+    const [oldestUrl, oldest] = bitmapCache.entries().next().value as [string, ImageBitmap];
+    bitmapCache.delete(oldestUrl);
+    oldest.close();
+  }
+}
+
+function getCachedBitmap(url: string): ImageBitmap | null {
+  const bitmap = bitmapCache.get(url);
+  if (!bitmap) return null;
+  if (bitmap.width === 0) {
+    // Closed by eviction after being handed out; decode it again.
+    bitmapCache.delete(url);
+    return null;
+  }
+  // Refresh recency so visible cards are evicted last.
+  bitmapCache.delete(url);
+  bitmapCache.set(url, bitmap);
+  return bitmap;
+}
+
+/**
+ * Decodes artwork off the main thread, deduplicating in-flight requests per
+ * URL. Resolves null when the worker path is unavailable or the decode
+ * failed; the caller then renders the regular <img> for that URL.
+ */
+export function decodeArtworkBitmap(url: string): Promise<ImageBitmap | null> {
+  const cached = getCachedBitmap(url);
+  if (cached) return Promise.resolve(cached);
+
+  const pending = pendingByUrl.get(url);
+  if (pending) return pending;
+
+  const worker = obtainDecodeWorker();
+  if (!worker) return Promise.resolve(null);
+
+  const id = nextRequestId++;
+  const promise = new Promise<ImageBitmap | null>((resolve) => {
+    pendingById.set(id, (bitmap) => {
+      pendingByUrl.delete(url);
+      if (bitmap) cacheBitmap(url, bitmap);
+      resolve(bitmap);
+    });
+  });
+  pendingByUrl.set(url, promise);
+  const request: ArtworkDecodeRequest = { type: "decode", id, url };
+  worker.postMessage(request);
+  return promise;
+}
+
+/**
+ * Warms the bitmap cache for artwork the grid expects to need next (the
+ * screenful beyond the mounted window in the scroll direction). Failures are
+ * ignored; the cards fall back to <img> when they actually mount.
+ */
+export function prefetchArtworkBitmaps(imageUrls: Array<string | undefined>): void {
+  if (workerUnavailable) return;
+  for (const imageUrl of imageUrls) {
+    const url = cachedArtworkUrl(imageUrl);
+    if (!url) continue;
+    if (bitmapCache.has(url) || pendingByUrl.has(url)) continue;
+    void decodeArtworkBitmap(url);
+  }
+}
+
+export type ArtworkBitmapState =
+  | { status: "decoding"; bitmap: null }
+  | { status: "ready"; bitmap: ImageBitmap }
+  | { status: "image-fallback"; bitmap: null };
+
+const IMAGE_FALLBACK: ArtworkBitmapState = { status: "image-fallback", bitmap: null };
+const DECODING: ArtworkBitmapState = { status: "decoding", bitmap: null };
+
+/**
+ * Resolves a card's artwork URL to a decoded ImageBitmap. Cache hits resolve
+ * synchronously so remounting virtualized cards paint on their first frame;
+ * otherwise the card shows its background while the worker decodes, and
+ * drops to the <img> path if the decode cannot be served.
+ */
+export function useArtworkBitmap(imageUrl: string | undefined): ArtworkBitmapState {
+  const url = cachedArtworkUrl(imageUrl);
+  const [state, setState] = useState<ArtworkBitmapState>(() => {
+    if (!url || workerUnavailable) return IMAGE_FALLBACK;
+    const cached = getCachedBitmap(url);
+    return cached ? { status: "ready", bitmap: cached } : DECODING;
+  });
+
+  useEffect(() => {
+    if (!url || workerUnavailable) {
+      setState(IMAGE_FALLBACK);
+      return;
+    }
+    let cancelled = false;
+    setState(() => {
+      const cached = getCachedBitmap(url);
+      return cached ? { status: "ready", bitmap: cached } : DECODING;
+    });
+    void decodeArtworkBitmap(url).then((bitmap) => {
+      if (cancelled) return;
+      setState(bitmap ? { status: "ready", bitmap } : IMAGE_FALLBACK);
+    });
+    return () => {
+      cancelled = true;
+    };
+  }, [url]);
+
+  return state;
+}
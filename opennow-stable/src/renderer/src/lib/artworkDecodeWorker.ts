@@ -0,0 +1,54 @@
+// Dedicated artwork decode worker: fetches box art (through the
+// opennow-asset:// disk cache, same as the <img> path) and decodes it with
+// createImageBitmap here, so image decode no longer runs on the main thread
+// while the library scrolls or a background stream is compositing. Decoded
+// bitmaps are transferred back zero-copy and drawn by the cards.
+
+export interface ArtworkDecodeRequest {
+  type: "decode";
+  id: number;
+  url: string;
+}
+
+export interface ArtworkDecodedMessage {
+  type: "decoded";
+  id: number;
+  bitmap: ImageBitmap;
+}
+
+export interface ArtworkDecodeFailedMessage {
+  type: "decode-failed";
+  id: number;
+  message: string;
+}
+
+export type ArtworkDecodeResponse = ArtworkDecodedMessage | ArtworkDecodeFailedMessage;
+
+const workerScope = self as unknown as {
+  postMessage(message: ArtworkDecodeResponse, transfer?: Transferable[]): void;
+  onmessage: ((event: MessageEvent<ArtworkDecodeRequest>) => void) | null;
+};
+
+async function decode(url: string): Promise<ImageBitmap> {
+  const response = await fetch(url);
+  if (!response.ok) {
+    throw new Error(`Artwork fetch failed (${response.status})`);
+  }
+  return createImageBitmap(await response.blob());
+}
+
+workerScope.onmessage = (event: MessageEvent<ArtworkDecodeRequest>) => {
+  const request = event.data;
+  if (request?.type !== "decode") return;
+  decode(request.url)
+    .then((bitmap) => {
+      workerScope.postMessage({ type: "decoded", id: request.id, bitmap }, [bitmap]);
+    })
+    .catch((error: unknown) => {
+      workerScope.postMessage({
+        type: "decode-failed",
+        id: request.id,
+        message: error instanceof Error ? error.message : String(error),
+      });
+    });
+};
@@ -1,80 +1,151 @@
-import type { CatalogFilterGroup, CatalogSortOption, GameInfo } from "@shared/gfn";
-
-const CATALOG_SNAPSHOT_KEY = "opennow.catalogSnapshot.v1";
-
-export interface CatalogSnapshot {
-  version: 1;
-  userId: string;
-  streamingBaseUrl: string;
-  queryKey: string;
-  games: GameInfo[];
-  libraryGames: GameInfo[];
-  filterGroups: CatalogFilterGroup[];
-  sortOptions: CatalogSortOption[];
-  totalCount: number;
-  supportedCount: number;
-  savedAt: number;
-}
-
-export function buildCatalogQueryKey(
-  searchQuery: string,
-  filterIds: string[],
-  sortId: string,
-): string {
-  return `${searchQuery.trim()}|${filterIds.join("|")}|${sortId}`;
-}
-
-export function loadCatalogSnapshot(
-  userId: string,
-  streamingBaseUrl: string,
-  queryKey: string,
-): CatalogSnapshot | null {
-  try {
-    const raw = localStorage.getItem(CATALOG_SNAPSHOT_KEY);
-    if (!raw) return null;
-
-    const parsed = JSON.parse(raw) as Partial<CatalogSnapshot>;
-    if (
-      parsed.version !== 1
-      || parsed.userId !== userId
-      || parsed.streamingBaseUrl !== streamingBaseUrl
-      || parsed.queryKey !== queryKey
-      || !Array.isArray(parsed.games)
-      || parsed.games.length === 0
-    ) {
-      return null;
-    }
-
-    return {
-      version: 1,
-      userId: parsed.userId,
-      streamingBaseUrl: parsed.streamingBaseUrl,
-      queryKey: parsed.queryKey,
-      games: parsed.games,
-      libraryGames: Array.isArray(parsed.libraryGames) ? parsed.libraryGames : [],
-      filterGroups: Array.isArray(parsed.filterGroups) ? parsed.filterGroups : [],
-      sortOptions: Array.isArray(parsed.sortOptions) ? parsed.sortOptions : [],
-      totalCount: typeof parsed.totalCount === "number" ? parsed.totalCount : parsed.games.length,
-      supportedCount: typeof parsed.supportedCount === "number" ? parsed.supportedCount : parsed.games.length,
-      savedAt: typeof parsed.savedAt === "number" ? parsed.savedAt : 0,
-    };
-  } catch {
-    return null;
-  }
-}
-
-export function saveCatalogSnapshot(snapshot: CatalogSnapshot): void {
-  try {
-    localStorage.setItem(CATALOG_SNAPSHOT_KEY, JSON.stringify(snapshot));
-  } catch (error) {
-    console.warn("Failed to persist catalog snapshot:", error);
-  }
-}
-
-export function clearCatalogSnapshot(): void {
-  try {
-    localStorage.removeItem(CATALOG_SNAPSHOT_KEY);
-  } catch {
-    // ignore
-  }
-}
+import type { CatalogFilterGroup, CatalogSortOption, GameInfo } from "@shared/gfn";
+
+// The snapshot now lives in a compressed two-section file owned by the main
+// process (see src/main/services/catalogSnapshotStore.ts) instead of a single
+// localStorage JSON blob. Startup hydrates the small summary section first so
+// the home screen paints immediately, then swaps in the full catalog (variants,
+// descriptions, store metadata) once it has been read and parsed off the
+// critical path.
+
+const LEGACY_CATALOG_SNAPSHOT_KEY = "opennow.catalogSnapshot.v1";
+const SNAPSHOT_VERSION = 2;
+
+export interface CatalogSnapshot {
+  version: 2;
+  userId: string;
+  streamingBaseUrl: string;
+  queryKey: string;
+  games: GameInfo[];
+  libraryGames: GameInfo[];
+  filterGroups: CatalogFilterGroup[];
+  sortOptions: CatalogSortOption[];
+  totalCount: number;
+  supportedCount: number;
+  savedAt: number;
+}
+
+/** Same shape as CatalogSnapshot, but games are trimmed to first-paint fields. */
+export type CatalogSnapshotSummary = CatalogSnapshot;
+
+export function buildCatalogQueryKey(
+  searchQuery: string,
+  filterIds: string[],
+  sortId: string,
+): string {
+  return `${searchQuery.trim()}|${filterIds.join("|")}|${sortId}`;
+}
+
+/** Minimal GameInfo the tiles need before the full section arrives. */
+function toSummaryGame(game: GameInfo): GameInfo {
+  return {
+    id: game.id,
+    title: game.title,
+    shortName: game.shortName,
+    imageUrl: game.imageUrl,
+    heroImageUrl: game.heroImageUrl,
+    playType: game.playType,
+    membershipTierLabel: game.membershipTierLabel,
+    playabilityState: game.playabilityState,
+    publisherName: game.publisherName,
+    isInLibrary: game.isInLibrary,
+    lastPlayed: game.lastPlayed,
+    selectedVariantIndex: 0,
+    variants: [],
+  };
+}
+
+function validateSnapshot(
+  parsed: Partial<CatalogSnapshot>,
+  userId: string,
+  streamingBaseUrl: string,
+  queryKey: string,
+): CatalogSnapshot | null {
+  if (
+    parsed.version !== SNAPSHOT_VERSION
+    || parsed.userId !== userId
+    || parsed.streamingBaseUrl !== streamingBaseUrl
+    || parsed.queryKey !== queryKey
+    || !Array.isArray(parsed.games)
+    || parsed.games.length === 0
+  ) {
+    return null;
+  }
+
+  return {
+    version: SNAPSHOT_VERSION,
+    userId: parsed.userId,
+    streamingBaseUrl: parsed.streamingBaseUrl,
+    queryKey: parsed.queryKey,
+    games: parsed.games,
+    libraryGames: Array.isArray(parsed.libraryGames) ? parsed.libraryGames : [],
+    filterGroups: Array.isArray(parsed.filterGroups) ? parsed.filterGroups : [],
+    sortOptions: Array.isArray(parsed.sortOptions) ? parsed.sortOptions : [],
+    totalCount: typeof parsed.totalCount === "number" ? parsed.totalCount : parsed.games.length,
+    supportedCount: typeof parsed.supportedCount === "number" ? parsed.supportedCount : parsed.games.length,
+    savedAt: typeof parsed.savedAt === "number" ? parsed.savedAt : 0,
+  };
+}
+
+async function loadSnapshotSection(
+  part: "summary" | "full",
+  userId: string,
+  streamingBaseUrl: string,
+  queryKey: string,
+): Promise<CatalogSnapshot | null> {
+  try {
+    const raw = await window.openNow.loadCatalogSnapshotSection({ part });
+    if (!raw) return null;
+    return validateSnapshot(JSON.parse(raw) as Partial<CatalogSnapshot>, userId, streamingBaseUrl, queryKey);
+  } catch {
+    return null;
+  }
+}
+
+export function loadCatalogSnapshotSummary(
+  userId: string,
+  streamingBaseUrl: string,
+  queryKey: string,
+): Promise<CatalogSnapshotSummary | null> {
+  return loadSnapshotSection("summary", userId, streamingBaseUrl, queryKey);
+}
+
+export function loadCatalogSnapshotFull(
+  userId: string,
+  streamingBaseUrl: string,
+  queryKey: string,
+): Promise<CatalogSnapshot | null> {
+  return loadSnapshotSection("full", userId, streamingBaseUrl, queryKey);
+}
+
+export function saveCatalogSnapshot(snapshot: CatalogSnapshot): void {
+  const summary: CatalogSnapshotSummary = {
+    ...snapshot,
+    games: snapshot.games.map(toSummaryGame),
+    libraryGames: snapshot.libraryGames.map(toSummaryGame),
+  };
+
+  void window.openNow.saveCatalogSnapshotFile({
+    summaryJson: JSON.stringify(summary),
+    fullJson: JSON.stringify(snapshot),
+  }).catch((error) => {
+    console.warn("Failed to persist catalog snapshot:", error);
+  });
+
+  // One-time migration away from the old localStorage blob.
+  try {
+    localStorage.removeItem(LEGACY_CATALOG_SNAPSHOT_KEY);
+  } catch {
+    // ignore
+  }
+}
+
+export function clearCatalogSnapshot(): void {
+  void window.openNow.clearCatalogSnapshotFile().catch(() => {
+    // Best effort — a stale snapshot fails validation on the next load anyway.
+  });
+  try {
+    localStorage.removeItem(LEGACY_CATALOG_SNAPSHOT_KEY);
+  } catch {
+    // ignore
+  }
+}
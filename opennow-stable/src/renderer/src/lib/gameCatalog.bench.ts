@@ -0,0 +1,63 @@
+/// <reference types="node" />
+import type { GameInfo } from "@shared/gfn";
+
+import { bench } from "@shared/bench";
+
+import { matchesGameSearch, sortLibraryGames, type PlaytimeData } from "./gameCatalog";
+
+// Search and sort run over the full catalog on every keystroke and library
+// refresh, so they are measured against a catalog of GFN-like size.
+
+const CATALOG_SIZE = 2000;
+
+function syntheticGame(index: number): GameInfo {
+  return {
+    id: String(100000 + index),
+    title: `Synthetic Adventure ${index}`,
+    description: `Open-world benchmark fixture number ${index} with a longer description body.`,
+    publisherName: index % 3 === 0 ? "Nocturne Interactive" : "Benchmark Softworks",
+    genres: index % 2 === 0 ? ["Action", "Adventure"] : ["Strategy", "Indie"],
+    featureLabels: index % 5 === 0 ? ["Cloud G-SYNC", "4K"] : ["HDR"],
+    availableStores: ["Steam"],
+    lastPlayed: index % 4 === 0 ? new Date(1700000000000 + index * 86400000).toISOString() : undefined,
+  };
+}
+
+const games: GameInfo[] = Array.from({ length: CATALOG_SIZE }, (_, index) => syntheticGame(index));
+
+const playtimeData: PlaytimeData = Object.fromEntries(
+  games
+    .filter((_, index) => index % 2 === 0)
+    .map((game, index) => [
+      game.id,
+      {
+        lastPlayedAt: new Date(1700000000000 + index * 43200000).toISOString(),
+        totalSeconds: (index * 977) % 100000,
+        sessionCount: index % 40,
+      },
+    ]),
+);
+
+bench(`gameCatalog/matchesGameSearch_${CATALOG_SIZE}_games`, () => {
+  let matches = 0;
+  for (const game of games) {
+    if (matchesGameSearch(game, "adventure 19")) {
+      matches += 1;
+    }
+  }
+  if (matches === 0) {
+    throw new Error("search fixture should match");
+  }
+});
+
+bench(`gameCatalog/sortLibraryGames_a_to_z_${CATALOG_SIZE}_games`, () => {
+  sortLibraryGames(games, "a_to_z", playtimeData);
+});
+
+bench(`gameCatalog/sortLibraryGames_most_popular_${CATALOG_SIZE}_games`, () => {
+  sortLibraryGames(games, "most_popular", playtimeData);
+});
+
+bench(`gameCatalog/sortLibraryGames_last_played_${CATALOG_SIZE}_games`, () => {
+  sortLibraryGames(games, "last_played", playtimeData);
+});
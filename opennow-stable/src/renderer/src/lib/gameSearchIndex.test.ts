@@ -0,0 +1,58 @@
+/// <reference types="node" />
+
+import test from "node:test";
+import assert from "node:assert/strict";
+
+import type { GameInfo } from "@shared/gfn";
+import { buildGameSearchIndex } from "./gameSearchIndex";
+
+function makeGame(overrides: Partial<GameInfo> & { id: string; title: string }): GameInfo {
+  return {
+    selectedVariantIndex: 0,
+    variants: [],
+    ...overrides,
+  };
+}
+
+const catalog: GameInfo[] = [
+  makeGame({ id: "1", title: "Cyberpunk 2077", publisherName: "CD Projekt", genres: ["RPG"] }),
+  makeGame({ id: "2", title: "Cybershadow", description: "A ninja platformer" }),
+  makeGame({ id: "3", title: "Portal 2", publisherName: "Valve", genres: ["Puzzle"] }),
+  makeGame({ id: "4", title: "Rocket League", availableStores: ["Epic"], searchText: "rocket league soccer cars" }),
+];
+
+test("query matches across the same fields as matchesGameSearch", () => {
+  const index = buildGameSearchIndex(catalog);
+
+  assert.deepEqual(index.query("valve").map((game) => game.id), ["3"]);
+  assert.deepEqual(index.query("ninja").map((game) => game.id), ["2"]);
+  assert.deepEqual(index.query("soccer").map((game) => game.id), ["4"]);
+  assert.deepEqual(index.query("nothing matches this").map((game) => game.id), []);
+});
+
+test("query ranks title matches above other-field matches", () => {
+  const index = buildGameSearchIndex([
+    ...catalog,
+    makeGame({ id: "5", title: "Racing Sim", description: "cyber-inspired visuals" }),
+  ]);
+
+  const ids = index.query("cyber").map((game) => game.id);
+  // Title prefix matches first (stable order), then the description match.
+  assert.deepEqual(ids, ["1", "2", "5"]);
+  assert.equal(index.query("Cyberpunk 2077")[0]?.id, "1");
+});
+
+test("short queries fall back to haystack scan", () => {
+  const index = buildGameSearchIndex(catalog);
+
+  const ids = index.query("cy").map((game) => game.id);
+  assert.deepEqual(ids, ["1", "2"]);
+  assert.equal(index.query("").length, catalog.length);
+});
+
+test("queries are case- and whitespace-insensitive", () => {
+  const index = buildGameSearchIndex(catalog);
+
+  assert.deepEqual(index.query("  PORTAL  ").map((game) => game.id), ["3"]);
+  assert.deepEqual(index.query("rOcKeT lEaGuE").map((game) => game.id), ["4"]);
+});
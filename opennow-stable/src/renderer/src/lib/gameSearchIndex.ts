@@ -0,0 +1,142 @@
+import type { GameInfo } from "@shared/gfn";
+
+// Prebuilt search index over the game catalog. matchesGameSearch() lowercases
+// and scans every field of every game per keystroke, which stutters on low-end
+// hardware once the catalog reaches a couple of thousand titles. The index
+// normalizes each game once at build time and resolves queries through trigram
+// postings, so a keystroke costs a few map probes plus verification on a small
+// candidate set instead of an O(catalog) sweep.
+
+const TRIGRAM_LENGTH = 3;
+
+interface IndexedGame {
+  game: GameInfo;
+  /** All searchable fields, normalized and joined — mirror of matchesGameSearch. */
+  haystack: string;
+  title: string;
+}
+
+export interface RankedGameMatch {
+  game: GameInfo;
+  score: number;
+}
+
+function normalizeSearchText(value: string): string {
+  return value.trim().toLowerCase();
+}
+
+function buildHaystack(game: GameInfo): string {
+  const parts = [
+    game.searchText,
+    game.title,
+    game.description,
+    game.publisherName,
+    ...(game.genres ?? []),
+    ...(game.featureLabels ?? []),
+    ...(game.availableStores ?? []),
+  ];
+  return parts
+    .filter((value): value is string => typeof value === "string" && value.length > 0)
+    .map((value) => value.toLowerCase())
+    .join("\n");
+}
+
+function trigramsOf(text: string): Set<string> {
+  const trigrams = new Set<string>();
+  for (let i = 0; i + TRIGRAM_LENGTH <= text.length; i++) {
+    trigrams.add(text.slice(i, i + TRIGRAM_LENGTH));
+  }
+  return trigrams;
+}
+
+function scoreMatch(entry: IndexedGame, query: string): number {
+  if (entry.title === query) {
+    return 1000;
+  }
+  if (entry.title.startsWith(query)) {
+    return 800;
+  }
+  if (entry.title.includes(query)) {
+    return 600;
+  }
+  return 400;
+}
+
+export class GameSearchIndex {
+  private readonly entries: IndexedGame[];
+  private readonly postings = new Map<string, number[]>();
+
+  constructor(catalog: GameInfo[]) {
+    this.entries = catalog.map((game) => ({
+      game,
+      haystack: buildHaystack(game),
+      title: game.title.toLowerCase(),
+    }));
+    this.entries.forEach((entry, index) => {
+      for (const trigram of trigramsOf(entry.haystack)) {
+        const posting = this.postings.get(trigram);
+        if (posting) {
+          posting.push(index);
+        } else {
+          this.postings.set(trigram, [index]);
+        }
+      }
+    });
+  }
+
+  public size(): number {
+    return this.entries.length;
+  }
+
+  /**
+   * Returns matching games ranked title-exact > title-prefix > title-substring
+   * > other-field, stable within a rank. Queries shorter than a trigram fall
+   * back to scanning the prebuilt haystacks, which still avoids per-keystroke
+   * normalization of every catalog field.
+   */
+  public query(rawQuery: string): GameInfo[] {
+    const query = normalizeSearchText(rawQuery);
+    if (!query) {
+      return this.entries.map((entry) => entry.game);
+    }
+
+    const matches: RankedGameMatch[] = [];
+    for (const entry of this.candidates(query)) {
+      if (entry.haystack.includes(query)) {
+        matches.push({ game: entry.game, score: scoreMatch(entry, query) });
+      }
+    }
+    return matches
+      .sort((left, right) => right.score - left.score)
+      .map((match) => match.game);
+  }
+
+  private candidates(query: string): IndexedGame[] {
+    if (query.length < TRIGRAM_LENGTH) {
+      return this.entries;
+    }
+
+    // Intersect the postings of every query trigram, starting from the
+    // rarest so the working set shrinks as fast as possible.
+    const postings: number[][] = [];
+    for (const trigram of trigramsOf(query)) {
+      const posting = this.postings.get(trigram);
+      if (!posting) {
+        return [];
+      }
+      postings.push(posting);
+    }
+    postings.sort((left, right) => left.length - right.length);
+
+    let candidates = postings[0];
+    for (let i = 1; i < postings.length && candidates.length > 0; i++) {
+      const next = new Set(postings[i]);
+      candidates = candidates.filter((index) => next.has(index));
+    }
+    return candidates.map((index) => this.entries[index]);
+  }
+}
+
+export function buildGameSearchIndex(catalog: GameInfo[]): GameSearchIndex {
+  return new GameSearchIndex(catalog);
+}
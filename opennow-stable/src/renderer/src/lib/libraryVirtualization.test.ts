@@ -0,0 +1,99 @@
+/// <reference types="node" />
+
+import test from "node:test";
+import assert from "node:assert/strict";
+
+import {
+  computeColumnCount,
+  computePrefetchRange,
+  computeVirtualWindow,
+  type VirtualWindowInput,
+} from "./libraryVirtualization";
+
+function makeInput(overrides: Partial<VirtualWindowInput> = {}): VirtualWindowInput {
+  return {
+    itemCount: 2000,
+    columnCount: 5,
+    rowHeight: 320,
+    scrollTop: 0,
+    viewportHeight: 900,
+    overscanRows: 2,
+    direction: "forward",
+    ...overrides,
+  };
+}
+
+test("computeColumnCount matches auto-fill column packing", () => {
+  // 5 x 200px columns + 4 x 12px gaps = 1048px.
+  assert.equal(computeColumnCount(1048, 200, 12), 5);
+  assert.equal(computeColumnCount(1047, 200, 12), 4);
+  assert.equal(computeColumnCount(150, 200, 12), 1);
+  assert.equal(computeColumnCount(0, 200, 12), 1);
+});
+
+test("window starts at the top with forward overscan only below", () => {
+  const window = computeVirtualWindow(makeInput());
+
+  assert.equal(window.startIndex, 0);
+  assert.equal(window.topPadding, 0);
+  // ceil(900 / 320) + 1 = 4 visible rows, + 2 lead rows = 6 rows of 5.
+  assert.equal(window.endIndex, 30);
+  assert.equal(window.bottomPadding, (400 - 6) * 320);
+});
+
+test("window stays row-aligned mid-list and pads both sides", () => {
+  const window = computeVirtualWindow(makeInput({ scrollTop: 32_000 }));
+
+  // Row 100 is first visible; trail 1 row behind, lead 2 rows ahead.
+  assert.equal(window.startIndex, 99 * 5);
+  assert.equal(window.topPadding, 99 * 320);
+  assert.equal(window.endIndex, 106 * 5);
+  assert.equal(window.bottomPadding, (400 - 106) * 320);
+  assert.equal(window.topPadding + (106 - 99) * 320 + window.bottomPadding, 400 * 320);
+});
+
+test("overscan bias flips when scrolling backward", () => {
+  const forward = computeVirtualWindow(makeInput({ scrollTop: 32_000, direction: "forward" }));
+  const backward = computeVirtualWindow(makeInput({ scrollTop: 32_000, direction: "backward" }));
+
+  assert.ok(backward.startIndex < forward.startIndex);
+  assert.ok(backward.endIndex < forward.endIndex);
+});
+
+test("window clamps to the end of a partial last row", () => {
+  const window = computeVirtualWindow(makeInput({ itemCount: 23, scrollTop: 10_000 }));
+
+  assert.equal(window.endIndex, 23);
+  assert.equal(window.bottomPadding, 0);
+});
+
+test("mounts everything until the layout has been measured", () => {
+  const window = computeVirtualWindow(makeInput({ columnCount: 0, rowHeight: 0, itemCount: 40 }));
+
+  assert.deepEqual(window, { startIndex: 0, endIndex: 40, topPadding: 0, bottomPadding: 0 });
+});
+
+test("prefetch covers the next screenful in the scroll direction", () => {
+  const input = makeInput({ scrollTop: 32_000 });
+  const window = computeVirtualWindow(input);
+
+  const ahead = computePrefetchRange(window, input);
+  assert.equal(ahead.startIndex, window.endIndex);
+  // ceil(900 / 320) = 3 rows of 5.
+  assert.equal(ahead.endIndex, window.endIndex + 15);
+
+  const behind = computePrefetchRange(window, { ...input, direction: "backward" });
+  assert.equal(behind.endIndex, window.startIndex);
+  assert.equal(behind.startIndex, window.startIndex - 15);
+});
+
+test("prefetch clamps at both ends of the list", () => {
+  const input = makeInput({ itemCount: 40, scrollTop: 0 });
+  const window = computeVirtualWindow(input);
+
+  const ahead = computePrefetchRange(window, input);
+  assert.ok(ahead.endIndex <= 40);
+
+  const behind = computePrefetchRange(window, { ...input, direction: "backward" });
+  assert.deepEqual(behind, { startIndex: 0, endIndex: 0 });
+});
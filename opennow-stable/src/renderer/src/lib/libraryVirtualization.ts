@@ -0,0 +1,102 @@
+// Pure geometry for windowed library-grid rendering. The library grid is a
+// CSS `repeat(auto-fill, ...)` grid inside a scrolling container; with a
+// large library every card used to mount at once and scrolling paid for all
+// of them. These helpers turn a measured layout (column count, row stride)
+// and a scroll position into the row-aligned slice of items worth mounting,
+// plus the screenful to prefetch next in the current scroll direction.
+
+export type ScrollDirection = "forward" | "backward";
+
+export interface IndexRange {
+  /** First item index, inclusive. */
+  startIndex: number;
+  /** Last item index, exclusive. */
+  endIndex: number;
+}
+
+export interface VirtualWindow extends IndexRange {
+  /** Height of the unmounted rows above the slice, in px. */
+  topPadding: number;
+  /** Height of the unmounted rows below the slice, in px. */
+  bottomPadding: number;
+}
+
+export interface VirtualWindowInput {
+  itemCount: number;
+  columnCount: number;
+  /** Row stride: card height plus the grid row gap, in px. */
+  rowHeight: number;
+  scrollTop: number;
+  viewportHeight: number;
+  /** Extra rows mounted beyond the viewport edge the user scrolls toward. */
+  overscanRows: number;
+  direction: ScrollDirection;
+}
+
+function clampRow(row: number, rowCount: number): number {
+  return Math.max(0, Math.min(row, rowCount));
+}
+
+/**
+ * Mirrors `repeat(auto-fill, minmax(columnMinWidth, 1fr))`: as many columns
+ * as fit at their minimum width, with the gap counted between columns only.
+ */
+export function computeColumnCount(containerWidth: number, columnMinWidth: number, columnGap: number): number {
+  if (containerWidth <= 0 || columnMinWidth <= 0) return 1;
+  return Math.max(1, Math.floor((containerWidth + columnGap) / (columnMinWidth + columnGap)));
+}
+
+/**
+ * Computes the row-aligned item slice to mount for the current scroll
+ * position. Overscan is biased toward the scroll direction: the full
+ * overscan leads the viewport and roughly half trails it, so fast scrolling
+ * meets already-mounted cards while the trail stays cheap.
+ */
+export function computeVirtualWindow(input: VirtualWindowInput): VirtualWindow {
+  const { itemCount, columnCount, rowHeight, scrollTop, viewportHeight, overscanRows, direction } = input;
+  if (itemCount <= 0) {
+    return { startIndex: 0, endIndex: 0, topPadding: 0, bottomPadding: 0 };
+  }
+  if (columnCount <= 0 || rowHeight <= 0) {
+    // Not measured yet; mount everything rather than guess at geometry.
+    return { startIndex: 0, endIndex: itemCount, topPadding: 0, bottomPadding: 0 };
+  }
+
+  const rowCount = Math.ceil(itemCount / columnCount);
+  const firstVisibleRow = clampRow(Math.floor(scrollTop / rowHeight), rowCount);
+  const visibleRowCount = Math.max(1, Math.ceil(viewportHeight / rowHeight) + 1);
+  const leadRows = overscanRows;
+  const trailRows = Math.ceil(overscanRows / 2);
+  const startRow = clampRow(firstVisibleRow - (direction === "forward" ? trailRows : leadRows), rowCount);
+  const endRow = clampRow(firstVisibleRow + visibleRowCount + (direction === "forward" ? leadRows : trailRows), rowCount);
+
+  return {
+    startIndex: startRow * columnCount,
+    endIndex: Math.min(endRow * columnCount, itemCount),
+    topPadding: startRow * rowHeight,
+    bottomPadding: (rowCount - endRow) * rowHeight,
+  };
+}
+
+/**
+ * The next screenful of items beyond the mounted window in the scroll
+ * direction. These are not mounted; their artwork is handed to the decode
+ * worker so the bitmaps are ready before the cards appear.
+ */
+export function computePrefetchRange(
+  window: IndexRange,
+  input: Pick<VirtualWindowInput, "itemCount" | "columnCount" | "rowHeight" | "viewportHeight" | "direction">,
+): IndexRange {
+  const { itemCount, columnCount, rowHeight, viewportHeight, direction } = input;
+  if (itemCount <= 0 || columnCount <= 0 || rowHeight <= 0) {
+    return { startIndex: 0, endIndex: 0 };
+  }
+
+  const screenfulItems = Math.max(1, Math.ceil(viewportHeight / rowHeight)) * columnCount;
+  if (direction === "forward") {
+    const startIndex = Math.min(window.endIndex, itemCount);
+    return { startIndex, endIndex: Math.min(startIndex + screenfulItems, itemCount) };
+  }
+  const endIndex = Math.max(window.startIndex, 0);
+  return { startIndex: Math.max(endIndex - screenfulItems, 0), endIndex };
+}
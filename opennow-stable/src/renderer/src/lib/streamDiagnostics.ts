@@ -47,6 +47,7 @@ export function defaultDiagnostics(): StreamDiagnostics {
     decoderPressureActive: false,
     decoderRecoveryAttempts: 0,
     decoderRecoveryAction: "none",
+    decoderPressureOutlook: "learning",
     nativeRequestedFps: undefined,
     nativeCapsFramerate: undefined,
     nativeQueueMode: undefined,
@@ -56,6 +57,11 @@ export function defaultDiagnostics(): StreamDiagnostics {
     nativeTransitionSummary: undefined,
     nativeRequestedStreamingFeaturesSummary: undefined,
     nativeFinalizedStreamingFeaturesSummary: undefined,
+    nativeFrameLatency: undefined,
+    framePacingMode: undefined,
+    framePacingMeasuredFps: undefined,
+    framePacingCadenceFps: undefined,
+    framePacingServerFpsHint: undefined,
     micState: "uninitialized",
     micEnabled: false,
   };
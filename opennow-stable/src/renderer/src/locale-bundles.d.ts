@@ -0,0 +1,6 @@
+declare module "virtual:locale-bundles" {
+  /** Lazy per-namespace locale importers generated by the
+   *  opennow:locale-namespace-bundles plugin in electron.vite.config.ts. */
+  const manifest: Record<string, Record<string, () => Promise<Record<string, unknown>>>>;
+  export default manifest;
+}
@@ -2,11 +2,97 @@ import { useRef, useSyncExternalStore } from "react";
 
 import type { StreamDiagnostics } from "../gfn/webrtcClient";
 
+/** Ring capacity per series; native stats arrive once a second. */
+export const STREAM_DIAGNOSTICS_SERIES_CAPACITY = 120;
+
+export type StreamDiagnosticsSeriesField =
+  | "bitrateKbps"
+  | "decodedFps"
+  | "renderFps"
+  | "sinkDropped";
+
+/**
+ * Preallocated per-metric ring buffers fed by the native stats stream. Samples
+ * are written in place and the aggregate reads walk the live window, so
+ * neither side allocates per sample; the HUD reads trends from here instead of
+ * keeping its own history of snapshot objects.
+ */
+export interface StreamDiagnosticsSeries {
+  readonly capacity: number;
+  sampleCount: () => number;
+  push: (bitrateKbps: number, decodedFps: number, renderFps: number, sinkDropped: number) => void;
+  latest: (field: StreamDiagnosticsSeriesField) => number;
+  average: (field: StreamDiagnosticsSeriesField) => number;
+  max: (field: StreamDiagnosticsSeriesField) => number;
+  reset: () => void;
+}
+
+export function createStreamDiagnosticsSeries(
+  capacity: number = STREAM_DIAGNOSTICS_SERIES_CAPACITY,
+): StreamDiagnosticsSeries {
+  const rings: Record<StreamDiagnosticsSeriesField, Float64Array> = {
+    bitrateKbps: new Float64Array(capacity),
+    decodedFps: new Float64Array(capacity),
+    renderFps: new Float64Array(capacity),
+    sinkDropped: new Float64Array(capacity),
+  };
+  let totalSamples = 0;
+
+  const liveLength = () => Math.min(totalSamples, capacity);
+
+  return {
+    capacity,
+    sampleCount: liveLength,
+    push: (bitrateKbps, decodedFps, renderFps, sinkDropped) => {
+      const slot = totalSamples % capacity;
+      rings.bitrateKbps[slot] = bitrateKbps;
+      rings.decodedFps[slot] = decodedFps;
+      rings.renderFps[slot] = renderFps;
+      rings.sinkDropped[slot] = sinkDropped;
+      totalSamples += 1;
+    },
+    latest: (field) => {
+      if (totalSamples === 0) {
+        return 0;
+      }
+      return rings[field][(totalSamples - 1) % capacity] ?? 0;
+    },
+    average: (field) => {
+      const length = liveLength();
+      if (length === 0) {
+        return 0;
+      }
+      const ring = rings[field];
+      let sum = 0;
+      for (let i = 0; i < length; i++) {
+        sum += ring[i] ?? 0;
+      }
+      return sum / length;
+    },
+    max: (field) => {
+      const length = liveLength();
+      const ring = rings[field];
+      let peak = 0;
+      for (let i = 0; i < length; i++) {
+        const value = ring[i] ?? 0;
+        if (value > peak) {
+          peak = value;
+        }
+      }
+      return peak;
+    },
+    reset: () => {
+      totalSamples = 0;
+    },
+  };
+}
+
 export interface StreamDiagnosticsStore {
   getSnapshot: () => StreamDiagnostics;
   getServerSnapshot: () => StreamDiagnostics;
   subscribe: (listener: () => void) => () => void;
   set: (value: StreamDiagnostics) => void;
+  readonly series: StreamDiagnosticsSeries;
 }
 
 export function createStreamDiagnosticsStore(initial: StreamDiagnostics): StreamDiagnosticsStore {
@@ -33,6 +119,7 @@ export function createStreamDiagnosticsStore(initial: StreamDiagnostics): Stream
       current = value;
       emit();
     },
+    series: createStreamDiagnosticsSeries(),
   };
 }
 
@@ -0,0 +1,46 @@
+/// <reference types="node" />
+import test from "node:test";
+import assert from "node:assert/strict";
+
+import { formatBenchResult, runBench } from "./bench";
+
+test("runBench measures iterations against the provided clock", () => {
+  // Deterministic clock: each call advances 0.25ms, so the 1ms batch-sizing
+  // threshold and the measurement window are exercised without real time.
+  let clock = 0;
+  const result = runBench("sample", () => {}, {
+    durationMs: 10,
+    warmupMs: 0,
+    now: () => {
+      clock += 0.25;
+      return clock;
+    },
+  });
+
+  assert.equal(result.name, "sample");
+  assert.ok(result.iterations > 0);
+  assert.ok(result.totalMs > 0);
+  assert.ok(result.opsPerSec > 0);
+});
+
+test("runBench counts every batched call", () => {
+  let calls = 0;
+  const result = runBench("counted", () => {
+    calls += 1;
+  }, { durationMs: 5, warmupMs: 0 });
+
+  // Warm-up and batch sizing also invoke the body, so at least the measured
+  // iterations must have happened.
+  assert.ok(calls >= result.iterations);
+});
+
+test("formatBenchResult emits the stable comparable line", () => {
+  const line = formatBenchResult({
+    name: "suite/case",
+    opsPerSec: 1234567.89,
+    iterations: 1000,
+    totalMs: 0.81,
+  });
+
+  assert.equal(line, "bench suite/case: 1,234,568 ops/s (1000 iterations in 1ms)");
+});
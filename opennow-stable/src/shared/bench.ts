@@ -0,0 +1,83 @@
+/**
+ * Minimal micro-benchmark harness for the renderer hot paths, run by
+ * `npm run bench` (scripts/run-benchmarks.mjs) over the `*.bench.ts` files
+ * under src.
+ *
+ * Each result is a single ops/sec line in a stable format so runs can be
+ * diffed against the committed baseline (benchmarks/baseline.txt) and against
+ * the Criterion throughput numbers from `native/opennow-streamer`. This is
+ * deliberately not a statistics package: it warms the JIT, sizes batches so
+ * clock reads never dominate nanosecond-scale bodies, and reports the mean.
+ */
+
+export interface BenchResult {
+  name: string;
+  opsPerSec: number;
+  iterations: number;
+  totalMs: number;
+}
+
+export interface BenchOptions {
+  /** Measurement window per bench, default 500ms. */
+  durationMs?: number;
+  /** JIT warm-up before measuring, default 100ms. */
+  warmupMs?: number;
+  /** Clock override for tests. */
+  now?: () => number;
+}
+
+export function runBench(name: string, fn: () => void, options: BenchOptions = {}): BenchResult {
+  const now = options.now ?? ((): number => performance.now());
+  const durationMs = options.durationMs ?? 500;
+  const warmupMs = options.warmupMs ?? 100;
+
+  const warmupEnd = now() + warmupMs;
+  while (now() < warmupEnd) {
+    fn();
+  }
+
+  // Size the batch so each clock read covers at least ~1ms of work;
+  // per-iteration reads would swamp sub-microsecond bodies.
+  let batch = 1;
+  for (;;) {
+    const start = now();
+    for (let i = 0; i < batch; i += 1) {
+      fn();
+    }
+    if (now() - start >= 1 || batch >= 1 << 20) {
+      break;
+    }
+    batch *= 2;
+  }
+
+  let iterations = 0;
+  let totalMs = 0;
+  const deadline = now() + durationMs;
+  while (now() < deadline) {
+    const start = now();
+    for (let i = 0; i < batch; i += 1) {
+      fn();
+    }
+    totalMs += now() - start;
+    iterations += batch;
+  }
+
+  return {
+    name,
+    iterations,
+    totalMs,
+    opsPerSec: totalMs > 0 ? (iterations * 1000) / totalMs : 0,
+  };
+}
+
+export function formatBenchResult(result: BenchResult): string {
+  const ops = Math.round(result.opsPerSec).toLocaleString("en-US");
+  return `bench ${result.name}: ${ops} ops/s (${result.iterations} iterations in ${result.totalMs.toFixed(0)}ms)`;
+}
+
+/** Runs one bench and prints its line; the unit every *.bench.ts file uses. */
+export function bench(name: string, fn: () => void, options: BenchOptions = {}): BenchResult {
+  const result = runBench(name, fn, options);
+  console.log(formatBenchResult(result));
+  return result;
+}
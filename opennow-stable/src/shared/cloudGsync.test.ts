@@ -15,6 +15,7 @@ const vrrCapabilities: NativeCloudGsyncCapabilities = {
   isGsyncDisplay: true,
   minimumFpsForCloudGsync: 60,
   minimumFpsForReflexWithoutVrr: 120,
+  displayRefreshHz: 144,
   detectionSource: "native",
 };
 
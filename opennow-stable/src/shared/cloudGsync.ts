@@ -23,6 +23,8 @@ export interface NativeCloudGsyncCapabilities {
   isGsyncDisplay: boolean;
   minimumFpsForCloudGsync: number;
   minimumFpsForReflexWithoutVrr: number;
+  /** Primary display refresh rate in Hz, 0 when unknown. Feeds the frame-pacing engine. */
+  displayRefreshHz: number;
   detectionSource: NativeCloudGsyncDetectionSource;
   reason?: string;
 }
@@ -51,6 +53,7 @@ export function unsupportedNativeCloudGsyncCapabilities(reason = "unsupported"):
     isGsyncDisplay: false,
     minimumFpsForCloudGsync: DEFAULT_MINIMUM_FPS_FOR_CLOUD_GSYNC,
     minimumFpsForReflexWithoutVrr: DEFAULT_MINIMUM_FPS_FOR_REFLEX_WITHOUT_VRR,
+    displayRefreshHz: 0,
     detectionSource: "unsupported",
     reason,
   };
@@ -80,6 +83,7 @@ export function normalizeNativeCloudGsyncCapabilities(
       capabilities?.minimumFpsForCloudGsync ?? DEFAULT_MINIMUM_FPS_FOR_CLOUD_GSYNC,
     minimumFpsForReflexWithoutVrr:
       capabilities?.minimumFpsForReflexWithoutVrr ?? DEFAULT_MINIMUM_FPS_FOR_REFLEX_WITHOUT_VRR,
+    displayRefreshHz: capabilities?.displayRefreshHz ?? 0,
     detectionSource: capabilities?.detectionSource ?? "unsupported",
     reason: capabilities?.reason,
   };
@@ -0,0 +1,131 @@
+/// <reference types="node" />
+
+import test from "node:test";
+import assert from "node:assert/strict";
+
+import {
+  DECODER_RESTORE_STEADY_SAMPLES,
+  DecoderPressurePredictor,
+  type DecoderPressureSample,
+} from "./decoderPressure";
+
+function sample(
+  atMs: number,
+  decodeTimeMs: number,
+  backlogFrames = 0,
+  frameBudgetMs = 1000 / 60,
+): DecoderPressureSample {
+  return { atMs, decodeTimeMs, backlogFrames, frameBudgetMs };
+}
+
+/** Feeds steady healthy decode times so the baseline becomes trusted. */
+function settle(predictor: DecoderPressurePredictor, decodeTimeMs: number, polls = 20): number {
+  let atMs = 0;
+  for (let i = 0; i < polls; i += 1) {
+    atMs = i * 500;
+    predictor.push(sample(atMs, decodeTimeMs + (i % 2 === 0 ? 0.2 : -0.2)));
+  }
+  return atMs;
+}
+
+test("reports learning until the baseline is trusted", () => {
+  const predictor = new DecoderPressurePredictor();
+  predictor.push(sample(0, 5));
+  predictor.push(sample(500, 5));
+  const forecast = predictor.decide();
+  assert.equal(forecast.outlook, "learning");
+  assert.equal(forecast.action, "none");
+});
+
+test("flat decode time and backlog stay steady", () => {
+  const predictor = new DecoderPressurePredictor();
+  settle(predictor, 8);
+  const forecast = predictor.decide();
+  assert.equal(forecast.outlook, "steady");
+  assert.equal(forecast.action, "none");
+  assert.ok(forecast.learnedThresholdMs > 8);
+});
+
+test("a decode-time ramp toward the frame budget recommends a bitrate shave", () => {
+  const predictor = new DecoderPressurePredictor();
+  let atMs = settle(predictor, 8);
+  // Ramp from 8ms toward the 16.7ms budget; projection crosses half-budget
+  // and the learned threshold well before any frame is actually late.
+  for (let i = 1; i <= 8; i += 1) {
+    atMs += 500;
+    predictor.push(sample(atMs, 8 + i * 0.6));
+  }
+  const forecast = predictor.decide();
+  assert.equal(forecast.outlook, "rising");
+  assert.equal(forecast.action, "shave_bitrate");
+  assert.ok(forecast.projectedDecodeTimeMs > forecast.learnedThresholdMs);
+});
+
+test("the same drift on a slow machine's wider baseline is not abnormal", () => {
+  const predictor = new DecoderPressurePredictor();
+  // A machine that always decodes around 12ms with real spread learns a
+  // threshold well above the 13ms this mild drift reaches.
+  let atMs = 0;
+  for (let i = 0; i < 30; i += 1) {
+    atMs = i * 500;
+    predictor.push(sample(atMs, 12 + ((i % 3) - 1) * 2));
+  }
+  for (let i = 1; i <= 10; i += 1) {
+    atMs += 500;
+    predictor.push(sample(atMs, 12 + i * 0.1));
+  }
+  const forecast = predictor.decide();
+  assert.equal(forecast.outlook, "steady");
+});
+
+test("a backlog ramp with decode time on budget recommends a keyframe", () => {
+  const predictor = new DecoderPressurePredictor();
+  let atMs = settle(predictor, 6);
+  for (let i = 1; i <= 8; i += 1) {
+    atMs += 500;
+    predictor.push(sample(atMs, 6, i * 2));
+  }
+  const forecast = predictor.decide();
+  assert.equal(forecast.outlook, "rising");
+  assert.equal(forecast.action, "request_keyframe");
+  assert.ok(forecast.backlogTrendPerSec >= 2);
+});
+
+test("sustained headroom recommends restoring bitrate", () => {
+  const predictor = new DecoderPressurePredictor();
+  let atMs = settle(predictor, 6);
+  let forecast = predictor.decide();
+  for (let i = 0; i < DECODER_RESTORE_STEADY_SAMPLES + 8; i += 1) {
+    atMs += 500;
+    predictor.push(sample(atMs, 6 - i * 0.01));
+    forecast = predictor.decide();
+  }
+  assert.equal(forecast.outlook, "headroom");
+  assert.equal(forecast.action, "restore_bitrate");
+});
+
+test("a trouble sample resets the headroom streak", () => {
+  const predictor = new DecoderPressurePredictor();
+  let atMs = settle(predictor, 6);
+  for (let i = 0; i < DECODER_RESTORE_STEADY_SAMPLES - 1; i += 1) {
+    atMs += 500;
+    predictor.push(sample(atMs, 6));
+    predictor.decide();
+  }
+  atMs += 500;
+  predictor.push(sample(atMs, 14));
+  predictor.decide();
+  atMs += 500;
+  predictor.push(sample(atMs, 6));
+  const forecast = predictor.decide();
+  assert.notEqual(forecast.action, "restore_bitrate");
+});
+
+test("a timestamp reset restarts the trend window but keeps the baseline", () => {
+  const predictor = new DecoderPressurePredictor();
+  settle(predictor, 8);
+  predictor.push(sample(0, 8));
+  const forecast = predictor.decide();
+  assert.equal(forecast.outlook, "learning");
+  assert.ok(forecast.learnedThresholdMs > 0);
+});
@@ -0,0 +1,245 @@
+// Predictive decoder-pressure engine. The reactive recovery path in
+// webrtcClient.ts only acts once the decode backlog has already grown and
+// frames are visibly late; this engine watches the decode-time and backlog
+// trends in the stats the client already collects and flags the ramp while
+// frames are still on time, so the client can shave bitrate or request a
+// keyframe before the stall instead of after it. Decision thresholds are
+// learned per machine from the stream's own healthy baseline (EWMA mean and
+// variance of decode time) rather than hardcoded, because 2 ms of decode time
+// is alarming on a desktop GPU and routine on an old iGPU.
+
+/** How much sample history the trend window keeps. */
+export const DECODER_TREND_WINDOW_MS = 4000;
+/** Minimum sample span before the engine reports anything but "learning". */
+export const DECODER_TREND_MIN_SPAN_MS = 1500;
+/** Smoothing factor for the learned healthy decode-time baseline. */
+export const DECODER_BASELINE_ALPHA = 0.05;
+/** Samples the baseline must absorb before its threshold is trusted. */
+export const DECODER_BASELINE_MIN_SAMPLES = 8;
+/** Decode time beyond baseline + this many standard deviations is abnormal. */
+export const DECODER_BASELINE_SIGMA = 3;
+/** How far ahead the decode-time trend is projected. */
+export const DECODER_PREDICT_HORIZON_MS = 2000;
+/**
+ * A projection only counts as pressure once decode time is a meaningful share
+ * of the frame budget; a fast machine drifting from 2 ms to 3 ms is abnormal
+ * against its own baseline but nowhere near late.
+ */
+export const DECODER_PREDICT_MIN_BUDGET_FRACTION = 0.5;
+/** Backlog growth (frames per second) that counts as a ramp on its own. */
+export const DECODER_BACKLOG_RAMP_PER_SEC = 2;
+/** Decode time below this share of the frame budget counts as headroom. */
+export const DECODER_RESTORE_BUDGET_FRACTION = 0.6;
+/** Consecutive headroom samples before the engine recommends restoring. */
+export const DECODER_RESTORE_STEADY_SAMPLES = 10;
+
+export type DecoderPressureOutlook = "learning" | "steady" | "rising" | "headroom";
+
+export type DecoderPressureAction =
+  | "none"
+  | "shave_bitrate"
+  | "request_keyframe"
+  | "restore_bitrate";
+
+export interface DecoderPressureSample {
+  atMs: number;
+  /** Average per-frame decode time from the inbound-rtp stats. */
+  decodeTimeMs: number;
+  /** framesReceived - framesDecoded at this sample. */
+  backlogFrames: number;
+  /** 1000 / decode fps; how long one frame may take before it is late. */
+  frameBudgetMs: number;
+}
+
+export interface DecoderPressureForecast {
+  outlook: DecoderPressureOutlook;
+  action: DecoderPressureAction;
+  /** Decode time the trend projects at the prediction horizon. */
+  projectedDecodeTimeMs: number;
+  /** Decode-time slope over the window, ms of decode time per second. */
+  decodeTrendMsPerSec: number;
+  /** Backlog slope over the window, frames per second. */
+  backlogTrendPerSec: number;
+  /** The learned abnormal-decode-time line, 0 while still learning. */
+  learnedThresholdMs: number;
+  detail: string;
+}
+
+export class DecoderPressurePredictor {
+  private samples: DecoderPressureSample[] = [];
+  private baselineMeanMs = 0;
+  private baselineVarMs2 = 0;
+  private baselineSamples = 0;
+  private headroomStreak = 0;
+
+  reset(): void {
+    this.samples = [];
+    this.baselineMeanMs = 0;
+    this.baselineVarMs2 = 0;
+    this.baselineSamples = 0;
+    this.headroomStreak = 0;
+  }
+
+  /**
+   * Records one stats-poll sample. Non-monotonic timestamps mean the stream
+   * restarted, so the trend window starts over; the learned baseline is kept
+   * because the machine has not changed.
+   */
+  push(sample: DecoderPressureSample): void {
+    const last = this.samples[this.samples.length - 1];
+    if (last && sample.atMs <= last.atMs) {
+      this.samples = [];
+    }
+    this.samples.push(sample);
+    const cutoff = sample.atMs - DECODER_TREND_WINDOW_MS;
+    while (this.samples.length > 2 && this.samples[1].atMs <= cutoff) {
+      this.samples.shift();
+    }
+    this.learnBaseline(sample.decodeTimeMs);
+  }
+
+  /**
+   * Folds a decode-time observation into the healthy baseline. Samples beyond
+   * the learned abnormal line are excluded once the baseline is trusted, so a
+   * pressure episode cannot drag its own detection threshold upward.
+   */
+  private learnBaseline(decodeTimeMs: number): void {
+    if (this.baselineSamples === 0) {
+      this.baselineMeanMs = decodeTimeMs;
+      this.baselineSamples = 1;
+      return;
+    }
+    if (
+      this.baselineSamples >= DECODER_BASELINE_MIN_SAMPLES &&
+      decodeTimeMs > this.learnedThresholdMs()
+    ) {
+      return;
+    }
+    const diff = decodeTimeMs - this.baselineMeanMs;
+    const increment = DECODER_BASELINE_ALPHA * diff;
+    this.baselineMeanMs += increment;
+    this.baselineVarMs2 = (1 - DECODER_BASELINE_ALPHA) * (this.baselineVarMs2 + diff * increment);
+    this.baselineSamples += 1;
+  }
+
+  private learnedThresholdMs(): number {
+    return this.baselineMeanMs + DECODER_BASELINE_SIGMA * Math.sqrt(this.baselineVarMs2);
+  }
+
+  /** Least-squares slope of a sample field over the window, per second. */
+  private trendPerSec(read: (sample: DecoderPressureSample) => number): number {
+    const n = this.samples.length;
+    if (n < 2) {
+      return 0;
+    }
+    let sumT = 0;
+    let sumV = 0;
+    for (const sample of this.samples) {
+      sumT += sample.atMs;
+      sumV += read(sample);
+    }
+    const meanT = sumT / n;
+    const meanV = sumV / n;
+    let numerator = 0;
+    let denominator = 0;
+    for (const sample of this.samples) {
+      const dt = sample.atMs - meanT;
+      numerator += dt * (read(sample) - meanV);
+      denominator += dt * dt;
+    }
+    return denominator > 0 ? (numerator / denominator) * 1000 : 0;
+  }
+
+  decide(): DecoderPressureForecast {
+    const first = this.samples[0];
+    const last = this.samples[this.samples.length - 1];
+    const learnedThresholdMs = this.baselineSamples >= DECODER_BASELINE_MIN_SAMPLES
+      ? roundMs(this.learnedThresholdMs())
+      : 0;
+
+    if (
+      !first ||
+      !last ||
+      last.atMs - first.atMs < DECODER_TREND_MIN_SPAN_MS ||
+      learnedThresholdMs === 0
+    ) {
+      this.headroomStreak = 0;
+      return forecast("learning", "none", 0, 0, 0, learnedThresholdMs,
+        "Learning this machine's healthy decode-time baseline");
+    }
+
+    const decodeTrendMsPerSec = this.trendPerSec((sample) => sample.decodeTimeMs);
+    const backlogTrendPerSec = this.trendPerSec((sample) => sample.backlogFrames);
+    const projectedDecodeTimeMs = roundMs(
+      last.decodeTimeMs + decodeTrendMsPerSec * (DECODER_PREDICT_HORIZON_MS / 1000),
+    );
+
+    const backlogRamping =
+      backlogTrendPerSec >= DECODER_BACKLOG_RAMP_PER_SEC &&
+      last.backlogFrames > first.backlogFrames;
+    const decodeRamping =
+      decodeTrendMsPerSec > 0 &&
+      projectedDecodeTimeMs >= learnedThresholdMs &&
+      projectedDecodeTimeMs >= last.frameBudgetMs * DECODER_PREDICT_MIN_BUDGET_FRACTION;
+
+    if (decodeRamping || backlogRamping) {
+      this.headroomStreak = 0;
+      // A decode-time ramp means the decoder itself is running out of budget:
+      // less bitrate makes every frame cheaper. A backlog ramp with decode
+      // time still healthy means the decoder is stuck behind its reference
+      // chain: a keyframe lets it resync without touching quality.
+      const action: DecoderPressureAction = decodeRamping ? "shave_bitrate" : "request_keyframe";
+      return forecast(
+        "rising", action, projectedDecodeTimeMs,
+        decodeTrendMsPerSec, backlogTrendPerSec, learnedThresholdMs,
+        decodeRamping
+          ? `Decode time trending to ${projectedDecodeTimeMs}ms of a ${roundMs(last.frameBudgetMs)}ms budget`
+          : `Decode backlog growing ${roundMs(backlogTrendPerSec)} frames/s with decode time on budget`,
+      );
+    }
+
+    const hasHeadroom =
+      decodeTrendMsPerSec <= 0 &&
+      last.decodeTimeMs <= last.frameBudgetMs * DECODER_RESTORE_BUDGET_FRACTION &&
+      backlogTrendPerSec <= 0;
+    this.headroomStreak = hasHeadroom ? this.headroomStreak + 1 : 0;
+
+    if (this.headroomStreak >= DECODER_RESTORE_STEADY_SAMPLES) {
+      return forecast(
+        "headroom", "restore_bitrate", projectedDecodeTimeMs,
+        decodeTrendMsPerSec, backlogTrendPerSec, learnedThresholdMs,
+        "Sustained decode headroom; quality can be restored",
+      );
+    }
+
+    return forecast(
+      "steady", "none", projectedDecodeTimeMs,
+      decodeTrendMsPerSec, backlogTrendPerSec, learnedThresholdMs,
+      "Decode time and backlog trends are flat",
+    );
+  }
+}
+
+function forecast(
+  outlook: DecoderPressureOutlook,
+  action: DecoderPressureAction,
+  projectedDecodeTimeMs: number,
+  decodeTrendMsPerSec: number,
+  backlogTrendPerSec: number,
+  learnedThresholdMs: number,
+  detail: string,
+): DecoderPressureForecast {
+  return {
+    outlook,
+    action,
+    projectedDecodeTimeMs,
+    decodeTrendMsPerSec: roundMs(decodeTrendMsPerSec),
+    backlogTrendPerSec: roundMs(backlogTrendPerSec),
+    learnedThresholdMs,
+    detail,
+  };
+}
+
+function roundMs(value: number): number {
+  return Math.round(value * 10) / 10;
+}
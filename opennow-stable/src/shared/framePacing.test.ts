@@ -0,0 +1,91 @@
+/// <reference types="node" />
+
+import test from "node:test";
+import assert from "node:assert/strict";
+
+import {
+  FramePacingEngine,
+  cadenceCandidates,
+  selectCadence,
+} from "./framePacing";
+
+function feed(engine: FramePacingEngine, fps: number, seconds: number, startAtMs = 0): void {
+  const intervalMs = 1000 / fps;
+  let frames = 0;
+  for (let atMs = startAtMs; atMs <= startAtMs + seconds * 1000; atMs += 250) {
+    frames = Math.floor((atMs - startAtMs) / intervalMs);
+    engine.push(atMs, frames);
+  }
+}
+
+test("cadence candidates are panel divisors, highest first", () => {
+  assert.deepEqual(cadenceCandidates(60), [60, 30, 20, 15]);
+  assert.deepEqual(cadenceCandidates(0), []);
+});
+
+test("selectCadence picks the nearest divisor and breaks ties downward", () => {
+  assert.equal(selectCadence(57, 60), 60);
+  assert.equal(selectCadence(42, 60), 30);
+  assert.equal(selectCadence(45, 60), 30);
+  assert.equal(selectCadence(140, 144), 144);
+});
+
+test("reports measuring until the window has enough span", () => {
+  const engine = new FramePacingEngine();
+  engine.push(0, 0);
+  engine.push(500, 30);
+  const decision = engine.decide({ displayRefreshHz: 60, vrrActive: false });
+  assert.equal(decision.mode, "measuring");
+  assert.equal(decision.serverFpsHint, null);
+});
+
+test("vrr displays need no cadence lock", () => {
+  const engine = new FramePacingEngine();
+  feed(engine, 57, 5);
+  const decision = engine.decide({ displayRefreshHz: 60, vrrActive: true });
+  assert.equal(decision.mode, "vrr");
+  assert.equal(decision.serverFpsHint, null);
+});
+
+test("57 fps on a 60 Hz panel hints the server up to 60", () => {
+  const engine = new FramePacingEngine();
+  feed(engine, 57, 5);
+  const decision = engine.decide({ displayRefreshHz: 60, vrrActive: false });
+  assert.equal(decision.mode, "unlocked");
+  assert.equal(decision.cadenceFps, 60);
+  assert.equal(decision.serverFpsHint, 60);
+});
+
+test("delivery far below a cadence hints the next divisor down", () => {
+  const engine = new FramePacingEngine();
+  feed(engine, 42, 5);
+  const decision = engine.decide({ displayRefreshHz: 60, vrrActive: false });
+  assert.equal(decision.mode, "unlocked");
+  assert.equal(decision.serverFpsHint, 30);
+});
+
+test("delivery at the panel rate reports locked", () => {
+  const engine = new FramePacingEngine();
+  feed(engine, 60, 5);
+  const decision = engine.decide({ displayRefreshHz: 60, vrrActive: false });
+  assert.equal(decision.mode, "locked");
+  assert.equal(decision.cadenceFps, 60);
+  assert.equal(decision.serverFpsHint, 60);
+});
+
+test("unknown refresh rate yields no hint", () => {
+  const engine = new FramePacingEngine();
+  feed(engine, 57, 5);
+  const decision = engine.decide({ displayRefreshHz: 0, vrrActive: false });
+  assert.equal(decision.mode, "unlocked");
+  assert.equal(decision.cadenceFps, null);
+  assert.equal(decision.serverFpsHint, null);
+});
+
+test("counter reset restarts the measurement window", () => {
+  const engine = new FramePacingEngine();
+  feed(engine, 60, 5);
+  engine.push(5250, 3);
+  const decision = engine.decide({ displayRefreshHz: 60, vrrActive: false });
+  assert.equal(decision.mode, "measuring");
+});
@@ -0,0 +1,200 @@
+// Frame-pacing engine for the native streaming path. It consumes presentation
+// progress from the stats channel (cumulative frames-presented counters with
+// arrival timestamps), measures the real delivery cadence, and decides whether
+// that cadence is judder-free for the active panel. On VRR displays the panel
+// tracks delivery and no pacing is needed; on fixed-refresh panels a stream
+// delivering e.g. 57 fps on a 60 Hz panel oscillates between 1- and 2-refresh
+// holds, so the engine recommends the panel-divisor rate the server should
+// target instead (60/N) — surfaced as `pacingFpsHint` on the negotiated
+// stream profile for the next negotiation.
+
+/** How much presentation history the measurement window keeps. */
+export const FRAME_PACING_WINDOW_MS = 5000;
+/** Minimum sample span before the engine reports anything but "measuring". */
+export const FRAME_PACING_MIN_SPAN_MS = 1500;
+/** Delivery within this fraction of a panel cadence counts as locked. */
+export const FRAME_PACING_LOCK_TOLERANCE = 0.01;
+/**
+ * When delivery falls short of the nearest cadence by no more than this
+ * fraction, hint the server up to that cadence (a 57 fps stream should be
+ * paced to 60, not dropped to 30); larger shortfalls hint the next divisor
+ * down, which the stream can actually sustain.
+ */
+export const FRAME_PACING_CHASE_TOLERANCE = 0.12;
+
+/** Panel-divisor cadences considered judder-free (refresh / 1..N). */
+const MAX_CADENCE_DIVISOR = 4;
+
+export type FramePacingMode = "measuring" | "vrr" | "locked" | "unlocked";
+
+export interface FramePacingSample {
+  atMs: number;
+  framesPresented: number;
+}
+
+export interface FramePacingContext {
+  displayRefreshHz: number;
+  vrrActive: boolean;
+}
+
+export interface FramePacingDecision {
+  mode: FramePacingMode;
+  /** Delivery rate measured over the sample window, 0 while measuring. */
+  measuredFps: number;
+  /** The judder-free panel cadence nearest to measured delivery, if any. */
+  cadenceFps: number | null;
+  /** Frame rate the server should target for judder-free presentation. */
+  serverFpsHint: number | null;
+  detail: string;
+}
+
+/** Judder-free cadences for a panel: refresh / 1..4, highest first. */
+export function cadenceCandidates(displayRefreshHz: number): number[] {
+  if (!Number.isFinite(displayRefreshHz) || displayRefreshHz <= 0) {
+    return [];
+  }
+  const candidates: number[] = [];
+  for (let divisor = 1; divisor <= MAX_CADENCE_DIVISOR; divisor += 1) {
+    candidates.push(displayRefreshHz / divisor);
+  }
+  return candidates;
+}
+
+/**
+ * Picks the panel cadence nearest to the measured delivery rate. Ties go to
+ * the lower cadence because the stream has proven it cannot sustain the
+ * higher one.
+ */
+export function selectCadence(measuredFps: number, displayRefreshHz: number): number | null {
+  let best: number | null = null;
+  let bestDistance = Number.POSITIVE_INFINITY;
+  for (const candidate of cadenceCandidates(displayRefreshHz)) {
+    const distance = Math.abs(measuredFps - candidate);
+    if (distance < bestDistance || (distance === bestDistance && best !== null && candidate < best)) {
+      best = candidate;
+      bestDistance = distance;
+    }
+  }
+  return best;
+}
+
+export class FramePacingEngine {
+  private samples: FramePacingSample[] = [];
+
+  reset(): void {
+    this.samples = [];
+  }
+
+  /**
+   * Records one stats sample. The counter is cumulative; a decrease means the
+   * native pipeline restarted, so the window starts over.
+   */
+  push(atMs: number, framesPresented: number): void {
+    const last = this.samples[this.samples.length - 1];
+    if (last && (framesPresented < last.framesPresented || atMs <= last.atMs)) {
+      this.samples = [];
+    }
+    this.samples.push({ atMs, framesPresented });
+    const cutoff = atMs - FRAME_PACING_WINDOW_MS;
+    while (this.samples.length > 2 && this.samples[1].atMs <= cutoff) {
+      this.samples.shift();
+    }
+  }
+
+  /** Delivery rate over the current window, or null while measuring. */
+  measuredFps(): number | null {
+    const first = this.samples[0];
+    const last = this.samples[this.samples.length - 1];
+    if (!first || !last || last.atMs - first.atMs < FRAME_PACING_MIN_SPAN_MS) {
+      return null;
+    }
+    return ((last.framesPresented - first.framesPresented) * 1000) / (last.atMs - first.atMs);
+  }
+
+  decide(context: FramePacingContext): FramePacingDecision {
+    const measured = this.measuredFps();
+    if (measured === null) {
+      return {
+        mode: "measuring",
+        measuredFps: 0,
+        cadenceFps: null,
+        serverFpsHint: null,
+        detail: "Measuring frame delivery cadence",
+      };
+    }
+
+    const measuredFps = roundFps(measured);
+    if (context.vrrActive) {
+      return {
+        mode: "vrr",
+        measuredFps,
+        cadenceFps: null,
+        serverFpsHint: null,
+        detail: "VRR display tracks delivery; no cadence lock needed",
+      };
+    }
+
+    const cadence = selectCadence(measured, context.displayRefreshHz);
+    if (cadence === null) {
+      return {
+        mode: "unlocked",
+        measuredFps,
+        cadenceFps: null,
+        serverFpsHint: null,
+        detail: "Display refresh rate unknown; cannot derive a cadence",
+      };
+    }
+
+    if (Math.abs(measured - cadence) <= cadence * FRAME_PACING_LOCK_TOLERANCE) {
+      return {
+        mode: "locked",
+        measuredFps,
+        cadenceFps: cadence,
+        serverFpsHint: Math.round(cadence),
+        detail: `Delivery locked to ${formatCadence(cadence, context.displayRefreshHz)}`,
+      };
+    }
+
+    const hint = this.chooseServerFpsHint(measured, cadence, context.displayRefreshHz);
+    return {
+      mode: "unlocked",
+      measuredFps,
+      cadenceFps: cadence,
+      serverFpsHint: hint,
+      detail:
+        hint === null
+          ? `Delivery ${measuredFps} fps has no sustainable cadence on a ${context.displayRefreshHz} Hz panel`
+          : `Delivery ${measuredFps} fps oscillates on a ${context.displayRefreshHz} Hz panel; server should target ${hint} fps`,
+    };
+  }
+
+  private chooseServerFpsHint(
+    measured: number,
+    nearestCadence: number,
+    displayRefreshHz: number,
+  ): number | null {
+    if (
+      nearestCadence > measured &&
+      nearestCadence - measured <= nearestCadence * FRAME_PACING_CHASE_TOLERANCE
+    ) {
+      return Math.round(nearestCadence);
+    }
+    for (const candidate of cadenceCandidates(displayRefreshHz)) {
+      if (candidate <= measured) {
+        return Math.round(candidate);
+      }
+    }
+    return null;
+  }
+}
+
+function roundFps(value: number): number {
+  return Math.round(value * 10) / 10;
+}
+
+function formatCadence(cadence: number, displayRefreshHz: number): string {
+  const divisor = Math.round(displayRefreshHz / cadence);
+  return divisor <= 1
+    ? `the panel rate (${Math.round(cadence)} fps)`
+    : `${Math.round(cadence)} fps (1/${divisor} of the panel rate)`;
+}
@@ -590,7 +590,13 @@ export interface StreamRegion {
 
 export interface PingResult {
   url: string;
+  /** Median (p50) connect latency across the probe samples, null when all failed. */
   pingMs: number | null;
+  p95Ms?: number;
+  /** Mean absolute successive-sample difference (RFC 3550 style). */
+  jitterMs?: number;
+  /** How many probe samples succeeded. */
+  samples?: number;
   error?: string;
 }
 
@@ -934,6 +940,13 @@ export interface NegotiatedStreamProfile {
   enableL4S?: boolean;
   enableCloudGsync?: boolean;
   enableReflex?: boolean;
+  /**
+   * Client-side frame-pacing hint: the fps the server should target so
+   * presentation locks to a judder-free divisor of the panel refresh rate.
+   * Derived by the frame-pacing engine from the previous stream's measured
+   * delivery cadence; absent until a stream has been measured.
+   */
+  pacingFpsHint?: number;
 }
 
 export interface SessionAdMediaFile {
@@ -1117,13 +1130,17 @@ export function buildNativeStreamerSessionContext(
   session: SessionInfo,
   settings: StreamSettings,
   shortcuts: NativeStreamerShortcutBindings,
+  pacingFpsHint?: number,
 ): NativeStreamerSessionContext {
-  const negotiatedStreamProfile = session.negotiatedStreamProfile
+  const negotiatedStreamProfile: NegotiatedStreamProfile = session.negotiatedStreamProfile
     ? {
       ...session.negotiatedStreamProfile,
       codec: session.negotiatedStreamProfile.codec ?? settings.codec,
     }
     : { codec: settings.codec };
+  if (pacingFpsHint !== undefined && pacingFpsHint > 0) {
+    negotiatedStreamProfile.pacingFpsHint = Math.round(pacingFpsHint);
+  }
 
   return {
     session: {
@@ -1195,6 +1212,8 @@ export type MainToRendererSignalingEvent =
   | { type: "native-stream-started"; message?: string }
   | { type: "native-stream-stopped"; reason?: string }
   | { type: "native-stream-stats"; stats: NativeStreamStats }
+  | { type: "native-stream-stats-frame"; frame: ArrayBuffer }
+  | { type: "native-frame-latency"; latency: NativeFrameLatencyStats }
   | { type: "native-stream-transition"; transition: NativeVideoTransition }
   | { type: "native-input-ready"; protocolVersion: number }
   | { type: "error"; message: string }
@@ -1232,6 +1251,23 @@ export interface NativeStreamStats {
   finalizedStreamingFeaturesSummary?: string;
 }
 
+export interface NativeFrameLatencyStage {
+  p50Ms: number;
+  p99Ms: number;
+  samples: number;
+}
+
+/**
+ * Per-stage latency percentiles measured between pad probes inside the native
+ * video chain: depayloader -> pre-decode queue out (queueWait), queue out ->
+ * decoder out (decode), decoder out -> sink (present).
+ */
+export interface NativeFrameLatencyStats {
+  queueWait: NativeFrameLatencyStage;
+  decode: NativeFrameLatencyStage;
+  present: NativeFrameLatencyStage;
+}
+
 /** Dialog result for session conflict resolution */
 export type SessionConflictChoice = "resume" | "new" | "cancel";
 
@@ -1411,6 +1447,13 @@ export interface OpenNowApi {
 
   deleteCache(): Promise<void>;
 
+  /** Read one section of the persisted catalog snapshot (JSON text), or null if absent/invalid */
+  loadCatalogSnapshotSection(input: { part: "summary" | "full" }): Promise<string | null>;
+  /** Persist the catalog snapshot as a compressed summary + full two-section file */
+  saveCatalogSnapshotFile(input: { summaryJson: string; fullJson: string }): Promise<void>;
+  /** Delete the persisted catalog snapshot file */
+  clearCatalogSnapshotFile(): Promise<void>;
+
   /** Fetch current GFN queue wait times from the PrintedWaste API */
   fetchPrintedWasteQueue(): Promise<PrintedWasteQueueData>;
   /** Fetch PrintedWaste server mapping metadata (includes nuked status) */
@@ -0,0 +1,77 @@
+/// <reference types="node" />
+
+import test from "node:test";
+import assert from "node:assert/strict";
+
+import { HotPathLogger } from "./hotPathLog";
+
+function makeLogger(capacity: number): { logger: HotPathLogger; lines: string[] } {
+  const lines: string[] = [];
+  const logger = new HotPathLogger({
+    capacity,
+    sink: (channel, line) => lines.push(`[${channel}] ${line}`),
+  });
+  return { logger, lines };
+}
+
+test("flush drains records in order with lazy formatting", () => {
+  const { logger, lines } = makeLogger(8);
+
+  logger.log("WebRTC", "pr-input send bytes", 12);
+  logger.log("NativeStreamer", "input sent bytes", 7, 1);
+  logger.log("WebRTC", "bare event");
+  assert.equal(logger.pendingRecords(), 3);
+
+  logger.flush();
+  assert.deepEqual(lines, [
+    "[WebRTC] pr-input send bytes 12",
+    "[NativeStreamer] input sent bytes 7 1",
+    "[WebRTC] bare event",
+  ]);
+  assert.equal(logger.pendingRecords(), 0);
+  logger.stop();
+});
+
+test("overflow drops records and reports a count instead of blocking", () => {
+  const { logger, lines } = makeLogger(2);
+
+  logger.log("WebRTC", "a", 1);
+  logger.log("WebRTC", "b", 2);
+  logger.log("WebRTC", "c", 3);
+  logger.log("WebRTC", "d", 4);
+  assert.equal(logger.droppedRecords(), 2);
+
+  logger.flush();
+  assert.deepEqual(lines, [
+    "[WebRTC] a 1",
+    "[WebRTC] b 2",
+    "[HotPathLog] ring overflow, dropped 2 records",
+  ]);
+  assert.equal(logger.droppedRecords(), 0);
+  logger.stop();
+});
+
+test("ring slots are reused across flushes", () => {
+  const { logger, lines } = makeLogger(2);
+
+  for (let round = 0; round < 5; round++) {
+    logger.log("WebRTC", "tick", round);
+    logger.flush();
+  }
+
+  assert.deepEqual(lines, [
+    "[WebRTC] tick 0",
+    "[WebRTC] tick 1",
+    "[WebRTC] tick 2",
+    "[WebRTC] tick 3",
+    "[WebRTC] tick 4",
+  ]);
+  logger.stop();
+});
+
+test("stop flushes whatever is still buffered", () => {
+  const { logger, lines } = makeLogger(8);
+  logger.log("WebRTC", "last", 9);
+  logger.stop();
+  assert.deepEqual(lines, ["[WebRTC] last 9"]);
+});
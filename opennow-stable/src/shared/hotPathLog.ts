@@ -0,0 +1,148 @@
+/**
+ * Ring-buffer logger for streaming hot paths (input forwarding, data-channel
+ * sends). Call sites push structured records — string refs plus up to four
+ * numbers, no formatting and no per-call allocation — into a preallocated
+ * ring; a background flusher drains the ring in batches and only then builds
+ * strings, handing them to the process LogCapture (or console.debug when no
+ * capture is installed). When the ring is full the record is dropped and
+ * counted instead of blocking the caller, so verbose stream logging can stay
+ * on in production without showing up as main-thread time in traces.
+ */
+
+import { getLogCapture } from "./logger";
+
+const DEFAULT_CAPACITY = 2048;
+const DEFAULT_FLUSH_INTERVAL_MS = 250;
+
+interface HotLogSlot {
+  timestampMs: number;
+  channel: string;
+  event: string;
+  valueCount: number;
+  v0: number;
+  v1: number;
+  v2: number;
+  v3: number;
+}
+
+export type HotPathLogSink = (channel: string, line: string) => void;
+
+function defaultSink(channel: string, line: string): void {
+  const capture = getLogCapture();
+  if (capture) {
+    capture.addEntry("debug", channel, line, []);
+  } else {
+    console.debug(`[${channel}] ${line}`);
+  }
+}
+
+export function formatHotLogRecord(slot: HotLogSlot): string {
+  let line = slot.event;
+  if (slot.valueCount > 0) line += ` ${slot.v0}`;
+  if (slot.valueCount > 1) line += ` ${slot.v1}`;
+  if (slot.valueCount > 2) line += ` ${slot.v2}`;
+  if (slot.valueCount > 3) line += ` ${slot.v3}`;
+  return line;
+}
+
+export class HotPathLogger {
+  private readonly slots: HotLogSlot[];
+  private readonly capacity: number;
+  private readonly flushIntervalMs: number;
+  private readonly sink: HotPathLogSink;
+  private writeIndex = 0;
+  private readIndex = 0;
+  private dropped = 0;
+  private flushTimer: ReturnType<typeof setInterval> | null = null;
+
+  constructor(options: { capacity?: number; flushIntervalMs?: number; sink?: HotPathLogSink } = {}) {
+    this.capacity = options.capacity ?? DEFAULT_CAPACITY;
+    this.flushIntervalMs = options.flushIntervalMs ?? DEFAULT_FLUSH_INTERVAL_MS;
+    this.sink = options.sink ?? defaultSink;
+    this.slots = Array.from({ length: this.capacity }, () => ({
+      timestampMs: 0,
+      channel: "",
+      event: "",
+      valueCount: 0,
+      v0: 0,
+      v1: 0,
+      v2: 0,
+      v3: 0,
+    }));
+  }
+
+  /**
+   * Records one event. `channel` and `event` should be literal strings (refs,
+   * not built per call); numeric payload goes in the value slots. Never
+   * blocks: a full ring drops the record and bumps the overflow counter.
+   */
+  log(channel: string, event: string, v0?: number, v1?: number, v2?: number, v3?: number): void {
+    if (this.writeIndex - this.readIndex >= this.capacity) {
+      this.dropped += 1;
+      return;
+    }
+
+    const slot = this.slots[this.writeIndex % this.capacity];
+    slot.timestampMs = Date.now();
+    slot.channel = channel;
+    slot.event = event;
+    slot.valueCount = v3 !== undefined ? 4 : v2 !== undefined ? 3 : v1 !== undefined ? 2 : v0 !== undefined ? 1 : 0;
+    slot.v0 = v0 ?? 0;
+    slot.v1 = v1 ?? 0;
+    slot.v2 = v2 ?? 0;
+    slot.v3 = v3 ?? 0;
+    this.writeIndex += 1;
+
+    if (!this.flushTimer) {
+      this.startFlusher();
+    }
+  }
+
+  /** Serializes and emits everything currently in the ring. */
+  flush(): void {
+    while (this.readIndex < this.writeIndex) {
+      const slot = this.slots[this.readIndex % this.capacity];
+      this.readIndex += 1;
+      this.sink(slot.channel, formatHotLogRecord(slot));
+    }
+
+    if (this.dropped > 0) {
+      const dropped = this.dropped;
+      this.dropped = 0;
+      this.sink("HotPathLog", `ring overflow, dropped ${dropped} records`);
+    }
+  }
+
+  pendingRecords(): number {
+    return this.writeIndex - this.readIndex;
+  }
+
+  droppedRecords(): number {
+    return this.dropped;
+  }
+
+  stop(): void {
+    if (this.flushTimer) {
+      clearInterval(this.flushTimer);
+      this.flushTimer = null;
+    }
+    this.flush();
+  }
+
+  private startFlusher(): void {
+    this.flushTimer = setInterval(() => {
+      this.flush();
+    }, this.flushIntervalMs);
+    (this.flushTimer as { unref?: () => void }).unref?.();
+  }
+}
+
+// Process-wide instance; the flusher only starts once something logs.
+let globalHotPathLogger: HotPathLogger | null = null;
+
+export function getHotPathLogger(): HotPathLogger {
+  if (!globalHotPathLogger) {
+    globalHotPathLogger = new HotPathLogger();
+  }
+  return globalHotPathLogger;
+}
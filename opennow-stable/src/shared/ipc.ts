@@ -82,6 +82,9 @@ export const IPC_CHANNELS = {
   CACHE_REFRESH_MANUAL: "cache:refresh-manual",
   CACHE_STATUS_UPDATE: "cache:status-update",
   CACHE_DELETE_ALL: "cache:delete-all",
+  CATALOG_SNAPSHOT_LOAD: "catalog-snapshot:load",
+  CATALOG_SNAPSHOT_SAVE: "catalog-snapshot:save",
+  CATALOG_SNAPSHOT_CLEAR: "catalog-snapshot:clear",
   COMMUNITY_GET_THANKS: "community:get-thanks",
   // Media browsing
   MEDIA_LIST_BY_GAME: "media:list-by-game",
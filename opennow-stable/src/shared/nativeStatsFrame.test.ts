@@ -0,0 +1,163 @@
+/// <reference types="node" />
+
+import test from "node:test";
+import assert from "node:assert/strict";
+
+import { decodeNativeStatsFrame, NATIVE_STATS_FRAME_LAYOUT_VERSION } from "./nativeStatsFrame";
+
+interface FrameFields {
+  flags: number;
+  bitrateKbps: number;
+  targetBitrateKbps: number;
+  bitratePerformancePercent: number;
+  decodedFps: number;
+  renderFps: number;
+  framesDecoded: number;
+  framesRendered: number;
+  framesPendingToPresent: number;
+  sinkRendered: number;
+  sinkDropped: number;
+  requestedFps: number;
+  queueDepthChanges: number;
+  presentPacingChanges: number;
+  partialFlushCount: number;
+  completeFlushCount: number;
+  lastTransitionAtMs: number;
+  strings: string[];
+}
+
+// Mirrors encode_stats_frame in the streamer's binary_transport.rs.
+function encodeFrame(fields: FrameFields): ArrayBuffer {
+  const encoder = new TextEncoder();
+  const encodedStrings = fields.strings.map((text) => encoder.encode(text));
+  const stringBytes = encodedStrings.reduce((total, bytes) => total + 2 + bytes.byteLength, 0);
+  const buffer = new ArrayBuffer(103 + stringBytes);
+  const view = new DataView(buffer);
+  const bytes = new Uint8Array(buffer);
+
+  view.setUint8(0, NATIVE_STATS_FRAME_LAYOUT_VERSION);
+  view.setUint16(1, fields.flags, true);
+  view.setUint32(3, fields.bitrateKbps, true);
+  view.setUint32(7, fields.targetBitrateKbps, true);
+  view.setFloat64(11, fields.bitratePerformancePercent, true);
+  view.setFloat64(19, fields.decodedFps, true);
+  view.setFloat64(27, fields.renderFps, true);
+  view.setBigUint64(35, BigInt(fields.framesDecoded), true);
+  view.setBigUint64(43, BigInt(fields.framesRendered), true);
+  view.setBigUint64(51, BigInt(fields.framesPendingToPresent), true);
+  view.setBigUint64(59, BigInt(fields.sinkRendered), true);
+  view.setBigUint64(67, BigInt(fields.sinkDropped), true);
+  view.setUint32(75, fields.requestedFps, true);
+  view.setUint32(79, fields.queueDepthChanges, true);
+  view.setUint32(83, fields.presentPacingChanges, true);
+  view.setUint32(87, fields.partialFlushCount, true);
+  view.setUint32(91, fields.completeFlushCount, true);
+  view.setBigUint64(95, BigInt(fields.lastTransitionAtMs), true);
+
+  let offset = 103;
+  for (const encoded of encodedStrings) {
+    view.setUint16(offset, encoded.byteLength, true);
+    bytes.set(encoded, offset + 2);
+    offset += 2 + encoded.byteLength;
+  }
+  return buffer;
+}
+
+const FLAG_ZERO_COPY = 1 << 0;
+const FLAG_ZERO_COPY_D3D11 = 1 << 1;
+const FLAG_HAS_REQUESTED_FPS = 1 << 3;
+const FLAG_HAS_SINK_RENDERED = 1 << 4;
+const FLAG_HAS_SINK_DROPPED = 1 << 5;
+const FLAG_HAS_CAPS_FRAMERATE = 1 << 7;
+
+function sampleFields(): FrameFields {
+  return {
+    flags:
+      FLAG_ZERO_COPY |
+      FLAG_ZERO_COPY_D3D11 |
+      FLAG_HAS_REQUESTED_FPS |
+      FLAG_HAS_SINK_RENDERED |
+      FLAG_HAS_SINK_DROPPED |
+      FLAG_HAS_CAPS_FRAMERATE,
+    bitrateKbps: 42_000,
+    targetBitrateKbps: 50_000,
+    bitratePerformancePercent: 84,
+    decodedFps: 119.5,
+    renderFps: 119,
+    framesDecoded: 7_200,
+    framesRendered: 7_180,
+    framesPendingToPresent: 2,
+    sinkRendered: 7_175,
+    sinkDropped: 5,
+    requestedFps: 120,
+    queueDepthChanges: 3,
+    presentPacingChanges: 1,
+    partialFlushCount: 0,
+    completeFlushCount: 0,
+    lastTransitionAtMs: 0,
+    strings: [
+      "H265",
+      "2560x1440",
+      "NVDEC",
+      "D3D11Memory",
+      "adaptive",
+      "fps=120",
+      "fps=120",
+      "120/1",
+    ],
+  };
+}
+
+test("decodeNativeStatsFrame decodes the fixed layout", () => {
+  const stats = decodeNativeStatsFrame(encodeFrame(sampleFields()));
+
+  assert.ok(stats);
+  assert.equal(stats.codec, "H265");
+  assert.equal(stats.resolution, "2560x1440");
+  assert.equal(stats.hardwareAcceleration, "NVDEC");
+  assert.equal(stats.memoryMode, "D3D11Memory");
+  assert.equal(stats.queueMode, "adaptive");
+  assert.equal(stats.requestedStreamingFeaturesSummary, "fps=120");
+  assert.equal(stats.finalizedStreamingFeaturesSummary, "fps=120");
+  assert.equal(stats.capsFramerate, "120/1");
+  assert.equal(stats.bitrateKbps, 42_000);
+  assert.equal(stats.targetBitrateKbps, 50_000);
+  assert.equal(stats.bitratePerformancePercent, 84);
+  assert.equal(stats.decodedFps, 119.5);
+  assert.equal(stats.renderFps, 119);
+  assert.equal(stats.framesDecoded, 7_200);
+  assert.equal(stats.framesRendered, 7_180);
+  assert.equal(stats.framesPendingToPresent, 2);
+  assert.equal(stats.sinkRendered, 7_175);
+  assert.equal(stats.sinkDropped, 5);
+  assert.equal(stats.requestedFps, 120);
+  assert.equal(stats.zeroCopy, true);
+  assert.equal(stats.zeroCopyD3D11, true);
+  assert.equal(stats.zeroCopyD3D12, false);
+});
+
+test("decodeNativeStatsFrame masks absent optionals", () => {
+  const fields = sampleFields();
+  fields.flags = FLAG_ZERO_COPY;
+  fields.strings = fields.strings.slice(0, 7);
+  const stats = decodeNativeStatsFrame(encodeFrame(fields));
+
+  assert.ok(stats);
+  assert.equal(stats.requestedFps, undefined);
+  assert.equal(stats.sinkRendered, undefined);
+  assert.equal(stats.sinkDropped, undefined);
+  assert.equal(stats.capsFramerate, undefined);
+  assert.equal(stats.lastTransitionType, undefined);
+  assert.equal(stats.lastTransitionSummary, undefined);
+  assert.equal(stats.lastTransitionAtMs, undefined);
+});
+
+test("decodeNativeStatsFrame rejects unknown versions and truncated frames", () => {
+  const frame = encodeFrame(sampleFields());
+  assert.equal(decodeNativeStatsFrame(frame.slice(0, 40)), null);
+  assert.equal(decodeNativeStatsFrame(frame.slice(0, 110)), null);
+
+  const wrongVersion = frame.slice(0);
+  new DataView(wrongVersion).setUint8(0, NATIVE_STATS_FRAME_LAYOUT_VERSION + 1);
+  assert.equal(decodeNativeStatsFrame(wrongVersion), null);
+});
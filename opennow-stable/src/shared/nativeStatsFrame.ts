@@ -0,0 +1,127 @@
+import type { NativeQueueMode, NativeStreamStats } from "./gfn";
+
+// Decoder for the native streamer's fixed-layout stats frame
+// (FRAME_TYPE_STATS on the binary IPC channel). The layout is defined by
+// `encode_stats_frame` in the streamer's binary_transport.rs: a layout
+// version byte, a u16 presence/bool flags word, a fixed little-endian numeric
+// section (absent optionals written as zero and masked by the flags), then
+// u16-length-prefixed UTF-8 strings in a fixed order. The main process
+// forwards the body bytes untouched, so this is the only place on the
+// Electron side that knows the layout.
+
+export const NATIVE_STATS_FRAME_LAYOUT_VERSION = 1;
+
+const FLAG_ZERO_COPY = 1 << 0;
+const FLAG_ZERO_COPY_D3D11 = 1 << 1;
+const FLAG_ZERO_COPY_D3D12 = 1 << 2;
+const FLAG_HAS_REQUESTED_FPS = 1 << 3;
+const FLAG_HAS_SINK_RENDERED = 1 << 4;
+const FLAG_HAS_SINK_DROPPED = 1 << 5;
+const FLAG_HAS_LAST_TRANSITION_AT_MS = 1 << 6;
+const FLAG_HAS_CAPS_FRAMERATE = 1 << 7;
+const FLAG_HAS_LAST_TRANSITION_TYPE = 1 << 8;
+const FLAG_HAS_LAST_TRANSITION_SUMMARY = 1 << 9;
+
+/** Version byte + flags word + the fixed numeric section. */
+const NUMERIC_SECTION_END = 103;
+
+const utf8Decoder = new TextDecoder();
+
+class FrameReader {
+  private offset = NUMERIC_SECTION_END;
+
+  constructor(
+    private readonly view: DataView,
+    private readonly bytes: Uint8Array,
+  ) {}
+
+  nextString(): string | null {
+    if (this.offset + 2 > this.view.byteLength) {
+      return null;
+    }
+    const length = this.view.getUint16(this.offset, true);
+    this.offset += 2;
+    if (this.offset + length > this.view.byteLength) {
+      return null;
+    }
+    const text = utf8Decoder.decode(this.bytes.subarray(this.offset, this.offset + length));
+    this.offset += length;
+    return text;
+  }
+}
+
+/**
+ * Decodes a stats frame body into the same shape the JSON stats event carries.
+ * Returns null for truncated frames or an unknown layout version so callers
+ * can drop the sample instead of misreading it.
+ */
+export function decodeNativeStatsFrame(frame: ArrayBuffer): NativeStreamStats | null {
+  if (frame.byteLength < NUMERIC_SECTION_END) {
+    return null;
+  }
+  const view = new DataView(frame);
+  if (view.getUint8(0) !== NATIVE_STATS_FRAME_LAYOUT_VERSION) {
+    return null;
+  }
+
+  const flags = view.getUint16(1, true);
+  const reader = new FrameReader(view, new Uint8Array(frame));
+  const codec = reader.nextString();
+  const resolution = reader.nextString();
+  const hardwareAcceleration = reader.nextString();
+  const memoryMode = reader.nextString();
+  const queueMode = reader.nextString();
+  const requestedStreamingFeaturesSummary = reader.nextString();
+  const finalizedStreamingFeaturesSummary = reader.nextString();
+  const capsFramerate = flags & FLAG_HAS_CAPS_FRAMERATE ? reader.nextString() : undefined;
+  const lastTransitionType = flags & FLAG_HAS_LAST_TRANSITION_TYPE ? reader.nextString() : undefined;
+  const lastTransitionSummary =
+    flags & FLAG_HAS_LAST_TRANSITION_SUMMARY ? reader.nextString() : undefined;
+  if (
+    codec === null ||
+    resolution === null ||
+    hardwareAcceleration === null ||
+    memoryMode === null ||
+    queueMode === null ||
+    requestedStreamingFeaturesSummary === null ||
+    finalizedStreamingFeaturesSummary === null ||
+    capsFramerate === null ||
+    lastTransitionType === null ||
+    lastTransitionSummary === null
+  ) {
+    return null;
+  }
+
+  return {
+    codec,
+    resolution,
+    hardwareAcceleration,
+    memoryMode,
+    zeroCopy: (flags & FLAG_ZERO_COPY) !== 0,
+    requestedFps: flags & FLAG_HAS_REQUESTED_FPS ? view.getUint32(75, true) : undefined,
+    capsFramerate,
+    bitrateKbps: view.getUint32(3, true),
+    targetBitrateKbps: view.getUint32(7, true),
+    bitratePerformancePercent: view.getFloat64(11, true),
+    decodedFps: view.getFloat64(19, true),
+    renderFps: view.getFloat64(27, true),
+    framesDecoded: Number(view.getBigUint64(35, true)),
+    framesRendered: Number(view.getBigUint64(43, true)),
+    framesPendingToPresent: Number(view.getBigUint64(51, true)),
+    sinkRendered: flags & FLAG_HAS_SINK_RENDERED ? Number(view.getBigUint64(59, true)) : undefined,
+    sinkDropped: flags & FLAG_HAS_SINK_DROPPED ? Number(view.getBigUint64(67, true)) : undefined,
+    zeroCopyD3D11: (flags & FLAG_ZERO_COPY_D3D11) !== 0,
+    zeroCopyD3D12: (flags & FLAG_ZERO_COPY_D3D12) !== 0,
+    queueMode: queueMode as NativeQueueMode,
+    queueDepthChanges: view.getUint32(79, true),
+    presentPacingChanges: view.getUint32(83, true),
+    partialFlushCount: view.getUint32(87, true),
+    completeFlushCount: view.getUint32(91, true),
+    lastTransitionType,
+    lastTransitionAtMs:
+      flags & FLAG_HAS_LAST_TRANSITION_AT_MS ? Number(view.getBigUint64(95, true)) : undefined,
+    lastTransitionSummary,
+    requestedStreamingFeaturesSummary,
+    finalizedStreamingFeaturesSummary,
+  };
+}
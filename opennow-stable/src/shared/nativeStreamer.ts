@@ -1,5 +1,6 @@
 import type {
   IceCandidatePayload,
+  NativeFrameLatencyStats,
   NativeStreamerBackend,
   NativeStreamStats,
   NativeRenderSurface,
@@ -27,7 +28,10 @@ export interface NativeStreamerCapabilities {
 }
 
 export interface NativeStreamerInputPacket {
-  payloadBase64: string;
+  /** Raw packet bytes, sent as-is over the binary IPC channel when connected. */
+  payloadBytes?: Uint8Array;
+  /** Base64 payload for the JSON-over-stdio fallback path. */
+  payloadBase64?: string;
   partiallyReliable?: boolean;
 }
 
@@ -159,6 +163,10 @@ export type NativeStreamerEvent =
       type: "stats";
       stats: NativeStreamStats;
     }
+  | {
+      type: "frame-latency";
+      latency: NativeFrameLatencyStats;
+    }
   | {
       type: "error";
       code?: string;